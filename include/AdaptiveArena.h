@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 #include <filesystem>
 #include <memory_resource>
 
@@ -18,6 +21,152 @@ namespace AdaptiveArena
         UltrasoundRF   ///< 초음파 RF 데이터 처리 전용 (SoA, Zero-Copy, Ring Buffer)
     };
 
+    /**
+     * @brief  지연 분포 요약 (마이크로초 단위)
+     */
+    struct LatencyPercentiles 
+    {
+        double p50Us = 0.0;
+        double p99Us = 0.0;
+        double p999Us = 0.0;
+        double maxUs = 0.0;
+        double meanUs = 0.0;
+        uint64_t samples = 0;
+    };
+
+    /**
+     * @brief  아레나가 배치를 결정하는 스레드의 역할입니다.
+     */
+    enum class ThreadRole 
+    {
+        Producer,    ///< 슬롯을 채우고 Commit 하는 스레드 (재생, 수집 등)
+        Consumer,    ///< 커서 소비자 (ordinal 0은 Producer와 캐시를 공유하는 첫 소비자)
+        Worker,      ///< Work-Stealing 작업자 (아레나 코어 집합 안에서 부동)
+        Recorder,    ///< 녹화 스레드
+        Warmer,      ///< 링 Prefault 스레드 (초기화 시에만)
+        Telemetry    ///< GUI/텔레메트리 스레드 (아레나 코어와 분리)
+    };
+
+    /**
+     * @brief  아레나 스레드의 코어 고정 및 우선순위 배치 명세입니다.
+     */
+    struct ThreadPlacement 
+    {
+        bool enabled = false;
+        std::vector<unsigned> cores;       ///< 아레나 스레드가 사용할 논리 프로세서 (비어 있으면 Telemetry 코어를 제외한 전체)
+        bool pinThreads = true;            ///< Producer/Consumer를 단일 코어에 고정 (스케줄러 Migration 방지)
+        bool realtimePriority = true;      ///< Producer/Consumer를 TIME_CRITICAL로 (거부되면 HIGHEST, 그래도 안 되면 유지)
+        bool isolateTelemetry = true;      ///< 첫 물리 코어를 GUI/텔레메트리 전용으로 남겨둠
+        bool shareProducerCache = true;    ///< 첫 소비자를 Producer와 L2(없으면 L3)를 공유하는 코어에 배치
+    };
+
+    /**
+     * @brief  NUMA 노드 간 메모리 트래픽 집계 (UMA에서는 nodeCount == 1, 원격 항목은 0)
+     */
+    struct NumaTelemetry 
+    {
+        size_t nodeCount = 1;
+        uint64_t localAllocations = 0;    ///< 호출 스레드와 같은 노드의 풀에서 제공된 할당
+        uint64_t remoteAllocations = 0;   ///< 다른 노드의 풀에서 제공된 할당 (Builder 바인딩 등)
+        uint64_t remoteBytes = 0;
+        uint64_t remoteFrameReads = 0;    ///< 링 노드가 아닌 노드에서 Acquire된 프레임 (UltrasoundRF)
+        uint64_t remoteFrameBytes = 0;
+    };
+
+    constexpr size_t kMaxTelemetryStages = 8;
+
+    /**
+     * @brief  파이프라인 단계(커서) 하나의 텔레메트리 (TelemetrySnapshot 내부 POD)
+     */
+    struct StageTelemetry 
+    {
+        char name[32] = {};
+        uint64_t lag = 0;
+        double avgServiceUs = 0.0;
+        LatencyPercentiles queueLatency;     ///< Commit → Acquire
+        uint64_t lostFrames = 0;
+        uint64_t duplicateFrames = 0;
+    };
+
+    /**
+     * @brief  한 시점의 아레나 상태 전체 (POD). 샘플러가 Seqlock으로 게시하며, 대시보드/Exporter/테스트는 이 사본만 읽습니다.
+     */
+    struct TelemetrySnapshot 
+    {
+        uint64_t sequence = 0;               ///< 샘플 번호 (0이면 아직 샘플 없음)
+        uint64_t timestampNs = 0;            ///< steady_clock 기준 수집 시각
+        char workloadKey[32] = {};
+
+        // Allocator
+        uint64_t currentUsage = 0;
+        uint64_t peakUsage = 0;
+        uint64_t predictedBytes = 0;
+        double lastAllocationLatencyNs = 0.0;
+        uint64_t checkpoints = 0;
+        NumaTelemetry numa;
+
+        // Ring (UltrasoundRF, ringSlots == 0이면 링 없음)
+        bool cudaActive = false;
+        bool retentionFrozen = false;
+        uint64_t ringSlots = 0;
+        uint64_t ringLag = 0;
+        uint64_t predictedSlots = 0;
+        double throughputGBs = 0.0;
+        uint64_t droppedFrames = 0;
+        uint64_t ringExpansions = 0;         ///< 링이 실제로 확장된 횟수
+        uint64_t retainedFrames = 0;
+        uint64_t scratchBytes = 0;
+        uint64_t scratchOverflows = 0;
+        uint64_t stageCount = 0;             ///< 전체 커서 수 (stages에는 앞의 kMaxTelemetryStages개만)
+        StageTelemetry stages[kMaxTelemetryStages];
+    };
+
+    /**
+     * @brief  다중 해상도 시계열로 보관하는 텔레메트리 항목입니다.
+     */
+    enum class TelemetrySeries 
+    {
+        UsageBytes,
+        PeakBytes,
+        PredictedBytes,
+        AllocationLatencyNs,
+        RingSlots,
+        RingLag,
+        ThroughputGBs,
+        DroppedFrames,
+        QueueLatencyP99Us,     ///< 모든 단계 중 가장 큰 Commit → Acquire p99
+        Count
+    };
+
+    /**
+     * @brief  시계열 구간 하나 (원본 샘플이면 min == max == mean, samples == 1)
+     */
+    struct SeriesPoint 
+    {
+        uint64_t timestampNs = 0;   ///< 구간 시작 시각 (steady_clock, TelemetrySnapshot::timestampNs와 같은 기준)
+        double min = 0.0;
+        double max = 0.0;
+        double mean = 0.0;
+        uint32_t samples = 0;
+    };
+
+    constexpr size_t kMaxAllocationFrames = 16;
+
+    /**
+     * @brief  샘플링 할당 프로파일러가 집계한 호출 위치(스택) 하나입니다. 바이트 값은 샘플 가중치로 추정한 전체 값입니다.
+     */
+    struct AllocationSite 
+    {
+        uint32_t stackHash = 0;
+        uint64_t samples = 0;             ///< 이 위치에서 뽑힌 샘플 수
+        uint64_t totalBytes = 0;          ///< 추정 누적 할당 바이트
+        uint64_t liveBytes = 0;           ///< 추정 미해제 바이트
+        uint64_t liveAtPeakBytes = 0;     ///< 추정 미해제 합계가 최대였던 시점의 이 위치 미해제 바이트 (학습 피크 기여분)
+        uint64_t sampledBytes = 0;        ///< 샘플된 할당의 실제 요청 크기 합 (평균 크기 = sampledBytes / samples)
+        size_t frameCount = 0;
+        uintptr_t frames[kMaxAllocationFrames] = {};   ///< 반환 주소 (do_allocate 바깥부터)
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Resource Class
     // std::pmr::memory_resource를 래핑하거나 상속받아 지능형 메모리 풀 기능을 제공하는 주체입니다.
@@ -28,7 +177,11 @@ namespace AdaptiveArena
 
         // Resource 특유의 추가 기능 인터페이스 (예: Telemetry 제어)
         virtual void ResetLearning() = 0;
-        virtual void SaveStatistics() = 0;
+        virtual void SaveStatistics() = 0;   ///< 비차단 저장 요청 (백그라운드 체크포인트)
+
+        // Workload Profiles (영상 모드별 학습 상태, 전환 시 결합하지 않고 교체)
+        virtual void SwitchWorkload(const std::string& key) { (void)key; }
+        virtual std::string GetWorkloadKey() const { return {}; }
 
         // Telemetry Getters
         virtual size_t GetCurrentUsage() const = 0;
@@ -44,6 +197,47 @@ namespace AdaptiveArena
         virtual size_t GetRingBufferSize() const { return 0; }
         virtual size_t GetRingBufferOccupancy() const { return 0; }
         virtual size_t GetPredictedSlotCount() const { return 0; }
+
+        // End-to-End Frame Latency (소비자별, Tail Latency SLA 모니터링)
+        virtual size_t GetConsumerCount() const { return 0; }
+        virtual LatencyPercentiles GetQueueLatency(size_t consumer) const { (void)consumer; return {}; }     ///< Commit → Acquire
+        virtual LatencyPercentiles GetServiceLatency(size_t consumer) const { (void)consumer; return {}; }   ///< Acquire → Release
+        virtual uint64_t GetDroppedFrames() const { return 0; }   ///< 소비되기 전에 덮어쓰인 프레임 수
+
+        // NUMA Placement
+        virtual NumaTelemetry GetNumaTelemetry() const { return {}; }
+
+        // Telemetry Snapshot (관측 측은 이 세 함수만 사용 권장: 필드별 Getter는 서로 다른 시점의 값을 읽음)
+        virtual void CaptureTelemetry(TelemetrySnapshot& out) const { (void)out; }   ///< 지금 상태를 직접 수집 (샘플러가 호출)
+        virtual TelemetrySnapshot GetTelemetry() const { return {}; }                ///< 샘플러가 마지막으로 게시한 사본 (잠금 없음)
+        virtual size_t GetTelemetryHistory(uint64_t afterSequence, std::vector<TelemetrySnapshot>& out) const   ///< afterSequence 이후 샘플을 순서대로 추가
+        { 
+            (void)afterSequence; (void)out; 
+            return 0; 
+        }
+
+        // Allocation Profiler (샘플링, 기본 꺼짐)
+        virtual void SetAllocationProfiling(size_t sampleIntervalBytes) { (void)sampleIntervalBytes; }   ///< 평균 샘플 간격 (0이면 끔)
+        virtual size_t GetAllocationSites(std::vector<AllocationSite>& out, size_t maxSites) const       ///< 추정 누적 바이트 순 상위 maxSites개
+        { 
+            (void)out; (void)maxSites; 
+            return 0; 
+        }
+        virtual bool DumpAllocationProfile(const std::filesystem::path& path) const { (void)path; return false; }
+
+        // Allocation Trace (전체 할당/해제를 바이너리 파일로 기록, trace_replay로 재생)
+        virtual void StartAllocationTrace(const std::filesystem::path& path) { (void)path; }   ///< 기록 시작 (파일 생성 실패 시 std::runtime_error)
+        virtual void StopAllocationTrace() {}
+
+        /**
+         * @brief  [fromNs, toNs] 구간의 시계열을 최대 maxPoints개로 out에 추가합니다 (구간을 덮는 가장 세밀한 해상도를 선택).
+         * @return size_t  추가한 점 수
+         */
+        virtual size_t QueryTelemetrySeries(TelemetrySeries series, uint64_t fromNs, uint64_t toNs, size_t maxPoints, std::vector<SeriesPoint>& out) const 
+        {
+            (void)series; (void)fromNs; (void)toNs; (void)maxPoints; (void)out;
+            return 0;
+        }
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,7 +246,7 @@ namespace AdaptiveArena
     class Builder 
     {
     public:
-        Builder() : m_hardLimit(1024 * 1024 * 1024), m_mode(ArenaMode::Generic), m_gpuDirect(false) {}
+        Builder() : m_hardLimit(1024 * 1024 * 1024), m_mode(ArenaMode::Generic), m_gpuDirect(false), m_integrityCheck(false), m_numaNode(-1) {}
         ~Builder() = default;
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,11 +309,111 @@ namespace AdaptiveArena
             return *this;
         }
 
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  프레임별 페이로드 무결성 검사(비밀키로 시드된 CRC32C)를 설정합니다 (UltrasoundRF 모드).
+         * @param  enable  활성화 여부
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetIntegrityCheck(bool enable)
+        {
+            m_integrityCheck = enable;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  PMR 할당과 링 페이로드를 특정 NUMA 노드의 풀에 고정합니다.
+         *         지정하지 않으면(-1) 각 할당은 호출 스레드가 실행 중인 노드의 풀에서 제공됩니다.
+         * @param  node  NUMA 노드 번호 (-1이면 호출 스레드의 노드)
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetNumaNode(int node)
+        {
+            m_numaNode = node;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  아레나 스레드(파이프라인 단계, 작업자, 녹화, Prefault)의 코어 고정 및 우선순위 명세를 설정합니다 (UltrasoundRF 모드).
+         * @param  placement  배치 명세 (enabled == false이면 OS 스케줄러에 맡김)
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetThreadPlacement(const ThreadPlacement& placement)
+        {
+            m_threadPlacement = placement;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  시작 시 적용할 워크로드 키(영상 모드 등)를 설정합니다. 세션 파일에는 키별 프로필이 따로 저장되며,
+         *         실행 중 모드가 바뀌면 Resource::SwitchWorkload로 해당 키의 프로필로 교체합니다.
+         * @param  key  1~31자 워크로드 이름 (예: "b-mode", "color-doppler", "3d")
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetWorkloadKey(const std::string& key)
+        {
+            m_workloadKey = key;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  학습 프로필을 백그라운드에서 저장하는 주기를 설정합니다. 비정상 종료 시 최대 한 주기의 학습만 잃습니다.
+         * @param  interval  체크포인트 주기 (0이면 SaveStatistics 요청과 종료 시에만 저장, 기본 30초)
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetCheckpointInterval(std::chrono::milliseconds interval)
+        {
+            m_checkpointInterval = interval;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  텔레메트리 샘플러의 수집 주기를 설정합니다. 샘플러 스레드가 이 주기로 TelemetrySnapshot을 게시하고 이력 링에 남깁니다.
+         * @param  hz  초당 샘플 수 (0이면 샘플러를 끄고 GetTelemetry는 빈 사본을 반환, 기본 20)
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetTelemetryRate(double hz)
+        {
+            m_telemetryRateHz = hz;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  샘플링 할당 프로파일러를 켭니다 (기본 꺼짐). 평균 sampleIntervalBytes 바이트마다 한 번(Poisson) 호출 스택을 기록하여
+         *         호출 위치별 누적/미해제 바이트를 추정합니다. 샘플되지 않은 할당의 비용은 스레드 로컬 카운터 감소 한 번입니다.
+         * @param  sampleIntervalBytes  평균 샘플 간격 (0이면 끔, 권장 512KB ~ 2MB)
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetAllocationProfiling(size_t sampleIntervalBytes)
+        {
+            m_profileInterval = sampleIntervalBytes;
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  모든 할당/해제(크기, 정렬, 스레드, 시각)를 압축 바이너리 추적 파일로 기록합니다 (기본 꺼짐).
+         *         이벤트는 스레드별 버퍼에 쌓였다가 백그라운드 스레드가 파일로 내보내며, trace_replay 도구로 다른 할당기와 비교 재생할 수 있습니다.
+         * @param  path  추적 파일 경로 (비어 있으면 끔)
+         * @return Builder& (Chaining 지원)
+         */
+        Builder& SetAllocationTrace(const std::filesystem::path& path)
+        {
+            m_tracePath = path;
+            return *this;
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /**
          * @brief  설정된 파라미터를 기반으로 Resource 객체를 생성합니다.
          * @return std::unique_ptr<Resource> 생성된 자원 객체
-         * @throw  std::runtime_error 필수 설정 누락 시 발생
+         * @throw  std::runtime_error 필수 설정 누락 또는 추적 파일 생성 실패 시 발생
          */
         std::unique_ptr<Resource> Build();
 
@@ -129,6 +423,14 @@ namespace AdaptiveArena
         size_t m_hardLimit;
         ArenaMode m_mode;
         bool m_gpuDirect;
+        bool m_integrityCheck;
+        int m_numaNode;
+        ThreadPlacement m_threadPlacement;
+        std::string m_workloadKey;
+        std::chrono::milliseconds m_checkpointInterval{ 30000 };
+        double m_telemetryRateHz = 20.0;
+        size_t m_profileInterval = 0;
+        std::filesystem::path m_tracePath;
     };
 
 } // namespace AdaptiveArena
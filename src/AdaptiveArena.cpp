@@ -15,15 +15,39 @@ namespace AdaptiveArena
             throw std::runtime_error("Secret key is required for integrity verification.");
         }
 
+        const std::string workloadKey = m_workloadKey.empty() ? std::string(kDefaultWorkloadKey) : m_workloadKey;
+        if (!ProfileLibrary::IsValidKey(workloadKey))
+        {
+            throw std::runtime_error("Workload key must be 1-31 characters.");
+        }
+
         if (m_mode == ArenaMode::UltrasoundRF) 
         {
             // 초음파 모드 리소스 생성
-            return std::make_unique<UltrasoundArena>(m_secretKey, m_logPath, m_hardLimit, m_gpuDirect);
+            auto arena = std::make_unique<UltrasoundArena>(m_secretKey, m_logPath, m_hardLimit, m_gpuDirect, workloadKey);
+            arena->SetIntegrityCheck(m_integrityCheck);
+            arena->SetNumaBinding(m_numaNode);
+            arena->SetThreadPlacement(m_threadPlacement);
+            arena->SetCheckpointInterval(m_checkpointInterval);
+            arena->SetTelemetryRate(m_telemetryRateHz);
+            arena->SetAllocationProfiling(m_profileInterval);
+            if (!m_tracePath.empty()) arena->StartAllocationTrace(m_tracePath);
+
+            // 완전히 생성된 뒤에만 체크포인트 스레드 시작 (스냅샷이 가상 함수 CaptureProfile을 호출)
+            arena->StartCheckpoints();
+            return arena;
         }
         else 
         {
             // 일반 모드 리소스 생성
-            return std::make_unique<InternalResource>(m_secretKey, m_logPath, m_hardLimit);
+            auto resource = std::make_unique<InternalResource>(m_secretKey, m_logPath, m_hardLimit, workloadKey);
+            resource->SetNumaBinding(m_numaNode);
+            resource->SetCheckpointInterval(m_checkpointInterval);
+            resource->SetTelemetryRate(m_telemetryRateHz);
+            resource->SetAllocationProfiling(m_profileInterval);
+            if (!m_tracePath.empty()) resource->StartAllocationTrace(m_tracePath);
+            resource->StartCheckpoints();
+            return resource;
         }
     }
 
@@ -0,0 +1,267 @@
+#define NOMINMAX
+#include "AllocationProfiler.h"
+#include <windows.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace AdaptiveArena
+{
+    std::atomic<size_t> AllocationProfiler::s_meanInterval{ 0 };
+    std::atomic<size_t> AllocationProfiler::s_enabledCount{ 0 };
+
+    namespace
+    {
+        constexpr DWORD kSkipFrames = 2;   // OnSampleDue, do_allocate 건너뜀 (memory_resource::allocate 또는 호출자부터 기록)
+
+        // 스레드별 xorshift64* (샘플 간격 추첨 전용)
+        double NextUniform()
+        {
+            thread_local uint64_t state = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) ^
+                                          static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^ 0x9E3779B97F4A7C15ull;
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            const uint64_t value = state * 0x2545F4914F6CDD1Dull;
+            return (static_cast<double>(value >> 11) + 1.0) * (1.0 / 9007199254740993.0);   // (0, 1]
+        }
+
+        std::string FormatFrame(uintptr_t address)
+        {
+            // "모듈+0x오프셋" (ASLR과 무관하게 PDB로 해석 가능)
+            HMODULE module = nullptr;
+            wchar_t modulePath[MAX_PATH] = {};
+            std::ostringstream text;
+            if (GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                                   reinterpret_cast<LPCWSTR>(address), &module) && module &&
+                GetModuleFileNameW(module, modulePath, MAX_PATH) > 0)
+            {
+                text << std::filesystem::path(modulePath).filename().string() << "+0x" << std::hex << (address - reinterpret_cast<uintptr_t>(module));
+            }
+            else
+            {
+                text << "0x" << std::hex << address;
+            }
+            return text.str();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    AllocationProfiler::AllocationProfiler()
+        : m_interval(0)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    AllocationProfiler::~AllocationProfiler()
+    {
+        SetInterval(0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetInterval
+    void AllocationProfiler::SetInterval(size_t sampleIntervalBytes)
+    {
+        const size_t previous = m_interval.exchange(sampleIntervalBytes, std::memory_order_relaxed);
+        if (previous == 0 && sampleIntervalBytes != 0)
+        {
+            s_enabledCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (previous != 0 && sampleIntervalBytes == 0)
+        {
+            if (s_enabledCount.fetch_sub(1, std::memory_order_relaxed) == 1) s_meanInterval.store(0, std::memory_order_relaxed);
+        }
+        if (sampleIntervalBytes != 0) s_meanInterval.store(sampleIntervalBytes, std::memory_order_relaxed);
+
+        if (previous != 0 && sampleIntervalBytes == 0)
+        {
+            // 꺼진 뒤에는 해제 경로가 필터 로드 한 번으로 끝나도록 미해제 샘플을 버림
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ClearLiveSamples();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ClearLiveSamples
+    void AllocationProfiler::ClearLiveSamples()
+    {
+        for (auto& slot : m_filter) slot.store(0, std::memory_order_relaxed);
+        for (auto& entry : m_sites)
+        {
+            entry.second.liveBytes = 0;
+        }
+        m_live.clear();
+        m_liveTotal = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // NextInterval
+    int64_t AllocationProfiler::NextInterval()
+    {
+        const size_t mean = s_meanInterval.load(std::memory_order_relaxed);
+        if (mean == 0) return static_cast<int64_t>(kRecheckBytes);
+
+        // 지수 분포: -ln(U) * mean (상한은 평균의 64배)
+        const double interval = -std::log(NextUniform()) * static_cast<double>(mean);
+        return static_cast<int64_t>(std::min(std::max(interval, 1.0), 64.0 * static_cast<double>(mean)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // OnSampleDue
+    void AllocationProfiler::OnSampleDue(void* ptr, size_t bytes)
+    {
+        s_bytesUntilSample = NextInterval();
+
+        const size_t interval = m_interval.load(std::memory_order_relaxed);
+        if (interval == 0 || !ptr) return;
+
+        // 1. 호출 스택 (해시는 RtlCaptureStackBackTrace가 함께 계산)
+        Site captured;
+        ULONG hash = 0;
+        captured.frameCount = RtlCaptureStackBackTrace(kSkipFrames, static_cast<DWORD>(kMaxAllocationFrames), 
+                                                       reinterpret_cast<PVOID*>(captured.frames), &hash);
+
+        // 2. 가중치: 크기 s의 샘플이 대표하는 기대 바이트 (큰 할당은 거의 항상 샘플되므로 ~s)
+        const double ratio = static_cast<double>(bytes) / static_cast<double>(interval);
+        const uint64_t weight = static_cast<uint64_t>(static_cast<double>(bytes) / -std::expm1(-ratio));
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // SetInterval(0)이 미해제 샘플을 비운 뒤에 늦게 도착한 샘플은 버림
+        if (m_interval.load(std::memory_order_relaxed) == 0) return;
+
+        Site& site = m_sites[static_cast<uint32_t>(hash)];
+        if (site.samples == 0)
+        {
+            site.frameCount = captured.frameCount;
+            std::copy(captured.frames, captured.frames + captured.frameCount, site.frames);
+        }
+        site.samples++;
+        site.totalBytes += weight;
+        site.liveBytes += weight;
+        site.sampledBytes += bytes;
+
+        auto inserted = m_live.insert_or_assign(ptr, LiveSample{ static_cast<uint32_t>(hash), weight });
+        if (inserted.second)
+        {
+            // 블록을 반환하기 전에 표시 (이후 해제 스레드는 포인터 전달의 happens-before로 이 값을 봄)
+            m_filter[FilterIndex(ptr)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // 3. 미해제 합계가 최대를 갱신하면 위치별 기여분을 기록 (학습 피크를 만드는 경로)
+        m_liveTotal += weight;
+        if (m_liveTotal > m_peakLiveTotal)
+        {
+            m_peakLiveTotal = m_liveTotal;
+            for (auto& entry : m_sites) entry.second.liveAtPeakBytes = entry.second.liveBytes;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // OnDeallocate
+    void AllocationProfiler::OnDeallocate(void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_live.find(ptr);
+        if (it == m_live.end()) return;
+
+        auto site = m_sites.find(it->second.stackHash);
+        if (site != m_sites.end())
+        {
+            site->second.liveBytes -= std::min(site->second.liveBytes, it->second.weight);
+        }
+        m_liveTotal -= std::min(m_liveTotal, it->second.weight);
+        m_live.erase(it);
+        m_filter[FilterIndex(ptr)].fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetSites
+    size_t AllocationProfiler::GetSites(std::vector<AllocationSite>& out, size_t maxSites) const
+    {
+        std::vector<AllocationSite> sites;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            sites.reserve(m_sites.size());
+            for (const auto& entry : m_sites)
+            {
+                AllocationSite site;
+                site.stackHash = entry.first;
+                site.samples = entry.second.samples;
+                site.totalBytes = entry.second.totalBytes;
+                site.liveBytes = entry.second.liveBytes;
+                site.liveAtPeakBytes = entry.second.liveAtPeakBytes;
+                site.sampledBytes = entry.second.sampledBytes;
+                site.frameCount = entry.second.frameCount;
+                std::copy(entry.second.frames, entry.second.frames + entry.second.frameCount, site.frames);
+                sites.push_back(site);
+            }
+        }
+
+        const size_t count = std::min(maxSites, sites.size());
+        std::partial_sort(sites.begin(), sites.begin() + count, sites.end(), 
+                          [](const AllocationSite& a, const AllocationSite& b) { return a.totalBytes > b.totalBytes; });
+        out.insert(out.end(), sites.begin(), sites.begin() + count);
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Dump
+    bool AllocationProfiler::Dump(const std::filesystem::path& path) const
+    {
+        std::vector<AllocationSite> sites;
+        GetSites(sites, SIZE_MAX);
+
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file) return false;
+
+        uint64_t total = 0, live = 0;
+        for (const AllocationSite& site : sites)
+        {
+            total += site.totalBytes;
+            live += site.liveBytes;
+        }
+
+        file << "# Adaptive Arena allocation profile\n"
+             << "# sample_interval_bytes " << GetInterval() << "\n"
+             << "# sites " << sites.size() << ", estimated total " << total << " bytes, estimated live " << live << " bytes\n"
+             << "# live_at_peak_bytes is each site's live estimate when the live total peaked\n"
+             << "# total_bytes live_bytes live_at_peak_bytes samples avg_size stack_hash | frames (innermost first)\n";
+        for (const AllocationSite& site : sites)
+        {
+            file << site.totalBytes << ' ' << site.liveBytes << ' ' << site.liveAtPeakBytes << ' ' << site.samples << ' ' 
+                 << (site.samples ? site.sampledBytes / site.samples : 0) << " 0x" << std::hex << std::setw(8) << std::setfill('0') 
+                 << site.stackHash << std::dec << std::setfill(' ') << " |";
+            for (size_t i = 0; i < site.frameCount; ++i) file << ' ' << FormatFrame(site.frames[i]);
+            file << '\n';
+        }
+        return static_cast<bool>(file);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Reset
+    void AllocationProfiler::Reset()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_sites)
+        {
+            entry.second.samples = 0;
+            entry.second.totalBytes = 0;
+            entry.second.sampledBytes = 0;
+            entry.second.liveAtPeakBytes = entry.second.liveBytes;
+        }
+        m_peakLiveTotal = m_liveTotal;
+        // 미해제 샘플이 없는 위치만 제거 (남은 위치는 liveBytes를 계속 추적)
+        for (auto it = m_sites.begin(); it != m_sites.end();)
+        {
+            if (it->second.liveBytes == 0) it = m_sites.erase(it);
+            else ++it;
+        }
+    }
+
+} // namespace AdaptiveArena
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../include/AdaptiveArena.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  tcmalloc 방식의 샘플링 할당 프로파일러입니다. 각 스레드가 "다음 샘플까지 남은 바이트"를 스레드 로컬로 세고,
+     *         0 아래로 내려간 할당만 느린 경로에서 스택 해시(RtlCaptureStackBackTrace)와 함께 기록합니다.
+     *         다음 간격은 평균 interval의 지수 분포(Poisson 과정)에서 뽑으므로 크기와 무관하게 바이트 단위로 편향 없이 샘플되며,
+     *         크기 s인 샘플은 s / (1 - e^(-s/interval)) 바이트를 대표합니다.
+     *         샘플 간격은 프로세스 전체가 공유합니다 (스레드 로컬 카운터가 하나이므로 마지막으로 켠 아레나의 간격이 적용).
+     */
+    class AllocationProfiler
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        AllocationProfiler();
+        ~AllocationProfiler();
+
+        AllocationProfiler(const AllocationProfiler&) = delete;
+        AllocationProfiler& operator=(const AllocationProfiler&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Hot Path (do_allocate / do_deallocate에서 인라인)
+    public:
+        /**
+         * @brief  할당 크기만큼 카운터를 줄이고 샘플 시점인지 반환합니다 (샘플되지 않은 할당의 유일한 비용).
+         */
+        static bool CountDown(size_t bytes)
+        {
+            s_bytesUntilSample -= static_cast<int64_t>(bytes);
+            return s_bytesUntilSample < 0;
+        }
+
+        /**
+         * @brief  CountDown이 true일 때 호출합니다. 다음 간격을 뽑고, 이 프로파일러가 켜져 있으면 호출 스택을 기록합니다.
+         */
+        void OnSampleDue(void* ptr, size_t bytes);
+
+        /**
+         * @brief  블록이 샘플되었을 수 있는지 반환합니다 (주소 해시 칸의 relaxed 로드 한 번, 잠금 없음).
+         *         샘플된 블록의 칸은 해제될 때까지 0이 아니므로 거짓 음성은 없고, 거짓 양성만 OnDeallocate의 조회로 걸러집니다.
+         */
+        bool MayBeSampled(const void* ptr) const { return m_filter[FilterIndex(ptr)].load(std::memory_order_relaxed) != 0; }
+        void OnDeallocate(void* ptr);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Control / Report
+    public:
+        /**
+         * @brief  평균 샘플 간격을 설정합니다 (0이면 끔: 기록된 위치는 유지하되 미해제 샘플 추적은 비워 해제 경로 비용을 없앰).
+         *         각 스레드는 현재 카운터를 소진한 뒤(꺼져 있을 때는 최대 kRecheckBytes) 새 간격을 사용합니다.
+         */
+        void SetInterval(size_t sampleIntervalBytes);
+        size_t GetInterval() const { return m_interval.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  추정 누적 바이트 순으로 상위 maxSites개 위치를 out에 추가합니다.
+         */
+        size_t GetSites(std::vector<AllocationSite>& out, size_t maxSites) const;
+
+        /**
+         * @brief  전체 위치를 텍스트로 기록합니다 (반환 주소는 "모듈+오프셋"으로, 디버거/PDB에서 심볼 해석).
+         */
+        bool Dump(const std::filesystem::path& path) const;
+
+        /**
+         * @brief  집계를 비웁니다 (미해제 샘플 추적은 유지하여 이후 해제가 음수가 되지 않도록 함).
+         */
+        void Reset();
+
+        static constexpr size_t kRecheckBytes = 16 * 1024 * 1024;   // 프로파일러가 모두 꺼져 있을 때의 카운터 간격
+        static constexpr size_t kFilterSlots = 8192;                  // 미해제 샘플 필터 칸 수 (거짓 양성률 ~ 미해제 샘플 수 / 칸 수)
+
+    private:
+        struct Site
+        {
+            uint64_t samples = 0;
+            uint64_t totalBytes = 0;
+            uint64_t liveBytes = 0;
+            uint64_t liveAtPeakBytes = 0;
+            uint64_t sampledBytes = 0;
+            size_t frameCount = 0;
+            uintptr_t frames[kMaxAllocationFrames] = {};
+        };
+
+        struct LiveSample
+        {
+            uint32_t stackHash;
+            uint64_t weight;
+        };
+
+        static int64_t NextInterval();
+
+        static size_t FilterIndex(const void* ptr)
+        {
+            // 정렬로 항상 0인 하위 비트를 버리고 Fibonacci 해시의 상위 13비트를 사용
+            return static_cast<size_t>(((reinterpret_cast<uintptr_t>(ptr) >> 4) * 0x9E3779B97F4A7C15ull) >> (64 - 13));
+        }
+
+        void ClearLiveSamples();   // m_mutex 보유 상태에서 호출
+
+    private:
+        static inline thread_local int64_t s_bytesUntilSample = 0;   // 첫 할당에서 느린 경로로 들어가 간격을 뽑음
+        static std::atomic<size_t> s_meanInterval;                    // 켜진 프로파일러의 간격 (0이면 모두 꺼짐)
+        static std::atomic<size_t> s_enabledCount;
+
+        std::atomic<size_t> m_interval;
+        std::array<std::atomic<uint32_t>, kFilterSlots> m_filter{};   // 칸별 미해제 샘플 수 (Counting Filter, 변경은 m_mutex)
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<uint32_t, Site> m_sites;        // m_mutex
+        std::unordered_map<void*, LiveSample> m_live;      // m_mutex
+        uint64_t m_liveTotal = 0;                          // m_mutex, 추정 미해제 합계
+        uint64_t m_peakLiveTotal = 0;                      // m_mutex
+    };
+
+} // namespace AdaptiveArena
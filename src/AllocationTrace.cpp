@@ -0,0 +1,322 @@
+#define NOMINMAX
+#include "AllocationTrace.h"
+#include "LatencyHistogram.h"
+#include <windows.h>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace AdaptiveArena
+{
+    std::atomic<uint64_t> AllocationTraceRecorder::s_generation{ 0 };
+    thread_local AllocationTraceRecorder::ThreadCache AllocationTraceRecorder::s_cache;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    AllocationTraceRecorder::AllocationTraceRecorder()
+        : m_active(false)
+        , m_generation(0)
+        , m_sequence(0)
+        , m_droppedEvents(0)
+        , m_startNs(0)
+        , m_stopRequested(false)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    AllocationTraceRecorder::~AllocationTraceRecorder()
+    {
+        Stop();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void AllocationTraceRecorder::Start(const std::filesystem::path& path)
+    {
+        Stop();
+
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        TraceFileHeader header{ kTraceMagic, kTraceVersion, static_cast<uint32_t>(sizeof(TraceEvent)), 0 };
+        if (!m_file || !m_file.write(reinterpret_cast<const char*>(&header), sizeof(header)))
+        {
+            m_file.close();
+            throw std::runtime_error("Failed to create allocation trace: " + path.string());
+        }
+
+        {
+            // 이전 세션에 등록된 스레드 버퍼는 그대로 재사용 (버퍼는 기록기 수명 동안 유지: 늦게 도착한 Record가 해제된 버퍼를 보지 않도록)
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.clear();
+            m_stopRequested = false;
+            for (auto& buffer : m_buffers)
+            {
+                buffer->count = 0;
+                buffer->events.resize(kChunkEvents);
+            }
+        }
+
+        m_sequence.store(0, std::memory_order_relaxed);
+        m_droppedEvents.store(0, std::memory_order_relaxed);
+        m_startNs = TscClock::NowNs();
+        m_generation.store(s_generation.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        m_thread = std::thread(&AllocationTraceRecorder::WriterLoop, this);
+        m_active.store(true, std::memory_order_seq_cst);
+
+        std::cout << "[Internal] Allocation trace started: " << path.string() << std::endl;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void AllocationTraceRecorder::Stop()
+    {
+        if (!m_thread.joinable()) return;
+
+        m_active.store(false, std::memory_order_seq_cst);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& buffer : m_buffers)
+            {
+                // 비활성을 보기 전에 쓰기를 시작한 스레드가 끝날 때까지 (이벤트 하나 분량)
+                while (buffer->writing.load(std::memory_order_seq_cst))
+                {
+                    std::this_thread::yield();
+                }
+                HandOff(*buffer, true);
+            }
+            m_stopRequested = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+        m_file.close();
+
+        std::cout << "[Internal] Allocation trace stopped: " << GetEventCount() << " events";
+        if (GetDroppedEvents() > 0)
+        {
+            std::cout << " (" << GetDroppedEvents() << " dropped: writer fell behind)";
+        }
+        std::cout << "." << std::endl;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Record
+    void AllocationTraceRecorder::Record(void* ptr, size_t bytes, size_t alignment, bool isFree)
+    {
+        ThreadBuffer* buffer = s_cache.buffer;
+        if (s_cache.generation != m_generation.load(std::memory_order_relaxed))
+        {
+            buffer = RegisterThread();
+        }
+        if (!buffer)
+        {
+            m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Stop과의 Dekker 핸드셰이크: 쓰기 표시 → 활성 확인 (둘 중 하나는 반드시 상대를 봄)
+        buffer->writing.store(true, std::memory_order_seq_cst);
+        if (!m_active.load(std::memory_order_seq_cst) || buffer->events.size() != kChunkEvents)
+        {
+            buffer->writing.store(false, std::memory_order_release);
+            return;
+        }
+
+        const uint64_t nowNs = TscClock::NowNs() - m_startNs;
+        if (buffer->count == 0)
+        {
+            buffer->baseNs = nowNs;
+            buffer->lastNs = nowNs;
+        }
+
+        uint64_t alignLog2 = 0;
+        while ((size_t(1) << alignLog2) < alignment && alignLog2 < 63) ++alignLog2;
+
+        // 시퀀스는 단일 원자 변수의 RMW이므로 relaxed여도 happens-before 순서와 일치
+        const uint64_t sequence = m_sequence.fetch_add(1, std::memory_order_relaxed) & kTraceSequenceMask;
+
+        TraceEvent& event = buffer->events[buffer->count++];
+        event.sequenceAndFlags = sequence | (alignLog2 << kTraceAlignShift) | (isFree ? kTraceFreeFlag : 0);
+        event.address = reinterpret_cast<uintptr_t>(ptr);
+        event.size = static_cast<uint32_t>(std::min<size_t>(bytes, std::numeric_limits<uint32_t>::max()));
+        event.deltaNs = static_cast<uint32_t>(std::min<uint64_t>(nowNs - buffer->lastNs, std::numeric_limits<uint32_t>::max()));
+        buffer->lastNs = nowNs;
+
+        const bool full = buffer->count == kChunkEvents;
+        buffer->writing.store(false, std::memory_order_release);
+
+        if (full)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            HandOff(*buffer, false);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RegisterThread
+    AllocationTraceRecorder::ThreadBuffer* AllocationTraceRecorder::RegisterThread()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // 여러 기록기를 번갈아 쓰는 스레드는 여기서 자기 버퍼를 다시 찾음 (캐시는 하나)
+        const std::thread::id self = std::this_thread::get_id();
+        auto it = std::find_if(m_buffers.begin(), m_buffers.end(), [&](const auto& buffer) { return buffer->thread == self; });
+
+        ThreadBuffer* buffer = nullptr;
+        if (it != m_buffers.end())
+        {
+            buffer = it->get();
+        }
+        else if (m_buffers.size() >= kMaxThreads)
+        {
+            // 번호를 받지 못한 스레드는 이 세션 동안 잠금 없이 바로 유실 처리
+            s_cache.generation = m_generation.load(std::memory_order_relaxed);
+            s_cache.buffer = nullptr;
+            return nullptr;
+        }
+        else
+        {
+            m_buffers.push_back(std::make_unique<ThreadBuffer>());
+            buffer = m_buffers.back().get();
+            buffer->thread = self;
+            buffer->index = static_cast<uint32_t>(m_buffers.size() - 1);
+        }
+
+        if (buffer->count == 0 && buffer->events.size() != kChunkEvents)
+        {
+            buffer->events.resize(kChunkEvents);
+        }
+
+        s_cache.generation = m_generation.load(std::memory_order_relaxed);
+        s_cache.buffer = buffer;
+        return buffer;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // HandOff
+    void AllocationTraceRecorder::HandOff(ThreadBuffer& buffer, bool final)
+    {
+        // Stop이 먼저 비웠으면 소유 스레드의 뒤늦은 호출은 무시
+        if (buffer.count == 0) return;
+
+        if (!final && m_queue.size() >= kMaxQueuedChunks)
+        {
+            m_droppedEvents.fetch_add(buffer.count, std::memory_order_relaxed);
+            buffer.count = 0;
+            return;
+        }
+
+        Chunk chunk;
+        chunk.header = TraceChunkHeader{ buffer.index, buffer.count, buffer.baseNs };
+        chunk.events = std::move(buffer.events);
+        chunk.events.resize(buffer.count);
+        m_queue.push_back(std::move(chunk));
+        buffer.count = 0;
+
+        buffer.events.clear();
+        if (!final)
+        {
+            if (!m_spare.empty())
+            {
+                buffer.events = std::move(m_spare.back());
+                m_spare.pop_back();
+            }
+            buffer.events.resize(kChunkEvents);
+        }
+        m_cv.notify_one();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriterLoop
+    void AllocationTraceRecorder::WriterLoop()
+    {
+        // 할당 스레드보다 뒤로 (디스크 대기 중에도 코어를 양보)
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+        bool failed = false;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_cv.wait(lock, [this]() { return !m_queue.empty() || m_stopRequested; });
+            if (m_queue.empty()) break;
+
+            Chunk chunk = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+
+            // 파일 I/O는 잠금 밖 (할당 경로의 HandOff를 막지 않음)
+            if (!failed)
+            {
+                m_file.write(reinterpret_cast<const char*>(&chunk.header), sizeof(chunk.header));
+                m_file.write(reinterpret_cast<const char*>(chunk.events.data()), chunk.events.size() * sizeof(TraceEvent));
+                if (!m_file)
+                {
+                    failed = true;
+                    std::cerr << "[Internal] Allocation trace write failed; remaining events are discarded." << std::endl;
+                }
+            }
+            if (failed)
+            {
+                m_droppedEvents.fetch_add(chunk.header.eventCount, std::memory_order_relaxed);
+            }
+
+            lock.lock();
+            if (m_spare.size() < 8)
+            {
+                m_spare.push_back(std::move(chunk.events));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AllocationTraceReader::Load
+    std::vector<AllocationTraceReader::Thread> AllocationTraceReader::Load(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        TraceFileHeader header{};
+        if (!file || !file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        {
+            throw std::runtime_error("Failed to open allocation trace: " + path.string());
+        }
+        if (header.magic != kTraceMagic || header.version != kTraceVersion || header.eventSize != sizeof(TraceEvent))
+        {
+            throw std::runtime_error("Not an allocation trace (or unsupported version): " + path.string());
+        }
+
+        std::vector<Thread> threads;
+        TraceChunkHeader chunk{};
+        while (file.read(reinterpret_cast<char*>(&chunk), sizeof(chunk)))
+        {
+            if (chunk.threadIndex >= AllocationTraceRecorder::kMaxThreads || chunk.eventCount > AllocationTraceRecorder::kChunkEvents)
+            {
+                throw std::runtime_error("Corrupted allocation trace chunk: " + path.string());
+            }
+            if (threads.size() <= chunk.threadIndex)
+            {
+                threads.resize(chunk.threadIndex + 1);
+            }
+
+            Thread& thread = threads[chunk.threadIndex];
+            const size_t first = thread.events.size();
+            thread.events.resize(first + chunk.eventCount);
+            if (!file.read(reinterpret_cast<char*>(thread.events.data() + first), chunk.eventCount * sizeof(TraceEvent)))
+            {
+                // 비정상 종료로 잘린 마지막 청크는 버림
+                thread.events.resize(first);
+                std::cerr << "[Internal] Allocation trace is truncated; the last chunk was ignored." << std::endl;
+                break;
+            }
+
+            uint64_t timestamp = chunk.baseTimestampNs;
+            for (size_t i = first; i < thread.events.size(); ++i)
+            {
+                if (i > first) timestamp += thread.events[i].deltaNs;
+                thread.timestampsNs.push_back(timestamp);
+            }
+        }
+        return threads;
+    }
+
+} // namespace AdaptiveArena
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Allocation Trace File Layout
+    //
+    //   [TraceFileHeader]
+    //   [TraceChunkHeader] [TraceEvent x eventCount] [TraceChunkHeader] [TraceEvent x eventCount] ...
+    //
+    // 청크는 한 스레드의 연속 이벤트이며, 스레드 간 청크는 기록 순서대로 섞여 있습니다 (같은 스레드의 청크는 순서 유지).
+    // 스레드 간 순서는 타임스탬프가 아니라 이벤트의 전역 시퀀스로 복원합니다: 할당은 풀에서 블록을 받은 뒤, 해제는 풀에
+    // 돌려주기 전에 시퀀스를 받으므로 "할당 → 다른 스레드의 해제 → 같은 주소의 재할당" 순서가 항상 시퀀스 순서와 일치합니다.
+
+    constexpr uint32_t kTraceMagic = 0x52544141;   // "AATR"
+    constexpr uint32_t kTraceVersion = 1;
+
+    constexpr uint64_t kTraceSequenceMask = (1ull << 56) - 1;
+    constexpr uint32_t kTraceAlignShift = 56;
+    constexpr uint64_t kTraceFreeFlag = 1ull << 63;
+
+    struct TraceFileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t eventSize;       ///< sizeof(TraceEvent)
+        uint32_t reserved;
+    };
+
+    struct TraceChunkHeader
+    {
+        uint32_t threadIndex;     ///< 기록기가 스레드 등록 순서로 부여한 번호 (0부터)
+        uint32_t eventCount;
+        uint64_t baseTimestampNs; ///< 청크 첫 이벤트 시각 (기록 시작 기준)
+    };
+
+    /**
+     * @brief  할당/해제 이벤트 하나 (24바이트)
+     */
+    struct TraceEvent
+    {
+        uint64_t sequenceAndFlags;   ///< [0, 56) 전역 시퀀스, [56, 62) log2(정렬), 63 해제 여부
+        uint64_t address;            ///< 해제를 할당과 짝짓는 키 (재생 시 시퀀스 순서로 해석)
+        uint32_t size;               ///< 요청 크기 (4GB 이상은 UINT32_MAX로 포화)
+        uint32_t deltaNs;            ///< 같은 스레드의 직전 이벤트 이후 경과 시간 (청크 첫 이벤트는 0, 포화)
+
+        bool IsFree() const { return (sequenceAndFlags & kTraceFreeFlag) != 0; }
+        uint64_t GetSequence() const { return sequenceAndFlags & kTraceSequenceMask; }
+        size_t GetAlignment() const { return size_t(1) << ((sequenceAndFlags >> kTraceAlignShift) & 0x3F); }
+    };
+
+    static_assert(sizeof(TraceEvent) == 24, "TraceEvent must stay compact.");
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  InternalResource의 할당/해제를 압축 바이너리 추적 파일로 기록합니다 (기본 꺼짐).
+     *         각 스레드는 자기 버퍼(청크)에 잠금 없이 이벤트를 추가하고, 가득 찬 청크만 기록 스레드로 넘겨 파일 I/O는 할당 경로 밖에서 수행합니다.
+     *         기록 스레드가 밀려 대기 청크가 kMaxQueuedChunks를 넘으면 새 청크는 버리고 개수만 셉니다 (재생 시 짝 없는 해제는 무시됨).
+     */
+    class AllocationTraceRecorder
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        AllocationTraceRecorder();
+        ~AllocationTraceRecorder();
+
+        AllocationTraceRecorder(const AllocationTraceRecorder&) = delete;
+        AllocationTraceRecorder& operator=(const AllocationTraceRecorder&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Hot Path (do_allocate / do_deallocate에서 인라인)
+    public:
+        /**
+         * @brief  기록 중인지 반환합니다 (꺼져 있을 때의 유일한 비용: relaxed 로드 한 번).
+         */
+        bool IsActive() const { return m_active.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  할당을 기록합니다 (풀에서 블록을 받은 뒤 호출, 실패한 할당은 기록하지 않음).
+         */
+        void OnAllocate(void* ptr, size_t bytes, size_t alignment) 
+        { 
+            if (ptr) Record(ptr, bytes, alignment, false); 
+        }
+
+        /**
+         * @brief  해제를 기록합니다 (블록을 풀에 돌려주기 전에 호출: 같은 주소의 재할당보다 시퀀스가 앞서도록).
+         */
+        void OnDeallocate(void* ptr, size_t bytes, size_t alignment) { Record(ptr, bytes, alignment, true); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Control
+    public:
+        /**
+         * @brief  파일을 만들고 기록을 시작합니다 (이미 기록 중이면 먼저 정지).
+         * @throw  std::runtime_error 파일 생성 실패 시 발생
+         */
+        void Start(const std::filesystem::path& path);
+
+        /**
+         * @brief  모든 스레드의 남은 이벤트를 기록하고 파일을 닫습니다 (중복 호출 무시).
+         */
+        void Stop();
+
+        uint64_t GetEventCount() const { return m_sequence.load(std::memory_order_relaxed); }
+        uint64_t GetDroppedEvents() const { return m_droppedEvents.load(std::memory_order_relaxed); }
+
+        static constexpr uint32_t kChunkEvents = 4096;        // 청크당 이벤트 (96KB)
+        static constexpr size_t kMaxQueuedChunks = 256;       // 기록 대기 상한 (약 24MB)
+        static constexpr uint32_t kMaxThreads = 4096;         // 스레드 번호 상한 (Reader도 같은 값으로 검증, 넘는 스레드의 이벤트는 유실로 집계)
+
+    private:
+        struct ThreadBuffer
+        {
+            std::thread::id thread;
+            uint32_t index = 0;
+            std::atomic<bool> writing{ false };   // 소유 스레드가 이벤트를 쓰는 중 (Stop이 끝나기를 기다림)
+            uint32_t count = 0;                   // 소유 스레드 (Stop에서는 writing == false 확인 후)
+            uint64_t baseNs = 0;
+            uint64_t lastNs = 0;
+            std::vector<TraceEvent> events;
+        };
+
+        struct Chunk
+        {
+            TraceChunkHeader header;
+            std::vector<TraceEvent> events;
+        };
+
+        struct ThreadCache
+        {
+            uint64_t generation = 0;
+            ThreadBuffer* buffer = nullptr;
+        };
+
+        void Record(void* ptr, size_t bytes, size_t alignment, bool isFree);
+        ThreadBuffer* RegisterThread();
+        void HandOff(ThreadBuffer& buffer, bool final);   // m_mutex 보유 상태에서 호출 (final: 상한 무시, 새 청크 미할당)
+        void WriterLoop();
+
+    private:
+        static std::atomic<uint64_t> s_generation;            // 기록 세션마다 증가 (모든 기록기 공유: 스레드 캐시 무효화)
+        static thread_local ThreadCache s_cache;              // 스레드마다 마지막으로 기록한 세션의 버퍼
+
+        std::atomic<bool> m_active;
+        std::atomic<uint64_t> m_generation;
+        std::atomic<uint64_t> m_sequence;
+        std::atomic<uint64_t> m_droppedEvents;
+        uint64_t m_startNs;
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;   // m_mutex
+        std::deque<Chunk> m_queue;                              // m_mutex
+        std::vector<std::vector<TraceEvent>> m_spare;           // m_mutex, 기록을 마친 청크 메모리 재사용
+        bool m_stopRequested;                                   // m_mutex
+        std::ofstream m_file;                                   // 기록 스레드 (Start/Stop에서는 스레드 밖)
+        std::thread m_thread;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  추적 파일을 읽어 스레드별 이벤트 목록으로 돌려줍니다 (재생 도구용).
+     */
+    class AllocationTraceReader
+    {
+    public:
+        struct Thread
+        {
+            std::vector<TraceEvent> events;
+            std::vector<uint64_t> timestampsNs;   // 이벤트별 절대 시각 (기록 시작 기준)
+        };
+
+        /**
+         * @throw  std::runtime_error 파일이 없거나 형식이 맞지 않을 때 발생
+         */
+        static std::vector<Thread> Load(const std::filesystem::path& path);
+    };
+
+} // namespace AdaptiveArena
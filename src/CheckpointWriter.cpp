@@ -0,0 +1,145 @@
+#define NOMINMAX
+#include "CheckpointWriter.h"
+#include <windows.h>
+#include <iostream>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    CheckpointWriter::CheckpointWriter(const std::filesystem::path& path, Snapshot snapshot, std::chrono::milliseconds interval)
+        : m_path(path)
+        , m_snapshot(std::move(snapshot))
+        , m_interval(interval)
+        , m_requested(false)
+        , m_stopRequested(false)
+        , m_checkpoints(0)
+        , m_failures(0)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    CheckpointWriter::~CheckpointWriter()
+    {
+        Stop();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void CheckpointWriter::Start()
+    {
+        if (m_thread.joinable()) return;
+
+        m_stopRequested = false;
+        m_thread = std::thread(&CheckpointWriter::WriterLoop, this);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void CheckpointWriter::Stop()
+    {
+        if (!m_thread.joinable()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopRequested = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RequestCheckpoint
+    void CheckpointWriter::RequestCheckpoint()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requested = true;
+        }
+        m_cv.notify_all();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetInterval
+    void CheckpointWriter::SetInterval(std::chrono::milliseconds interval)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_interval = interval;
+        }
+        m_cv.notify_all();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriterLoop
+    void CheckpointWriter::WriterLoop()
+    {
+        // 할당/링 스레드보다 뒤로 (디스크 대기 중에도 코어를 양보)
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto nextDue = std::chrono::steady_clock::now() + m_interval;
+        while (true)
+        {
+            auto wake = [this]() { return m_requested || m_stopRequested; };
+            if (m_interval.count() > 0)
+            {
+                // 주기가 바뀌면 깨어나서 새 주기로 다시 계산
+                const auto interval = m_interval;
+                m_cv.wait_until(lock, nextDue, [&]() { return wake() || m_interval != interval; });
+                if (m_interval != interval)
+                {
+                    nextDue = std::chrono::steady_clock::now() + m_interval;
+                    continue;
+                }
+            }
+            else
+            {
+                m_cv.wait(lock, [&]() { return wake() || m_interval.count() > 0; });
+                if (!wake())
+                {
+                    nextDue = std::chrono::steady_clock::now() + m_interval;
+                    continue;
+                }
+            }
+
+            const bool stopping = m_stopRequested;
+            const bool requested = m_requested;
+            m_requested = false;
+            lock.unlock();
+
+            WriteCheckpoint(stopping || requested);
+
+            lock.lock();
+            if (stopping) break;
+            nextDue = std::chrono::steady_clock::now() + m_interval;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriteCheckpoint
+    bool CheckpointWriter::WriteCheckpoint(bool announce)
+    {
+        // 1. 스냅샷 (대상의 잠금은 사본을 만드는 동안만)
+        ProfileLibrary library = m_snapshot();
+
+        // 2. 잠금 없이 기록 (임시 파일 + 원자적 교체)
+        if (!PersistenceManager::Save(m_path, library))
+        {
+            if (m_failures.fetch_add(1, std::memory_order_relaxed) == 0)
+            {
+                std::cerr << "[Internal] Checkpoint write failed: " << m_path.string() << std::endl;
+            }
+            return false;
+        }
+
+        m_checkpoints.fetch_add(1, std::memory_order_relaxed);
+        if (announce)
+        {
+            std::cout << "[Internal] Checkpoint saved (" << library.GetCount() << " workloads)." << std::endl;
+        }
+        return true;
+    }
+
+} // namespace AdaptiveArena
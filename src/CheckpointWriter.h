@@ -0,0 +1,88 @@
+#pragma once
+
+#include "PersistenceManager.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  프로필 라이브러리를 백그라운드 스레드에서 주기적으로 저장하는 체크포인트 기록기입니다.
+     *         스냅샷 함수는 기록 스레드에서 호출되어 메모리 사본만 만들고, 파일 I/O는 어떤 아레나 잠금도 잡지 않은 채 수행합니다.
+     *         비정상 종료 시 잃는 학습 상태는 최대 한 주기입니다.
+     */
+    class CheckpointWriter
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        using Snapshot = std::function<ProfileLibrary()>;
+
+        /**
+         * @param  path      저장할 경로
+         * @param  snapshot  저장할 라이브러리 사본을 만드는 함수 (기록 스레드에서 호출)
+         * @param  interval  주기 (0이면 주기 저장 없이 요청과 정지 시에만 기록)
+         */
+        CheckpointWriter(const std::filesystem::path& path, Snapshot snapshot, std::chrono::milliseconds interval);
+        ~CheckpointWriter();
+
+        CheckpointWriter(const CheckpointWriter&) = delete;
+        CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  기록 스레드를 시작합니다 (스냅샷 대상이 완전히 생성된 뒤 호출).
+         */
+        void Start();
+
+        /**
+         * @brief  마지막 스냅샷을 기록하고 스레드를 종료합니다. 스냅샷 대상이 파괴되기 전에 호출해야 합니다 (중복 호출 무시).
+         */
+        void Stop();
+
+        /**
+         * @brief  다음 주기를 기다리지 않고 체크포인트를 요청합니다 (비차단, 기록 완료를 기다리지 않음).
+         */
+        void RequestCheckpoint();
+
+        void SetInterval(std::chrono::milliseconds interval);
+
+        /**
+         * @brief  기록 스레드 없이 호출 스레드에서 즉시 체크포인트를 기록합니다 (스레드를 시작하지 않은 소유자의 종료 시).
+         * @return bool  저장 실패 시 false
+         */
+        bool Flush() { return WriteCheckpoint(true); }
+
+        bool IsRunning() const { return m_thread.joinable(); }
+
+        uint64_t GetCheckpointCount() const { return m_checkpoints.load(std::memory_order_relaxed); }
+        uint64_t GetFailedCount() const { return m_failures.load(std::memory_order_relaxed); }
+
+    private:
+        void WriterLoop();
+        bool WriteCheckpoint(bool announce);
+
+    private:
+        std::filesystem::path m_path;
+        Snapshot m_snapshot;
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::chrono::milliseconds m_interval;   // m_mutex
+        bool m_requested;                       // m_mutex
+        bool m_stopRequested;                   // m_mutex
+        std::thread m_thread;
+
+        std::atomic<uint64_t> m_checkpoints;
+        std::atomic<uint64_t> m_failures;
+    };
+
+} // namespace AdaptiveArena
@@ -2,11 +2,22 @@
 
 #include "../include/AdaptiveArena.h"
 #include "LearningEngine.h"
+#include "AllocationProfiler.h"
+#include "AllocationTrace.h"
 #include "PersistenceManager.h"
+#include "CheckpointWriter.h"
+#include "TelemetrySampler.h"
+#include "NumaPool.h"
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstring>
 #include <mutex>
 #include <shared_mutex>
 #include <iostream>
+#include <new>
+#include <stdexcept>
 
 namespace AdaptiveArena 
 {
@@ -19,7 +30,8 @@ namespace AdaptiveArena
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Constructor and Destructor
     public:
-        explicit InternalResource(const std::string& secretKey, const std::filesystem::path& logPath, size_t hardLimit) 
+        explicit InternalResource(const std::string& secretKey, const std::filesystem::path& logPath, size_t hardLimit,
+                                  const std::string& workloadKey = kDefaultWorkloadKey) 
             : m_secretKey(secretKey)
             , m_logPath(logPath)
             , m_hardLimit(hardLimit)
@@ -27,14 +39,25 @@ namespace AdaptiveArena
             , m_peakUsage(0)
             , m_lastLatencyNS(0.0)
             , m_learningEngine(0.5) // Alpha default 0.5
+            , m_sizeClassCounts{}
+            , m_numaBinding(-1)
+            , m_checkpoints(logPath, [this]() { return SnapshotLibrary(); }, kDefaultCheckpointInterval)
+            , m_checkpointsStopped(false)
+            , m_telemetry(*this)
         {
-            // 1. 기존 세션 데이터 복원
-            size_t savedSize = 0;
-            if (PersistenceManager::Load(m_logPath, savedSize)) 
+            if (!ProfileLibrary::IsValidKey(workloadKey)) 
             {
-                m_learningEngine.SetState(savedSize);
-                std::cout << "[Internal] Session loaded. Predicted peak: " << savedSize << " bytes." << std::endl;
+                throw std::runtime_error("Workload key must be 1-31 characters.");
             }
+
+            // 1. 워크로드별 프로필 라이브러리 로드 후 선택된 키의 프로필 적용 (링 형상별 슬롯 수는 InitializeRing에서 적용)
+            if (PersistenceManager::Load(m_logPath, m_library)) 
+            {
+                std::cout << "[Internal] Profile library loaded: " << m_library.GetCount() << " workloads." << std::endl;
+            }
+            ActivateWorkload(workloadKey);
+
+            // 2. 백그라운드 체크포인트는 생성이 끝난 뒤 StartCheckpoints로 시작 (스냅샷이 가상 함수 CaptureProfile을 호출하므로)
             
             // Initial pool reservation will be dynamically handled by AdaptToJitter
             // based on the Learning Engine's predictions.
@@ -42,8 +65,9 @@ namespace AdaptiveArena
 
         virtual ~InternalResource() 
         {
-            // 세션 종료 시 마지막 통계 저장
-            SaveStatistics();
+            // 세션 종료 시 마지막 체크포인트 (파생 클래스는 자신의 소멸자에서 먼저 호출)
+            StopTelemetry();
+            StopCheckpoints();
         }
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,22 +75,46 @@ namespace AdaptiveArena
     public:
         void ResetLearning() override 
         {
+            std::lock_guard<std::mutex> libraryLock(m_libraryMutex);
             std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
-            m_learningEngine.SetState(0);
+            const uint32_t session = m_profile.sessionCount;
+            m_profile = SessionProfile{};
+            m_profile.sessionCount = session;
+            m_learningEngine.Restore(m_profile);
         }
 
         void SaveStatistics() override 
         {
-            std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
-            // 이번 세션의 피크를 학습 엔진에 반영
-            m_learningEngine.Update(m_peakUsage);
-            
-            // 파일로 저장
-            if (PersistenceManager::Save(m_logPath, m_learningEngine.GetPredictedSize())) 
+            // 비차단: 기록 스레드가 스냅샷을 만들어 저장 (학습 상태는 바꾸지 않으므로 여러 번 눌러도 EMA가 중복 반영되지 않음)
+            m_checkpoints.RequestCheckpoint();
+        }
+
+        void SwitchWorkload(const std::string& key) override 
+        {
+            if (!ProfileLibrary::IsValidKey(key)) 
+            {
+                throw std::runtime_error("Workload key must be 1-31 characters.");
+            }
+
             {
-                std::cout << "[Internal] Statistics saved. New predicted peak: " 
-                          << m_learningEngine.GetPredictedSize() << " bytes." << std::endl;
+                std::lock_guard<std::mutex> libraryLock(m_libraryMutex);
+                std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+                if (key == m_workloadKey) return;
+
+                // 나가는 모드의 학습 상태를 자기 키에 보관하고, 들어오는 모드의 상태로 교체 (결합하지 않음)
+                CaptureWorkload();
+                ActivateWorkload(key);
             }
+
+            // 링 사전 확장 등 (잠금 밖)
+            OnWorkloadActivated();
+            m_checkpoints.RequestCheckpoint();
+        }
+
+        std::string GetWorkloadKey() const override 
+        {
+            std::lock_guard<std::mutex> lock(m_libraryMutex);
+            return m_workloadKey;
         }
 
         size_t GetCurrentUsage() const override { return m_currentUsage; }
@@ -75,7 +123,206 @@ namespace AdaptiveArena
 
         double GetLastAllocationLatencyNS() const override { return m_lastLatencyNS; }
 
+        NumaTelemetry GetNumaTelemetry() const override 
+        {
+            NumaTelemetry telemetry;
+            telemetry.nodeCount = m_numaPool.GetNodeCount();
+            telemetry.localAllocations = m_numaPool.GetLocalAllocations();
+            telemetry.remoteAllocations = m_numaPool.GetRemoteAllocations();
+            telemetry.remoteBytes = m_numaPool.GetRemoteBytes();
+            return telemetry;
+        }
+
+        void CaptureTelemetry(TelemetrySnapshot& out) const override 
+        {
+            {
+                // 할당기 필드는 한 번의 공유 잠금으로 (서로 같은 시점의 값)
+                std::shared_lock<std::shared_mutex> lock(m_sharedMutex);
+                out.currentUsage = m_currentUsage;
+                out.peakUsage = m_peakUsage;
+                out.predictedBytes = m_learningEngine.GetPredictedSize();
+                out.lastAllocationLatencyNs = m_lastLatencyNS;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_libraryMutex);
+                const size_t keyLength = std::min(m_workloadKey.size(), sizeof(out.workloadKey) - 1);
+                std::memcpy(out.workloadKey, m_workloadKey.data(), keyLength);
+                out.workloadKey[keyLength] = '\0';
+            }
+            out.checkpoints = m_checkpoints.GetCheckpointCount();
+            out.numa = GetNumaTelemetry();
+        }
+
+        TelemetrySnapshot GetTelemetry() const override { return m_telemetry.GetLatest(); }
+
+        size_t GetTelemetryHistory(uint64_t afterSequence, std::vector<TelemetrySnapshot>& out) const override 
+        {
+            return m_telemetry.ReadHistory(afterSequence, out);
+        }
+
+        void SetAllocationProfiling(size_t sampleIntervalBytes) override { m_profiler.SetInterval(sampleIntervalBytes); }
+
+        size_t GetAllocationSites(std::vector<AllocationSite>& out, size_t maxSites) const override 
+        {
+            return m_profiler.GetSites(out, maxSites);
+        }
+
+        bool DumpAllocationProfile(const std::filesystem::path& path) const override { return m_profiler.Dump(path); }
+
+        void StartAllocationTrace(const std::filesystem::path& path) override { m_trace.Start(path); }
+        void StopAllocationTrace() override { m_trace.Stop(); }
+
+        size_t QueryTelemetrySeries(TelemetrySeries series, uint64_t fromNs, uint64_t toNs, size_t maxPoints, std::vector<SeriesPoint>& out) const override 
+        {
+            return m_telemetry.QuerySeries(series, fromNs, toNs, maxPoints, out);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  PMR 할당을 제공할 NUMA 노드 풀을 고정합니다 (-1이면 호출 스레드의 노드, 범위 밖이면 노드 0).
+         */
+        void SetNumaBinding(int node) { m_numaBinding = node; }
+        int GetNumaBinding() const { return m_numaBinding; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  백그라운드 체크포인트 주기를 설정합니다 (0이면 SaveStatistics 요청과 종료 시에만 저장).
+         */
+        void SetCheckpointInterval(std::chrono::milliseconds interval) { m_checkpoints.SetInterval(interval); }
+
+        /**
+         * @brief  백그라운드 체크포인트 스레드를 시작합니다 (Builder::Build가 생성 직후 호출, 직접 생성한 경우 호출자가 호출).
+         *         시작하지 않은 리소스도 소멸 시 마지막 체크포인트는 기록합니다.
+         */
+        void StartCheckpoints() { m_checkpoints.Start(); }
+        uint64_t GetCheckpointCount() const { return m_checkpoints.GetCheckpointCount(); }
+
+        static constexpr std::chrono::milliseconds kDefaultCheckpointInterval{ 30000 };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  텔레메트리 샘플러의 주기를 설정하고 (재)시작합니다 (0이면 정지, 마지막 사본과 이력은 유지).
+         */
+        void SetTelemetryRate(double hz) { m_telemetry.Start(hz); }
+        double GetTelemetryRate() const { return m_telemetry.GetRate(); }
+
     protected:
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  저장 직전에 파생 리소스가 자신의 학습 상태(링 형상 등)를 프로필에 기록합니다 (m_libraryMutex 보유 상태에서 호출).
+         *         체크포인트 스레드에서는 m_sharedMutex 없이 호출되므로 상태를 바꾸지 않고 원자적 값만 읽어야 합니다.
+         */
+        virtual void CaptureProfile(SessionProfile& profile) const { (void)profile; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  SwitchWorkload로 새 워크로드의 프로필이 적용된 직후 호출됩니다 (m_sharedMutex 미보유).
+         */
+        virtual void OnWorkloadActivated() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  현재 워크로드의 학습 상태를 m_profile에 모아 라이브러리의 자기 키에 기록합니다 (m_libraryMutex와 m_sharedMutex 보유 상태에서 호출).
+         */
+        void CaptureWorkload() 
+        {
+            // 이번 활성 구간의 피크를 학습 엔진에 반영
+            m_learningEngine.Update(m_peakUsage);
+            m_profile = BuildActiveProfile(m_learningEngine.GetPredictedSize());
+            m_library.Store(m_workloadKey, m_profile);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  활성 워크로드의 현재 학습 상태로 프로필 사본을 만듭니다 (m_libraryMutex 보유 상태에서 호출).
+         * @param  predictedBytes  기록할 예측 크기
+         */
+        SessionProfile BuildActiveProfile(uint64_t predictedBytes) const 
+        {
+            // 프로필 구성: 예측 크기, Lag 분위수, 크기 등급 분포, 링 형상 (파생 클래스)
+            SessionProfile profile = m_profile;
+            profile.predictedBytes = predictedBytes;
+            profile.jitter = m_learningEngine.GetJitterQuantiles();
+            for (size_t i = 0; i < kSizeClassCount; ++i) 
+            {
+                profile.sizeClassCounts[i] = m_sizeClassCounts[i].load(std::memory_order_relaxed);
+            }
+            CaptureProfile(profile);
+            return profile;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  체크포인트 스레드가 저장할 라이브러리 사본을 만듭니다. 복사와 CaptureProfile은 할당 경로가 잡지 않는
+         *         라이브러리 잠금 아래에서 수행하고, m_sharedMutex는 피크 사용량을 읽는 동안만 잡습니다.
+         *         이번 구간의 피크는 EMA에 반영했을 때의 값으로 기록합니다 (학습 상태는 그대로).
+         */
+        ProfileLibrary SnapshotLibrary() const 
+        {
+            std::lock_guard<std::mutex> lock(m_libraryMutex);
+
+            size_t peakUsage = 0;
+            {
+                std::shared_lock<std::shared_mutex> usageLock(m_sharedMutex);
+                peakUsage = m_peakUsage;
+            }
+
+            ProfileLibrary library = m_library;
+            library.Store(m_workloadKey, BuildActiveProfile(m_learningEngine.PreviewUpdate(peakUsage)));
+            return library;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  마지막 체크포인트를 기록하고 기록 스레드를 정지합니다 (스냅샷이 CaptureProfile을 호출하므로 파생 클래스는
+         *         자신의 멤버를 정리하기 전에 호출해야 함, 중복 호출 무시).
+         */
+        void StopCheckpoints() 
+        { 
+            // 기록 스레드가 시작되지 않았으면 (직접 생성) 마지막 체크포인트만 호출 스레드에서 기록
+            if (!m_checkpointsStopped && !m_checkpoints.IsRunning()) 
+            {
+                m_checkpoints.Flush();
+            }
+            m_checkpoints.Stop();
+            m_checkpointsStopped = true;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  텔레메트리 샘플러를 정지합니다 (샘플러가 CaptureTelemetry를 호출하므로 파생 클래스는 자신의 멤버를
+         *         정리하기 전에 호출해야 함, 중복 호출 무시).
+         */
+        void StopTelemetry() { m_telemetry.Stop(); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief  키의 프로필로 학습 상태를 교체하고 활성 구간 통계를 초기화합니다 (생성자 또는 m_libraryMutex와 m_sharedMutex 보유 상태에서 호출).
+         */
+        void ActivateWorkload(const std::string& key) 
+        {
+            m_workloadKey = key;
+            m_library.Touch(key);
+
+            const SessionProfile* stored = m_library.Find(key);
+            m_profile = stored ? *stored : SessionProfile{};
+            m_profile.sessionCount++;
+            m_learningEngine.Restore(m_profile);
+
+            m_peakUsage = m_currentUsage;
+            for (auto& count : m_sizeClassCounts) count.store(0, std::memory_order_relaxed);
+
+            if (stored) 
+            {
+                std::cout << "[Internal] Workload '" << key << "' profile applied. Predicted peak: " << m_profile.predictedBytes << " bytes, " 
+                          << m_profile.ringCount << " ring profiles (session " << m_profile.sessionCount << ")." << std::endl;
+            }
+            else if (m_library.GetCount() > 0) 
+            {
+                std::cout << "[Internal] Workload '" << key << "' has no profile yet; rings start from the nearest known geometry." << std::endl;
+            }
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /**
          * @brief  std::pmr::memory_resource 실제 할당 로직
@@ -84,12 +331,29 @@ namespace AdaptiveArena
         {
             auto start = std::chrono::high_resolution_clock::now();
 
-            // 1. 실제 할당 (업스트림: 기본 new 사용 - 테스트용)
-            void* ptr = ::operator new(bytes, std::align_val_t{alignment});
+            // 1. 실제 할당 (업스트림: 바인딩된 노드 또는 호출 스레드 노드의 Super-Page 풀)
+            void* ptr = m_numaPool.Allocate(bytes, alignment, m_numaBinding);
+            if (!ptr) 
+            {
+                throw std::bad_alloc();
+            }
+            m_sizeClassCounts[SessionProfile::SizeClassOf(bytes)].fetch_add(1, std::memory_order_relaxed);
 
             auto end = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double, std::nano>(end - start).count();
 
+            // 샘플링 프로파일러 (샘플되지 않은 할당은 스레드 로컬 카운터 감소 한 번)
+            if (AllocationProfiler::CountDown(bytes)) 
+            {
+                m_profiler.OnSampleDue(ptr, bytes);
+            }
+
+            // 할당 추적 (꺼져 있으면 relaxed 로드 한 번)
+            if (m_trace.IsActive()) 
+            {
+                m_trace.OnAllocate(ptr, bytes, alignment);
+            }
+
             if (ptr) 
             {
                 std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
@@ -114,10 +378,22 @@ namespace AdaptiveArena
         {
             if (!p) return;
 
-            // 1. 실제 해제
-            ::operator delete(p, std::align_val_t{alignment});
+            // 1. 샘플된 블록이면 추적 해제 (풀에 반환되어 다른 할당에 재사용되기 전에)
+            if (m_profiler.MayBeSampled(p)) 
+            {
+                m_profiler.OnDeallocate(p);
+            }
+
+            // 2. 추적 기록도 반환 전에 (같은 주소를 재할당한 이벤트보다 시퀀스가 앞서도록)
+            if (m_trace.IsActive()) 
+            {
+                m_trace.OnDeallocate(p, bytes, alignment);
+            }
 
-            // 2. Telemetry: 현재 사용량 감소
+            // 3. 실제 해제 (블록을 소유한 노드의 풀로 반환)
+            m_numaPool.Deallocate(p, bytes, alignment);
+
+            // 4. Telemetry: 현재 사용량 감소
             std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
             if (m_currentUsage >= bytes) 
             {
@@ -146,6 +422,29 @@ namespace AdaptiveArena
         double m_lastLatencyNS;
 
         LearningEngine m_learningEngine;
+
+        // Warm-start Profiles (워크로드 키별 라이브러리 + 활성 워크로드의 작업 사본과 크기 등급 분포)
+        // m_library/m_workloadKey/m_profile은 m_libraryMutex로 보호 (할당 경로는 잡지 않음, 둘 다 잡을 때는 m_libraryMutex가 먼저)
+        mutable std::mutex m_libraryMutex;
+        ProfileLibrary m_library;
+        std::string m_workloadKey;
+        SessionProfile m_profile;
+        std::array<std::atomic<uint64_t>, kSizeClassCount> m_sizeClassCounts;
+
+        // Sampled Allocation Profiler (기본 꺼짐)
+        AllocationProfiler m_profiler;
+
+        // Allocation Trace (기본 꺼짐, 재생 도구용)
+        AllocationTraceRecorder m_trace;
+
+        // NUMA Super-Page Pools (UMA에서는 단일 풀)
+        NumaPool m_numaPool;
+        int m_numaBinding;
+
+        // Background Persistence / Telemetry (마지막 멤버: 가장 먼저 정지)
+        CheckpointWriter m_checkpoints;
+        bool m_checkpointsStopped;
+        TelemetrySampler m_telemetry;
     };
 
 } // namespace AdaptiveArena
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "../include/AdaptiveArena.h"
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  TSC(Time Stamp Counter) 기반 저비용 시계입니다.
+     *         최초 호출 시 steady_clock 대비 주파수를 한 번 보정하고, 이후에는 RDTSC 한 번과 곱셈만 수행합니다.
+     *         같은 프로세스 안의 차이는 TSC 정밀도로 정확합니다 (Invariant TSC 전제: 모든 코어가 같은 카운터 공유).
+     *         값은 보정 시점의 steady_clock 시각에 이어 붙이므로 다른 프로세스의 값과도 같은 기준이지만,
+     *         프로세스마다 보정한 주파수가 조금씩 달라 보정 후 경과 시간에 비례하는 오차가 남습니다.
+     */
+    class TscClock
+    {
+    public:
+        /**
+         * @brief  보정된 나노초 단위 현재 시각 (steady_clock 기준점, 차이 계산용)
+         */
+        static uint64_t NowNs()
+        {
+            static const Calibration calibration = Calibrate();
+            const int64_t ticks = static_cast<int64_t>(__rdtsc() - calibration.tscBase);
+            return calibration.nsBase + static_cast<uint64_t>(static_cast<double>(ticks) * calibration.nsPerTick);
+        }
+
+    private:
+        struct Calibration
+        {
+            uint64_t tscBase;
+            uint64_t nsBase;    // tscBase 시점의 steady_clock (ns)
+            double nsPerTick;
+        };
+
+        static Calibration Calibrate()
+        {
+            // 약 2ms 동안 두 시계를 함께 진행시켜 Tick 당 나노초를 측정
+            auto wallStart = std::chrono::steady_clock::now();
+            uint64_t tscStart = __rdtsc();
+
+            auto wallEnd = wallStart;
+            while (wallEnd - wallStart < std::chrono::milliseconds(2))
+            {
+                std::this_thread::yield();
+                wallEnd = std::chrono::steady_clock::now();
+            }
+            uint64_t tscEnd = __rdtsc();
+
+            Calibration calibration;
+            double ns = std::chrono::duration<double, std::nano>(wallEnd - wallStart).count();
+            calibration.nsPerTick = (tscEnd > tscStart) ? ns / static_cast<double>(tscEnd - tscStart) : 1.0;
+            calibration.tscBase = tscEnd;
+            calibration.nsBase = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd.time_since_epoch()).count());
+            return calibration;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  HDR 방식(Log-Linear) Lock-Free 지연 히스토그램입니다.
+     *         2의 거듭제곱 구간마다 16개의 선형 하위 구간을 두어 전 범위(64-bit ns)에서 상대 오차 ~6% 이내로 기록합니다.
+     *         Record는 원자적 증가 한 번이므로 Acquire/Release 경로에서 호출해도 안전합니다.
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr uint32_t kSubBucketBits = 5;
+        static constexpr uint32_t kHalfSubBuckets = 1u << (kSubBucketBits - 1);
+        static constexpr size_t kBucketCount = (64 - kSubBucketBits + 2) * kHalfSubBuckets;
+
+        /**
+         * @brief  지연 한 건을 기록합니다 (Lock-Free).
+         */
+        void Record(uint64_t valueNs)
+        {
+            m_counts[BucketIndex(valueNs)].fetch_add(1, std::memory_order_relaxed);
+            m_totalCount.fetch_add(1, std::memory_order_relaxed);
+            m_totalNs.fetch_add(valueNs, std::memory_order_relaxed);
+
+            uint64_t max = m_maxNs.load(std::memory_order_relaxed);
+            while (valueNs > max && !m_maxNs.compare_exchange_weak(max, valueNs, std::memory_order_relaxed)) {}
+        }
+
+        /**
+         * @brief  P50/P99/P99.9/Max 요약을 계산합니다 (기록과 동시에 호출 가능, 근사 스냅샷).
+         */
+        LatencyPercentiles Summarize() const
+        {
+            LatencyPercentiles result;
+            result.samples = m_totalCount.load(std::memory_order_relaxed);
+            if (result.samples == 0) return result;
+
+            const double targets[3] = { 0.50, 0.99, 0.999 };
+            double* outputs[3] = { &result.p50Us, &result.p99Us, &result.p999Us };
+
+            // 각 백분위의 순위 (최소 1번째 샘플)
+            uint64_t ranks[3];
+            for (size_t k = 0; k < 3; ++k)
+            {
+                ranks[k] = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(targets[k] * static_cast<double>(result.samples))));
+            }
+
+            uint64_t seen = 0;
+            size_t next = 0;
+            for (size_t i = 0; i < kBucketCount && next < 3; ++i)
+            {
+                seen += m_counts[i].load(std::memory_order_relaxed);
+                while (next < 3 && seen >= ranks[next])
+                {
+                    *outputs[next++] = static_cast<double>(BucketMidpoint(i)) / 1000.0;
+                }
+            }
+
+            result.maxUs = static_cast<double>(m_maxNs.load(std::memory_order_relaxed)) / 1000.0;
+            result.meanUs = static_cast<double>(m_totalNs.load(std::memory_order_relaxed)) / static_cast<double>(result.samples) / 1000.0;
+
+            // 구간 중앙값 근사가 실제 최대값을 넘지 않도록 보정
+            result.p50Us = std::min(result.p50Us, result.maxUs);
+            result.p99Us = std::min(result.p99Us, result.maxUs);
+            result.p999Us = std::min(result.p999Us, result.maxUs);
+            return result;
+        }
+
+        /**
+         * @brief  다른 히스토그램의 기록을 더합니다 (스레드별로 따로 기록한 뒤 합산할 때, 경합 없는 기록용).
+         */
+        void Merge(const LatencyHistogram& other)
+        {
+            for (size_t i = 0; i < kBucketCount; ++i)
+            {
+                m_counts[i].fetch_add(other.m_counts[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            m_totalCount.fetch_add(other.m_totalCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_totalNs.fetch_add(other.m_totalNs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            const uint64_t otherMax = other.m_maxNs.load(std::memory_order_relaxed);
+            uint64_t max = m_maxNs.load(std::memory_order_relaxed);
+            while (otherMax > max && !m_maxNs.compare_exchange_weak(max, otherMax, std::memory_order_relaxed)) {}
+        }
+
+        void Reset()
+        {
+            for (auto& count : m_counts) count.store(0, std::memory_order_relaxed);
+            m_totalCount.store(0, std::memory_order_relaxed);
+            m_totalNs.store(0, std::memory_order_relaxed);
+            m_maxNs.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        static size_t BucketIndex(uint64_t value)
+        {
+            if (value < (1ull << kSubBucketBits)) return static_cast<size_t>(value);
+
+            uint32_t msb = 63;
+            while (!(value >> msb)) --msb;
+
+            // 최상위 kSubBucketBits 비트가 하위 구간을 결정
+            uint64_t mantissa = value >> (msb - kSubBucketBits + 1);
+            return static_cast<size_t>((msb - kSubBucketBits + 2) * kHalfSubBuckets + (mantissa - kHalfSubBuckets));
+        }
+
+        static uint64_t BucketMidpoint(size_t index)
+        {
+            if (index < (1ull << kSubBucketBits)) return index;
+
+            uint32_t msb = static_cast<uint32_t>(index / kHalfSubBuckets) + kSubBucketBits - 2;
+            uint64_t mantissa = index % kHalfSubBuckets + kHalfSubBuckets;
+            uint32_t shift = msb - kSubBucketBits + 1;
+            return (mantissa << shift) + ((1ull << shift) >> 1);
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, kBucketCount> m_counts{};
+        std::atomic<uint64_t> m_totalCount{0};
+        std::atomic<uint64_t> m_totalNs{0};
+        std::atomic<uint64_t> m_maxNs{0};
+    };
+
+} // namespace AdaptiveArena
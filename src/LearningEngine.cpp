@@ -9,6 +9,8 @@ namespace AdaptiveArena
         : m_alpha(std::clamp(alpha, 0.0, 1.0))
         , m_predictedSize(0)
         , m_predictedSlots(4) // 최소 4개 슬롯에서 시작
+        , m_predictedScratch(0)
+        , m_lagHistogram{}
     {
         // 초기화 시 예측값은 0으로 시작
     }
@@ -16,17 +18,21 @@ namespace AdaptiveArena
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Update
     void LearningEngine::Update(size_t currentPeak) 
+    {
+        m_predictedSize = PreviewUpdate(currentPeak);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PreviewUpdate
+    size_t LearningEngine::PreviewUpdate(size_t currentPeak) const 
     {
         // 지수 이동 평균 수식 적용: S_next = α * P_current + (1 - α) * S_current
         // 데이터가 처음 들어올 때는 현재 피크값을 그대로 초기값으로 사용
         if (m_predictedSize == 0) 
         {
-            m_predictedSize = currentPeak;
-        }
-        else 
-        {
-            m_predictedSize = static_cast<size_t>(m_alpha * currentPeak + (1.0 - m_alpha) * m_predictedSize);
+            return currentPeak;
         }
+        return static_cast<size_t>(m_alpha * currentPeak + (1.0 - m_alpha) * m_predictedSize);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,8 +47,7 @@ namespace AdaptiveArena
     void LearningEngine::SetState(size_t size) 
     {
         m_predictedSize = size;
-        // 슬롯 수는 세션 피크 메모리로부터 유추하거나 별도 저장 가능하지만,
-        // 여기서는 단순함을 위해 사이즈에 비례하거나 기본값을 유지합니다.
+        // 슬롯 수는 링 형상마다 다르므로 InitializeRing 시점에 RestoreSlotCount로 복원합니다.
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,16 +57,119 @@ namespace AdaptiveArena
         // 지터 대응 EMA: 지격(Lag)의 피크를 학습
         // 슬롯 개수는 정수여야 하므로 반올림 또는 올림 처리
         // 예측 슬롯 = α * 현재지격 + (1 - α) * 이전예측
-        double nextSlots = m_alpha * static_cast<double>(currentLag) + (1.0 - m_alpha) * static_cast<double>(m_predictedSlots);
+        double nextSlots = m_alpha * static_cast<double>(currentLag) + (1.0 - m_alpha) * static_cast<double>(m_predictedSlots.load(std::memory_order_relaxed));
         
-        m_predictedSlots = std::max(size_t(4), static_cast<size_t>(nextSlots + 0.5));
+        m_predictedSlots.store(std::max(size_t(4), static_cast<size_t>(nextSlots + 0.5)), std::memory_order_relaxed);
+
+        // 단일 Writer이므로 RMW 없이 load + store
+        auto& bin = m_lagHistogram[std::min(currentLag, kLagBins)];
+        bin.store(bin.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // GetPredictedSlotCount
     size_t LearningEngine::GetPredictedSlotCount() const 
     {
-        return m_predictedSlots;
+        return m_predictedSlots.load(std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // UpdateScratch
+    void LearningEngine::UpdateScratch(size_t framePeak) 
+    {
+        // 피크 추종: 부족한 쪽의 비용(힙 할당)이 남는 쪽의 비용(슬롯당 여분 메모리)보다 크므로 증가는 즉시 반영
+        const size_t predicted = m_predictedScratch.load(std::memory_order_relaxed);
+        if (framePeak >= predicted) 
+        {
+            m_predictedScratch.store(framePeak, std::memory_order_relaxed);
+        }
+        else 
+        {
+            m_predictedScratch.store(static_cast<size_t>(m_alpha * framePeak + (1.0 - m_alpha) * predicted), std::memory_order_relaxed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetPredictedScratchSize
+    size_t LearningEngine::GetPredictedScratchSize() const 
+    {
+        const size_t predicted = m_predictedScratch.load(std::memory_order_relaxed);
+        return predicted + predicted / 4;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Restore
+    void LearningEngine::Restore(const SessionProfile& profile) 
+    {
+        m_predictedSize = static_cast<size_t>(profile.predictedBytes);
+        m_predictedSlots.store(4, std::memory_order_relaxed);
+        m_predictedScratch.store(0, std::memory_order_relaxed);
+        for (auto& bin : m_lagHistogram) bin.store(0, std::memory_order_relaxed);
+        m_restoredJitter = JitterQuantiles{};
+        SetJitterState(profile.jitter);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RestoreSlotCount
+    void LearningEngine::RestoreSlotCount(size_t slots) 
+    {
+        m_predictedSlots.store(std::max(size_t(4), slots), std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetJitterState
+    void LearningEngine::SetJitterState(const JitterQuantiles& jitter) 
+    {
+        m_restoredJitter = jitter;
+        if (jitter.samples > 0) 
+        {
+            m_predictedSlots.store(std::max(m_predictedSlots.load(std::memory_order_relaxed), static_cast<size_t>(jitter.p99) + 1), std::memory_order_relaxed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetJitterQuantiles
+    JitterQuantiles LearningEngine::GetJitterQuantiles() const 
+    {
+        // 1. 이번 세션의 분위수 (Producer가 갱신 중일 수 있으므로 사본의 합을 표본 수로 사용)
+        std::array<uint64_t, kLagBins + 1> histogram;
+        uint64_t samples = 0;
+        for (size_t lag = 0; lag <= kLagBins; ++lag) 
+        {
+            histogram[lag] = m_lagHistogram[lag].load(std::memory_order_relaxed);
+            samples += histogram[lag];
+        }
+        if (samples == 0) return m_restoredJitter;
+
+        JitterQuantiles session;
+        session.samples = samples;
+        const uint64_t targets[3] = { (samples * 50 + 99) / 100, (samples * 90 + 99) / 100, (samples * 99 + 99) / 100 };
+        uint32_t* outputs[3] = { &session.p50, &session.p90, &session.p99 };
+
+        uint64_t cumulative = 0;
+        size_t next = 0;
+        for (size_t lag = 0; lag <= kLagBins; ++lag) 
+        {
+            if (histogram[lag] == 0) continue;
+            cumulative += histogram[lag];
+            while (next < 3 && cumulative >= targets[next]) *outputs[next++] = static_cast<uint32_t>(lag);
+            session.max = static_cast<uint32_t>(lag);
+        }
+
+        // 2. 이전 세션과 EMA 결합 (최대값은 둘 중 큰 값)
+        if (m_restoredJitter.samples == 0) return session;
+
+        auto blend = [this](uint32_t current, uint32_t previous) 
+        {
+            return static_cast<uint32_t>(m_alpha * current + (1.0 - m_alpha) * previous + 0.5);
+        };
+        JitterQuantiles blended;
+        blended.p50 = blend(session.p50, m_restoredJitter.p50);
+        blended.p90 = blend(session.p90, m_restoredJitter.p90);
+        blended.p99 = blend(session.p99, m_restoredJitter.p99);
+        blended.max = std::max(session.max, m_restoredJitter.max);
+        blended.samples = session.samples + m_restoredJitter.samples;
+        return blended;
     }
 
 } // namespace AdaptiveArena
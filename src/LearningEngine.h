@@ -1,6 +1,10 @@
 #pragma once
 
+#include "PersistenceManager.h"
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 
 namespace AdaptiveArena 
 {
@@ -29,6 +33,11 @@ namespace AdaptiveArena
          */
         void Update(size_t currentPeak);
 
+        /**
+         * @brief  Update(currentPeak)를 적용했을 때의 예측값을 반환합니다 (상태는 바꾸지 않음, 체크포인트용).
+         */
+        size_t PreviewUpdate(size_t currentPeak) const;
+
         /**
          * @brief  학습된 예측 풀 크기를 반환합니다.
          * @return size_t  다음 세션에서 예약할 권장 메모리 크기
@@ -53,10 +62,59 @@ namespace AdaptiveArena
          */
         size_t GetPredictedSlotCount() const;
 
+        /**
+         * @brief  슬롯이 재사용될 때 직전 프레임이 사용한 스크래치 바이트를 입력받아 권장 스크래치 크기를 업데이트합니다.
+         *         피크가 예측보다 크면 즉시 따라가고, 작으면 EMA로 천천히 줄입니다 (초과 할당은 상류 힙으로 넘어가므로).
+         * @param  framePeak  프레임 하나가 사용한 스크래치 바이트
+         */
+        void UpdateScratch(size_t framePeak);
+
+        /**
+         * @brief  학습된 슬롯당 권장 스크래치 크기를 반환합니다 (여유분 25% 포함, 학습 전이면 0).
+         */
+        size_t GetPredictedScratchSize() const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Warm Start (SessionProfile)
+    public:
+        /**
+         * @brief  학습 상태 전체를 프로필의 값으로 교체합니다 (이번 세션의 관측은 버림, 결합하지 않음).
+         *         워크로드 전환 시 이전 모드의 EMA가 새 모드로 넘어가지 않도록 사용합니다.
+         */
+        void Restore(const SessionProfile& profile);
+
+        /**
+         * @brief  저장된 링 형상의 슬롯 수를 복원합니다 (최소 4).
+         */
+        void RestoreSlotCount(size_t slots);
+
+        /**
+         * @brief  스크래치 피크 학습값을 설정/조회합니다 (GetPredictedScratchSize와 달리 여유분 제외).
+         */
+        void SetScratchState(size_t peak) { m_predictedScratch.store(peak, std::memory_order_relaxed); }
+        size_t GetScratchState() const { return m_predictedScratch.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  이전 세션의 Lag 분위수를 복원합니다. 형상이 일치하는 링 프로필이 없을 때 p99 + 1 슬롯을 초기 권장값으로 사용합니다.
+         */
+        void SetJitterState(const JitterQuantiles& jitter);
+
+        /**
+         * @brief  이번 세션에 관측한 Lag 분위수를 복원된 값과 EMA로 결합하여 반환합니다 (관측이 없으면 복원된 값).
+         */
+        JitterQuantiles GetJitterQuantiles() const;
+
     private:
         double m_alpha;
         size_t m_predictedSize;
-        size_t m_predictedSlots;
+        // Producer 스레드가 잠금 없이 갱신하는 상태 (단일 Writer, relaxed). 체크포인트 스레드는 잠금 없이 읽음
+        std::atomic<size_t> m_predictedSlots;
+        std::atomic<size_t> m_predictedScratch;
+
+        // Lag 분포 (UpdateJitter마다 기록, 마지막 칸은 kLagBins 이상)
+        static constexpr size_t kLagBins = 1024;
+        std::array<std::atomic<uint64_t>, kLagBins + 1> m_lagHistogram;
+        JitterQuantiles m_restoredJitter;
     };
 
 } // namespace AdaptiveArena
@@ -0,0 +1,318 @@
+#define NOMINMAX
+#include "NumaPool.h"
+#include "NumaTopology.h"
+#include <windows.h>
+#include <algorithm>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    NumaPool::NumaPool()
+        : m_pageRoot(std::make_unique<std::atomic<PageLeaf*>[]>(size_t(1) << kPageRootBits))
+        , m_localAllocations(0)
+        , m_remoteAllocations(0)
+        , m_remoteBytes(0)
+    {
+        size_t nodeCount = std::max<size_t>(NumaTopology::GetNodeCount(), 1);
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            m_nodes.push_back(std::make_unique<NodePool>());
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    NumaPool::~NumaPool()
+    {
+        for (const auto& region : m_regions)
+        {
+            VirtualFree(reinterpret_cast<void*>(region.first), 0, MEM_RELEASE);
+        }
+        for (const auto& pool : m_nodes)
+        {
+            for (const auto& page : pool->pages)
+            {
+                VirtualFree(page->base, 0, MEM_RELEASE);
+            }
+        }
+        for (size_t i = 0; i < (size_t(1) << kPageRootBits); ++i)
+        {
+            delete m_pageRoot[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Allocate
+    void* NumaPool::Allocate(size_t bytes, size_t alignment, int node)
+    {
+        if (bytes == 0) bytes = 1;
+
+        const int callerNode = GetCallerNode();
+        const int target = ResolveNode(node < 0 ? callerNode : node);
+
+        // 1. 대형 요청: 노드 메모리에 직접 할당 (페이지 정렬)
+        size_t classIndex = ClassIndex(bytes, alignment);
+        void* ptr = nullptr;
+        if (classIndex >= kClassCount)
+        {
+            ptr = AllocateRegion(bytes, alignment, target);
+        }
+        else
+        {
+            // 2. 크기 등급: Free List → 현재 Super-Page → 빈 Super-Page 재사용 → 새 Super-Page 순
+            const size_t blockSize = size_t(1) << (classIndex + kMinClassShift);
+            NodePool& pool = *m_nodes[target];
+            std::lock_guard<std::mutex> lock(pool.mutex);
+
+            auto& freeList = pool.freeLists[classIndex];
+            if (!freeList.empty())
+            {
+                ptr = freeList.back();
+                freeList.pop_back();
+
+                SuperPage* page = FindPage(ptr);
+                if (page->liveBlocks++ == 0 && page != pool.current)
+                {
+                    --pool.emptyPages;
+                }
+            }
+            else
+            {
+                const size_t blockAlign = std::min(blockSize, kMaxPooledAlignment);
+                size_t padding = (blockAlign - (reinterpret_cast<uintptr_t>(pool.cursor) & (blockAlign - 1))) & (blockAlign - 1);
+                if (!pool.cursor || pool.remaining < padding + blockSize)
+                {
+                    // 남은 조각은 버림 (페이지의 블록이 모두 돌아오면 페이지째 회수)
+                    padding = 0;
+                    if (!NextPage(pool, target))
+                    {
+                        return nullptr;
+                    }
+                }
+                ptr = pool.cursor + padding;
+                pool.cursor += padding + blockSize;
+                pool.remaining -= padding + blockSize;
+                pool.current->liveBlocks++;
+            }
+        }
+
+        if (ptr)
+        {
+            if (target == callerNode || m_nodes.size() == 1)
+            {
+                m_localAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                m_remoteAllocations.fetch_add(1, std::memory_order_relaxed);
+                m_remoteBytes.fetch_add(bytes, std::memory_order_relaxed);
+            }
+        }
+        return ptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Deallocate
+    void NumaPool::Deallocate(void* p, size_t bytes, size_t alignment)
+    {
+        if (!p) return;
+        if (bytes == 0) bytes = 1;
+
+        size_t classIndex = ClassIndex(bytes, alignment);
+        if (classIndex >= kClassCount)
+        {
+            {
+                std::unique_lock<std::shared_mutex> lock(m_regionMutex);
+                m_regions.erase(reinterpret_cast<uintptr_t>(p));
+            }
+            VirtualFree(p, 0, MEM_RELEASE);
+            return;
+        }
+
+        // 해제한 스레드가 아니라 블록을 소유한 노드의 풀로 반환 (노드 간 메모리 이동 방지)
+        // 살아 있는 블록이 있는 동안 페이지는 회수되지 않으므로 잠금 없이 조회
+        SuperPage* page = FindPage(p);
+        if (!page) return;
+
+        NodePool& pool = *m_nodes[page->node];
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.freeLists[classIndex].push_back(p);
+
+        // 빈 페이지가 쌓이면 그 블록들을 Free List에서 걷어내고 남는 페이지는 OS에 반환
+        if (--page->liveBlocks == 0 && page != pool.current && ++pool.emptyPages > kMaxEmptyPages)
+        {
+            CollectEmptyPages(pool);
+            ReleaseSpares(pool, kRetainedSparePages);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ClassIndex
+    size_t NumaPool::ClassIndex(size_t bytes, size_t alignment)
+    {
+        if (alignment > kMaxPooledAlignment) return kClassCount;
+
+        size_t size = std::max(bytes, alignment);
+        size_t shift = kMinClassShift;
+        while ((size_t(1) << shift) < size && shift <= kMaxClassShift)
+        {
+            ++shift;
+        }
+        return shift - kMinClassShift;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ResolveNode
+    int NumaPool::ResolveNode(int node) const
+    {
+        return (node >= 0 && static_cast<size_t>(node) < m_nodes.size()) ? node : 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetCallerNode
+    int NumaPool::GetCallerNode() const
+    {
+        if (m_nodes.size() == 1) return 0;
+
+        // 프로세서 → 노드 조회는 할당마다 하지 않고 스레드별로 캐시 (스레드가 옮겨갈 수 있으므로 주기적으로 갱신)
+        thread_local int cachedNode = -1;
+        thread_local uint32_t uses = 0;
+        if (cachedNode < 0 || ++uses >= kNodeRefreshInterval)
+        {
+            cachedNode = NumaTopology::GetCurrentNode();
+            uses = 0;
+        }
+        return cachedNode;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FindPage
+    NumaPool::SuperPage* NumaPool::FindPage(const void* p) const
+    {
+        // Super-Page는 4MB 정렬이므로 주소의 상위 비트가 곧 페이지 번호
+        const uintptr_t number = reinterpret_cast<uintptr_t>(p) >> kSuperPageShift;
+        const uintptr_t root = number >> kPageLeafBits;
+        if (root >= (uintptr_t(1) << kPageRootBits)) return nullptr;
+
+        const PageLeaf* leaf = m_pageRoot[root].load(std::memory_order_acquire);
+        return leaf ? (*leaf)[number & ((uintptr_t(1) << kPageLeafBits) - 1)].load(std::memory_order_acquire) : nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AllocateRegion
+    void* NumaPool::AllocateRegion(size_t bytes, size_t alignment, int node)
+    {
+        // 단일 노드(UMA)에서는 노드 지정 없이 할당
+        // OS 할당은 할당 단위(64KB) 경계까지만 정렬되므로, 더 큰 정렬은 정렬된 주소를 예약해 할당
+        const int regionNode = m_nodes.size() > 1 ? node : NumaTopology::kAnyNode;
+        void* region = alignment > kMaxPooledAlignment 
+            ? NumaTopology::AllocateAlignedOnNode(bytes, alignment, regionNode) 
+            : NumaTopology::AllocateOnNode(bytes, regionNode);
+        if (region)
+        {
+            std::unique_lock<std::shared_mutex> lock(m_regionMutex);
+            m_regions.emplace(reinterpret_cast<uintptr_t>(region), std::make_pair(bytes, node));
+        }
+        return region;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // NextPage
+    bool NumaPool::NextPage(NodePool& pool, int node)
+    {
+        // 1. 다 쓴 페이지: 블록이 모두 돌아와 있으면 빈 페이지로 집계
+        if (pool.current && pool.current->liveBlocks == 0)
+        {
+            ++pool.emptyPages;
+        }
+        pool.current = nullptr;
+        pool.cursor = nullptr;
+        pool.remaining = 0;
+
+        // 2. 빈 페이지를 통째로 다시 잘라 씀 (다른 크기 등급으로 재사용 = 페이지 단위 병합)
+        if (pool.spares.empty() && pool.emptyPages > 0)
+        {
+            CollectEmptyPages(pool);
+        }
+
+        SuperPage* page = nullptr;
+        if (!pool.spares.empty())
+        {
+            page = pool.spares.back();
+            pool.spares.pop_back();
+        }
+        else
+        {
+            // 3. 새 Super-Page (4MB 정렬, 단일 노드에서는 노드 지정 없이)
+            void* base = NumaTopology::AllocateAlignedOnNode(kSuperPageSize, kSuperPageSize, m_nodes.size() > 1 ? node : NumaTopology::kAnyNode);
+            if (!base) return false;
+
+            auto owned = std::make_unique<SuperPage>();
+            owned->base = static_cast<uint8_t*>(base);
+            owned->node = node;
+            page = owned.get();
+            pool.pages.push_back(std::move(owned));
+
+            const uintptr_t number = reinterpret_cast<uintptr_t>(base) >> kSuperPageShift;
+            std::atomic<PageLeaf*>& root = m_pageRoot[number >> kPageLeafBits];
+            if (!root.load(std::memory_order_acquire))
+            {
+                std::unique_lock<std::shared_mutex> lock(m_regionMutex);
+                if (!root.load(std::memory_order_relaxed)) root.store(new PageLeaf(), std::memory_order_release);
+            }
+            (*root.load(std::memory_order_acquire))[number & ((uintptr_t(1) << kPageLeafBits) - 1)].store(page, std::memory_order_release);
+        }
+
+        pool.current = page;
+        pool.cursor = page->base;
+        pool.remaining = kSuperPageSize;
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CollectEmptyPages
+    void NumaPool::CollectEmptyPages(NodePool& pool)
+    {
+        // 블록이 모두 돌아온 페이지의 블록을 Free List에서 걷어냄 (노드 mutex 보유 상태)
+        for (auto& freeList : pool.freeLists)
+        {
+            freeList.erase(std::remove_if(freeList.begin(), freeList.end(), [&](void* block)
+            {
+                const SuperPage* page = FindPage(block);
+                return page->liveBlocks == 0 && page != pool.current;
+            }), freeList.end());
+        }
+
+        for (const auto& page : pool.pages)
+        {
+            if (page->liveBlocks == 0 && page.get() != pool.current && 
+                std::find(pool.spares.begin(), pool.spares.end(), page.get()) == pool.spares.end())
+            {
+                pool.spares.push_back(page.get());
+            }
+        }
+        pool.emptyPages = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReleaseSpares
+    void NumaPool::ReleaseSpares(NodePool& pool, size_t keep)
+    {
+        while (pool.spares.size() > keep)
+        {
+            SuperPage* page = pool.spares.back();
+            pool.spares.pop_back();
+
+            const uintptr_t number = reinterpret_cast<uintptr_t>(page->base) >> kSuperPageShift;
+            (*m_pageRoot[number >> kPageLeafBits].load(std::memory_order_acquire))[number & ((uintptr_t(1) << kPageLeafBits) - 1)].store(nullptr, std::memory_order_release);
+            VirtualFree(page->base, 0, MEM_RELEASE);
+
+            pool.pages.erase(std::find_if(pool.pages.begin(), pool.pages.end(), [&](const std::unique_ptr<SuperPage>& owned) 
+            { 
+                return owned.get() == page; 
+            }));
+        }
+    }
+
+} // namespace AdaptiveArena
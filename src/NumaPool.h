@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  NUMA 노드별 Super-Page 풀입니다.
+     *         각 노드는 자기 노드 메모리에서 할당한 Super-Page(4MB, 4MB 정렬)를 크기 등급(64B ~ 1MB, 2의 거듭제곱)별로 잘라 쓰며,
+     *         해제된 블록은 소유 노드의 Free List로 돌아갑니다. 1MB를 넘는 요청은 노드 지정 할당으로 직접 처리합니다.
+     *         블록이 모두 돌아온 Super-Page는 Free List에서 걷어내어 새 등급으로 다시 잘라 쓰거나 OS에 반환합니다.
+     *         UMA 시스템에서는 노드 0 하나의 풀로 동작합니다.
+     */
+    class NumaPool
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        NumaPool();
+        ~NumaPool();
+
+        NumaPool(const NumaPool&) = delete;
+        NumaPool& operator=(const NumaPool&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @param  node  할당할 노드 (음수이면 호출 스레드가 실행 중인 노드)
+         * @return void* 실패 시 nullptr
+         */
+        void* Allocate(size_t bytes, size_t alignment, int node);
+        void Deallocate(void* p, size_t bytes, size_t alignment);
+
+        size_t GetNodeCount() const { return m_nodes.size(); }
+        uint64_t GetLocalAllocations() const { return m_localAllocations.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  호출 스레드의 노드와 다른 노드 풀에서 제공된 할당 (Interconnect 너머의 메모리)
+         */
+        uint64_t GetRemoteAllocations() const { return m_remoteAllocations.load(std::memory_order_relaxed); }
+        uint64_t GetRemoteBytes() const { return m_remoteBytes.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr size_t kSuperPageShift = 22;  // 4MB
+        static constexpr size_t kSuperPageSize = size_t(1) << kSuperPageShift;
+        static constexpr size_t kMinClassShift = 6;    // 64B
+        static constexpr size_t kMaxClassShift = 20;   // 1MB
+        static constexpr size_t kClassCount = kMaxClassShift - kMinClassShift + 1;
+        static constexpr size_t kMaxPooledAlignment = 4096;
+        static constexpr size_t kMaxEmptyPages = 2;       // 이보다 많은 빈 Super-Page가 Free List에 흩어지면 회수
+        static constexpr size_t kRetainedSparePages = 1;  // 회수 후 OS에 돌려주지 않고 남겨 둘 빈 Super-Page
+        static constexpr uint32_t kNodeRefreshInterval = 1024;   // 스레드별 노드 캐시를 다시 조회하는 할당 횟수
+
+        // Super-Page 주소 → 페이지 (2단계 Radix, 48비트 사용자 주소 공간)
+        static constexpr size_t kPageLeafBits = 12;
+        static constexpr size_t kPageRootBits = 48 - kSuperPageShift - kPageLeafBits;
+
+        struct SuperPage
+        {
+            uint8_t* base = nullptr;
+            int node = 0;
+            size_t liveBlocks = 0;         // 할당되어 나간 블록 수 (노드 mutex)
+        };
+        using PageLeaf = std::array<std::atomic<SuperPage*>, size_t(1) << kPageLeafBits>;
+
+        struct NodePool
+        {
+            std::mutex mutex;
+            std::array<std::vector<void*>, kClassCount> freeLists;
+            std::vector<std::unique_ptr<SuperPage>> pages;
+            std::vector<SuperPage*> spares;   // 블록이 모두 돌아와 Free List에서 걷어낸 페이지
+            SuperPage* current = nullptr;     // 현재 잘라 쓰는 페이지
+            uint8_t* cursor = nullptr;        // 현재 Super-Page의 미사용 영역
+            size_t remaining = 0;
+            size_t emptyPages = 0;            // 블록이 모두 돌아왔지만 아직 Free List에 남은 페이지 (current 제외)
+        };
+
+        static size_t ClassIndex(size_t bytes, size_t alignment);
+        int ResolveNode(int node) const;
+        int GetCallerNode() const;
+        SuperPage* FindPage(const void* p) const;
+        void* AllocateRegion(size_t bytes, size_t alignment, int node);
+        bool NextPage(NodePool& pool, int node);
+        void CollectEmptyPages(NodePool& pool);
+        void ReleaseSpares(NodePool& pool, size_t keep);
+
+    private:
+        std::vector<std::unique_ptr<NodePool>> m_nodes;
+        std::unique_ptr<std::atomic<PageLeaf*>[]> m_pageRoot;
+
+        // 1MB를 넘는 대형 할당의 주소 → (크기, 소유 노드)
+        mutable std::shared_mutex m_regionMutex;
+        std::map<uintptr_t, std::pair<size_t, int>> m_regions;
+
+        std::atomic<uint64_t> m_localAllocations;
+        std::atomic<uint64_t> m_remoteAllocations;
+        std::atomic<uint64_t> m_remoteBytes;
+    };
+
+} // namespace AdaptiveArena
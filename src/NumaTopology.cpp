@@ -0,0 +1,150 @@
+#define NOMINMAX
+#include "NumaTopology.h"
+#include <windows.h>
+#include <bitset>
+#include <cstdint>
+#include <iostream>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetNodeCount
+    size_t NumaTopology::GetNodeCount()
+    {
+        ULONG highest = 0;
+        if (!GetNumaHighestNodeNumber(&highest))
+        {
+            return 1;
+        }
+        return static_cast<size_t>(highest) + 1;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetCurrentNode
+    int NumaTopology::GetCurrentNode()
+    {
+        PROCESSOR_NUMBER processor{};
+        GetCurrentProcessorNumberEx(&processor);
+
+        USHORT node = 0;
+        if (!GetNumaProcessorNodeEx(&processor, &node))
+        {
+            return 0;
+        }
+        return static_cast<int>(node);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetNodeProcessorCount
+    size_t NumaTopology::GetNodeProcessorCount(int node)
+    {
+        GROUP_AFFINITY affinity{};
+        if (node < 0 || !GetNumaNodeProcessorMaskEx(static_cast<USHORT>(node), &affinity))
+        {
+            return 1;
+        }
+        return std::bitset<sizeof(KAFFINITY) * 8>(static_cast<unsigned long long>(affinity.Mask)).count();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PinCurrentThreadToNode
+    bool NumaTopology::PinCurrentThreadToNode(int node)
+    {
+        GROUP_AFFINITY affinity{};
+        if (node < 0 || !GetNumaNodeProcessorMaskEx(static_cast<USHORT>(node), &affinity) || affinity.Mask == 0)
+        {
+            return false;
+        }
+        return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != FALSE;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AllocateOnNode
+    void* NumaTopology::AllocateOnNode(size_t size, int node, void* address)
+    {
+        auto commit = [&](DWORD type) -> void*
+        {
+            if (node < 0)
+            {
+                return VirtualAlloc(address, size, type, PAGE_READWRITE);
+            }
+            return VirtualAllocExNuma(GetCurrentProcess(), address, size, type, PAGE_READWRITE, static_cast<DWORD>(node));
+        };
+
+        // 1. Large Page: TLB 항목 하나가 2MB를 덮음 (항상 상주, 크기/주소가 Large Page 배수일 때만)
+        const size_t largePage = GetLargePageSize();
+        if (largePage > 0 && size % largePage == 0 && reinterpret_cast<uintptr_t>(address) % largePage == 0)
+        {
+            if (void* region = commit(MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES))
+            {
+                return region;
+            }
+        }
+
+        // 2. Fallback: 일반 4KB 페이지 (물리 메모리가 조각나 Large Page를 모을 수 없을 때도 여기로)
+        return commit(MEM_COMMIT | MEM_RESERVE);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AllocateAlignedOnNode
+    void* NumaTopology::AllocateAlignedOnNode(size_t size, size_t alignment, int node)
+    {
+        // 정렬 여유를 포함해 주소 공간만 예약한 뒤 해제하고, 정렬된 주소에 실제로 할당 (그 사이 다른 스레드가 차지하면 재시도)
+        for (int attempt = 0; attempt < 8; ++attempt)
+        {
+            void* probe = VirtualAlloc(NULL, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+            if (!probe)
+            {
+                return nullptr;
+            }
+            const uintptr_t aligned = (reinterpret_cast<uintptr_t>(probe) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            VirtualFree(probe, 0, MEM_RELEASE);
+
+            if (void* region = AllocateOnNode(size, node, reinterpret_cast<void*>(aligned)))
+            {
+                return region;
+            }
+        }
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetLargePageSize
+    size_t NumaTopology::GetLargePageSize()
+    {
+        // 프로세스 토큰의 권한은 한 번만 조정 (Lock Pages in Memory 권한이 계정에 부여되어 있어야 함)
+        static const size_t largePage = []() -> size_t
+        {
+            const SIZE_T minimum = GetLargePageMinimum();
+            if (minimum == 0)
+            {
+                return 0;
+            }
+
+            HANDLE token = NULL;
+            if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+            {
+                return 0;
+            }
+
+            TOKEN_PRIVILEGES privileges{};
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+            // AdjustTokenPrivileges는 권한이 없어도 성공하고 ERROR_NOT_ALL_ASSIGNED를 남김
+            const bool enabled = LookupPrivilegeValueW(NULL, L"SeLockMemoryPrivilege", &privileges.Privileges[0].Luid) &&
+                                 AdjustTokenPrivileges(token, FALSE, &privileges, 0, NULL, NULL) && 
+                                 GetLastError() == ERROR_SUCCESS;
+            CloseHandle(token);
+
+            if (!enabled)
+            {
+                std::cout << "[AdaptiveArena] SeLockMemoryPrivilege not held. Super-pages use 4KB pages." << std::endl;
+                return 0;
+            }
+            return static_cast<size_t>(minimum);
+        }();
+        return largePage;
+    }
+
+} // namespace AdaptiveArena
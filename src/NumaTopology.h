@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  NUMA 노드 조회, 스레드 고정, 노드 지정 할당을 위한 얇은 Win32 래퍼입니다.
+     *         UMA 시스템에서는 노드 0 하나만 존재하는 것으로 보고합니다.
+     */
+    class NumaTopology
+    {
+    public:
+        static constexpr int kAnyNode = -1;
+
+        static size_t GetNodeCount();
+
+        /**
+         * @brief  호출 스레드가 현재 실행 중인 프로세서의 NUMA 노드
+         */
+        static int GetCurrentNode();
+
+        /**
+         * @brief  노드에 속한 논리 프로세서 수
+         */
+        static size_t GetNodeProcessorCount(int node);
+
+        /**
+         * @brief  호출 스레드를 노드의 프로세서 집합으로 고정합니다.
+         * @return bool  실패하거나 노드가 잘못되면 false (스레드는 그대로 실행됨)
+         */
+        static bool PinCurrentThreadToNode(int node);
+
+        /**
+         * @brief  노드의 물리 메모리를 우선 사용하도록 가상 메모리를 할당합니다 (kAnyNode이면 노드 지정 없음).
+         *         크기가 Large Page 배수이면 MEM_LARGE_PAGES를 먼저 시도하고, 권한이 없거나 연속 물리 메모리가 부족하면
+         *         일반 4KB 페이지로 할당합니다.
+         * @param  address  할당할 주소 (nullptr이면 OS가 선택)
+         */
+        static void* AllocateOnNode(size_t size, int node, void* address = nullptr);
+
+        /**
+         * @brief  alignment 경계에 정렬된 영역을 AllocateOnNode로 할당합니다 (예약 → 해제 → 정렬 주소에 재할당).
+         * @return void*  다른 스레드가 그 주소를 먼저 차지하여 재시도가 모두 실패하면 nullptr
+         */
+        static void* AllocateAlignedOnNode(size_t size, size_t alignment, int node);
+
+        /**
+         * @brief  사용할 수 있는 Large Page 크기 (GetLargePageMinimum, 보통 2MB).
+         *         최초 호출 시 SeLockMemoryPrivilege를 활성화하며, 계정에 권한이 없으면 0을 반환합니다.
+         */
+        static size_t GetLargePageSize();
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,184 @@
+#define NOMINMAX
+#include "PayloadIntegrity.h"
+#include <array>
+#include <cstring>
+#include <nmmintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define ARENA_TARGET_SSE42
+#else
+#include <cpuid.h>
+#define ARENA_TARGET_SSE42 __attribute__((target("sse4.2")))
+#endif
+
+namespace AdaptiveArena
+{
+    namespace
+    {
+        constexpr uint32_t kCastagnoliPoly = 0x82F63B78u;   // Reflected
+        constexpr size_t kInterleaveBlock = 8192;            // 3개 스트림 각각의 블록 크기
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // GF(2) 다항식 연산 (스트림 결합용)
+        uint32_t MultModP(uint32_t a, uint32_t b)
+        {
+            uint32_t m = 1u << 31;
+            uint32_t p = 0;
+            for (;;)
+            {
+                if (a & m)
+                {
+                    p ^= b;
+                    if ((a & (m - 1)) == 0) break;
+                }
+                m >>= 1;
+                b = (b & 1) ? (b >> 1) ^ kCastagnoliPoly : b >> 1;
+            }
+            return p;
+        }
+
+        // x^(2^k) mod P
+        std::array<uint32_t, 64> BuildPowerTable()
+        {
+            std::array<uint32_t, 64> x2n{};
+            x2n[0] = 1u << 30;   // x^1
+            for (size_t k = 1; k < x2n.size(); ++k)
+            {
+                x2n[k] = MultModP(x2n[k - 1], x2n[k - 1]);
+            }
+            return x2n;
+        }
+
+        // x^(8n) mod P: CRC를 n 바이트만큼 0으로 이어 붙인 효과
+        uint32_t ShiftOperator(size_t bytes)
+        {
+            static const std::array<uint32_t, 64> x2n = BuildPowerTable();
+
+            uint32_t p = 1u << 31;   // x^0
+            for (size_t k = 3; bytes; bytes >>= 1, ++k)
+            {
+                if (bytes & 1) p = MultModP(x2n[k], p);
+            }
+            return p;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Software Fallback (Table)
+        std::array<uint32_t, 256> BuildTable()
+        {
+            std::array<uint32_t, 256> table{};
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc & 1) ? (crc >> 1) ^ kCastagnoliPoly : crc >> 1;
+                }
+                table[i] = crc;
+            }
+            return table;
+        }
+
+        uint32_t ExtendSoftware(uint32_t crc, const uint8_t* p, size_t length)
+        {
+            static const std::array<uint32_t, 256> table = BuildTable();
+            while (length--)
+            {
+                crc = table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+            }
+            return crc;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // SSE4.2 (3-way Interleave)
+        ARENA_TARGET_SSE42 uint32_t ExtendHardware(uint32_t crc, const uint8_t* p, size_t length)
+        {
+            static const uint32_t shift1 = ShiftOperator(kInterleaveBlock);
+            static const uint32_t shift2 = ShiftOperator(kInterleaveBlock * 2);
+
+            // 1. 8바이트 정렬까지 바이트 단위 처리
+            while (length > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0)
+            {
+                crc = _mm_crc32_u8(crc, *p++);
+                --length;
+            }
+
+            // 2. 3개 블록을 동시에 계산하여 CRC32 명령어의 지연(3 cycle)을 숨김
+            uint64_t a = crc;
+            while (length >= kInterleaveBlock * 3)
+            {
+                uint64_t b = 0;
+                uint64_t c = 0;
+                for (size_t i = 0; i < kInterleaveBlock; i += 8)
+                {
+                    uint64_t va, vb, vc;
+                    std::memcpy(&va, p + i, 8);
+                    std::memcpy(&vb, p + kInterleaveBlock + i, 8);
+                    std::memcpy(&vc, p + kInterleaveBlock * 2 + i, 8);
+                    a = _mm_crc32_u64(a, va);
+                    b = _mm_crc32_u64(b, vb);
+                    c = _mm_crc32_u64(c, vc);
+                }
+
+                // crc(A||B||C) = crc(A)·x^(2B) ⊕ crc(B)·x^(B) ⊕ crc(C)
+                a = MultModP(shift2, static_cast<uint32_t>(a)) ^ MultModP(shift1, static_cast<uint32_t>(b)) ^ static_cast<uint32_t>(c);
+                p += kInterleaveBlock * 3;
+                length -= kInterleaveBlock * 3;
+            }
+
+            // 3. 나머지
+            while (length >= 8)
+            {
+                uint64_t v;
+                std::memcpy(&v, p, 8);
+                a = _mm_crc32_u64(a, v);
+                p += 8;
+                length -= 8;
+            }
+            crc = static_cast<uint32_t>(a);
+            while (length--)
+            {
+                crc = _mm_crc32_u8(crc, *p++);
+            }
+            return crc;
+        }
+
+        bool DetectSse42()
+        {
+#ifdef _MSC_VER
+            int info[4] = {};
+            __cpuid(info, 1);
+            return (info[2] & (1 << 20)) != 0;
+#else
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2) != 0;
+#endif
+        }
+
+    } // namespace
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // IsHardwareAccelerated
+    bool Crc32c::IsHardwareAccelerated()
+    {
+        static const bool supported = DetectSse42();
+        return supported;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Extend
+    uint32_t Crc32c::Extend(uint32_t crc, const void* data, size_t length)
+    {
+        const auto* p = static_cast<const uint8_t*>(data);
+        return IsHardwareAccelerated() ? ExtendHardware(crc, p, length) : ExtendSoftware(crc, p, length);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Shift
+    uint32_t Crc32c::Shift(uint32_t crc, size_t length)
+    {
+        return (length == 0) ? crc : MultModP(ShiftOperator(length), crc);
+    }
+
+} // namespace AdaptiveArena
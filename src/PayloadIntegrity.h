@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  CRC32C (Castagnoli) 계산기입니다.
+     *         SSE4.2 CRC32 명령어를 3-way 인터리브로 실행하여 메모리 대역폭 수준으로 동작하며,
+     *         지원하지 않는 CPU에서는 테이블 방식으로 대체합니다.
+     */
+    class Crc32c
+    {
+    public:
+        /**
+         * @brief  반전(Pre/Post Inversion) 없는 CRC 상태에 데이터를 이어서 반영합니다.
+         */
+        static uint32_t Extend(uint32_t crc, const void* data, size_t length);
+
+        /**
+         * @brief  CRC 상태 뒤에 length 바이트의 0을 이어 붙인 상태를 계산합니다.
+         *         조각별로 (초기값 0) 따로 계산한 CRC를 결합할 때 사용합니다: crc(A||B) = Shift(crc(A), |B|) ^ crc(B)
+         */
+        static uint32_t Shift(uint32_t crc, size_t length);
+
+        static bool IsHardwareAccelerated();
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  비밀키로 시드된 페이로드 체크섬 누산기입니다.
+     *         Producer가 슬롯을 채우는 동안 조각 단위로 Update하면 캐시에 남아 있는 데이터로 계산되어 별도의 패스가 필요 없습니다.
+     *         (우발적 손상/불일치 검출용이며 암호학적 MAC은 아닙니다.)
+     */
+    class PayloadChecksum
+    {
+    public:
+        explicit PayloadChecksum(uint32_t seed) : m_state(seed) {}
+
+        /**
+         * @brief  비밀키로부터 시드를 만듭니다 (키가 다르면 같은 페이로드도 다른 체크섬).
+         */
+        static uint32_t SeedFromKey(const std::string& secretKey)
+        {
+            return Crc32c::Extend(0xFFFFFFFFu, secretKey.data(), secretKey.size());
+        }
+
+        /**
+         * @brief  페이로드의 다음 연속 조각을 반영합니다 (앞에서부터 순서대로 호출).
+         */
+        void Update(const void* data, size_t length) { m_state = Crc32c::Extend(m_state, data, length); }
+
+        /**
+         * @brief  다른 스레드가 (초기값 0으로) 계산한 다음 조각의 CRC를 결합합니다.
+         */
+        void Append(uint32_t partCrc, size_t partLength) { m_state = Crc32c::Shift(m_state, partLength) ^ partCrc; }
+
+        uint32_t Finalize() const { return ~m_state; }
+
+    private:
+        uint32_t m_state;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,356 @@
+#define NOMINMAX
+#include "PersistenceManager.h"
+#include "PayloadIntegrity.h"
+#include <windows.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+namespace AdaptiveArena
+{
+    static_assert(std::is_trivially_copyable<SessionProfile>::value, "SessionProfile is written to disk as-is.");
+    static_assert(sizeof(ProfileIndexEntry) == 40, "ProfileIndexEntry layout is part of the file format.");
+
+    namespace
+    {
+        constexpr size_t kLegacyHeaderBytes = 16;   // 버전 1 헤더 (magic, version, profileBytes, checksum)
+
+        uint32_t ProfileChecksum(const SessionProfile& profile)
+        {
+            return ~Crc32c::Extend(0xFFFFFFFFu, &profile, sizeof(profile));
+        }
+
+        uint32_t LibraryChecksum(const ProfileIndexEntry* index, const SessionProfile* profiles, size_t count)
+        {
+            uint32_t crc = Crc32c::Extend(0xFFFFFFFFu, index, count * sizeof(ProfileIndexEntry));
+            return ~Crc32c::Extend(crc, profiles, count * sizeof(SessionProfile));
+        }
+
+        // 두 링 형상의 거리: 슬롯 바이트 수의 로그 비율 (2배 차이 = 1)
+        double GeometryDistance(const RingProfile& ring, uint64_t headerSize, uint64_t payloadSize)
+        {
+            const double a = static_cast<double>(ring.headerSize + ring.payloadSize) + 1.0;
+            const double b = static_cast<double>(headerSize + payloadSize) + 1.0;
+            return std::fabs(std::log2(a / b));
+        }
+
+        bool WriteAll(HANDLE file, const void* data, size_t length)
+        {
+            DWORD written = 0;
+            return WriteFile(file, data, static_cast<DWORD>(length), &written, nullptr) && written == length;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SessionProfile::FindRing
+    const RingProfile* SessionProfile::FindRing(uint64_t headerSize, uint64_t payloadSize) const
+    {
+        for (uint32_t i = 0; i < std::min<uint32_t>(ringCount, kMaxRingProfiles); ++i)
+        {
+            if (rings[i].headerSize == headerSize && rings[i].payloadSize == payloadSize) return &rings[i];
+        }
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SessionProfile::StoreRing
+    void SessionProfile::StoreRing(const RingProfile& ring)
+    {
+        RingProfile* target = const_cast<RingProfile*>(FindRing(ring.headerSize, ring.payloadSize));
+        if (!target)
+        {
+            if (ringCount < kMaxRingProfiles)
+            {
+                target = &rings[ringCount++];
+            }
+            else
+            {
+                target = std::min_element(rings, rings + kMaxRingProfiles, [](const RingProfile& a, const RingProfile& b)
+                {
+                    return a.lastSession < b.lastSession;
+                });
+            }
+        }
+        *target = ring;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SessionProfile::FindNearestRing
+    const RingProfile* SessionProfile::FindNearestRing(uint64_t headerSize, uint64_t payloadSize) const
+    {
+        const RingProfile* nearest = nullptr;
+        double best = 0.0;
+        for (uint32_t i = 0; i < std::min<uint32_t>(ringCount, kMaxRingProfiles); ++i)
+        {
+            const double distance = GeometryDistance(rings[i], headerSize, payloadSize);
+            if (!nearest || distance < best)
+            {
+                nearest = &rings[i];
+                best = distance;
+            }
+        }
+        return nearest;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SessionProfile::SizeClassOf
+    size_t SessionProfile::SizeClassOf(size_t bytes)
+    {
+        size_t shift = 0;
+        while (shift + 1 < kSizeClassCount && (size_t(1) << shift) < bytes)
+        {
+            ++shift;
+        }
+        return shift;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProfileLibrary::LowerBound
+    size_t ProfileLibrary::LowerBound(const std::string& key) const
+    {
+        auto it = std::lower_bound(m_index.begin(), m_index.end(), key, [](const ProfileIndexEntry& entry, const std::string& value)
+        {
+            return value.compare(entry.key) > 0;
+        });
+        return static_cast<size_t>(it - m_index.begin());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProfileLibrary::Find
+    const SessionProfile* ProfileLibrary::Find(const std::string& key) const
+    {
+        const size_t i = LowerBound(key);
+        if (i < m_index.size() && key == m_index[i].key) return &m_profiles[i];
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProfileLibrary::Store
+    void ProfileLibrary::Store(const std::string& key, const SessionProfile& profile)
+    {
+        if (!IsValidKey(key)) return;
+
+        size_t i = LowerBound(key);
+        if (i < m_index.size() && key == m_index[i].key)
+        {
+            m_profiles[i] = profile;
+            return;
+        }
+
+        // 가득 차면 가장 오래 쓰이지 않은 키를 내보냄
+        if (m_index.size() >= kMaxWorkloadProfiles)
+        {
+            auto oldest = std::min_element(m_index.begin(), m_index.end(), [](const ProfileIndexEntry& a, const ProfileIndexEntry& b)
+            {
+                return a.lastUsed < b.lastUsed;
+            });
+            const size_t victim = static_cast<size_t>(oldest - m_index.begin());
+            m_index.erase(m_index.begin() + victim);
+            m_profiles.erase(m_profiles.begin() + victim);
+            i = LowerBound(key);
+        }
+
+        ProfileIndexEntry entry{};
+        std::memcpy(entry.key, key.data(), key.size());
+        entry.lastUsed = m_useClock;
+        m_index.insert(m_index.begin() + i, entry);
+        m_profiles.insert(m_profiles.begin() + i, profile);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProfileLibrary::Touch
+    void ProfileLibrary::Touch(const std::string& key)
+    {
+        ++m_useClock;
+        const size_t i = LowerBound(key);
+        if (i < m_index.size() && key == m_index[i].key) m_index[i].lastUsed = m_useClock;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProfileLibrary::FindNearestRing
+    const RingProfile* ProfileLibrary::FindNearestRing(uint64_t headerSize, uint64_t payloadSize) const
+    {
+        const RingProfile* nearest = nullptr;
+        double best = 0.0;
+        for (const SessionProfile& profile : m_profiles)
+        {
+            const RingProfile* ring = profile.FindNearestRing(headerSize, payloadSize);
+            if (!ring) continue;
+
+            const double distance = GeometryDistance(*ring, headerSize, payloadSize);
+            if (!nearest || distance < best)
+            {
+                nearest = ring;
+                best = distance;
+            }
+        }
+        return nearest;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ProfileLibrary::IsValidKey
+    bool ProfileLibrary::IsValidKey(const std::string& key)
+    {
+        return !key.empty() && key.size() <= kMaxWorkloadKeyLength && key.find('\0') == std::string::npos;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Save
+    bool PersistenceManager::Save(const std::filesystem::path& path, const ProfileLibrary& library)
+    {
+        const size_t count = library.m_index.size();
+
+        ProfileFileHeader header{};
+        header.magic = kProfileMagic;
+        header.version = kProfileVersion;
+        header.profileBytes = sizeof(SessionProfile);
+        header.checksum = LibraryChecksum(library.m_index.data(), library.m_profiles.data(), count);
+        header.entryCount = static_cast<uint32_t>(count);
+        header.useClock = library.m_useClock;
+
+        // 1. 임시 파일에 기록 후 디스크에 반영 (교체 전에 내용이 영속화되어야 함)
+        std::filesystem::path temp = path;
+        temp += L".tmp";
+
+        HANDLE file = CreateFileW(temp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        bool ok = WriteAll(file, &header, sizeof(header)) &&
+                  WriteAll(file, library.m_index.data(), count * sizeof(ProfileIndexEntry)) &&
+                  WriteAll(file, library.m_profiles.data(), count * sizeof(SessionProfile)) &&
+                  FlushFileBuffers(file);
+        CloseHandle(file);
+
+        // 2. 원자적 교체 (같은 볼륨 내 이름 변경)
+        if (ok)
+        {
+            ok = MoveFileExW(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+        }
+        if (!ok)
+        {
+            DeleteFileW(temp.c_str());
+        }
+        return ok;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Load
+    bool PersistenceManager::Load(const std::filesystem::path& path, ProfileLibrary& outLibrary)
+    {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        const auto* bytes = static_cast<const uint8_t*>(view);
+        const size_t size = static_cast<size_t>(fileSize.QuadPart);
+        ProfileLibrary library;
+        bool ok = false;
+
+        if (size == sizeof(uint64_t))
+        {
+            // 최초 형식: 예측 크기 하나만 저장되어 있음
+            SessionProfile legacy;
+            std::memcpy(&legacy.predictedBytes, bytes, sizeof(uint64_t));
+            library.Store(kDefaultWorkloadKey, legacy);
+            ok = true;
+        }
+        else if (size >= kLegacyHeaderBytes)
+        {
+            ProfileFileHeader header{};
+            std::memcpy(&header, bytes, std::min(size, sizeof(header)));
+
+            if (header.magic != kProfileMagic || header.version == 0 || header.version > kProfileVersion)
+            {
+                std::cerr << "[Internal] Session profile has an unknown format or version; ignoring." << std::endl;
+            }
+            else if (header.profileBytes != sizeof(SessionProfile))
+            {
+                std::cerr << "[Internal] Session profile layout does not match; ignoring." << std::endl;
+            }
+            else if (header.version == 1)
+            {
+                // 버전 1: 단일 프로필 → 기본 키
+                SessionProfile profile;
+                if (size < kLegacyHeaderBytes + sizeof(profile))
+                {
+                    std::cerr << "[Internal] Session profile is truncated; ignoring." << std::endl;
+                }
+                else
+                {
+                    std::memcpy(&profile, bytes + kLegacyHeaderBytes, sizeof(profile));
+                    if (ProfileChecksum(profile) != header.checksum)
+                    {
+                        std::cerr << "[Internal] Session profile checksum mismatch; ignoring." << std::endl;
+                    }
+                    else
+                    {
+                        library.Store(kDefaultWorkloadKey, profile);
+                        ok = true;
+                    }
+                }
+            }
+            else
+            {
+                const size_t count = header.entryCount;
+                const size_t indexBytes = count * sizeof(ProfileIndexEntry);
+                if (count > kMaxWorkloadProfiles || size < sizeof(header) + indexBytes + count * sizeof(SessionProfile))
+                {
+                    std::cerr << "[Internal] Session profile is truncated; ignoring." << std::endl;
+                }
+                else
+                {
+                    library.m_index.resize(count);
+                    library.m_profiles.resize(count);
+                    std::memcpy(library.m_index.data(), bytes + sizeof(header), indexBytes);
+                    std::memcpy(library.m_profiles.data(), bytes + sizeof(header) + indexBytes, count * sizeof(SessionProfile));
+                    library.m_useClock = header.useClock;
+
+                    if (LibraryChecksum(library.m_index.data(), library.m_profiles.data(), count) != header.checksum)
+                    {
+                        std::cerr << "[Internal] Session profile checksum mismatch; ignoring." << std::endl;
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            library.m_index[i].key[kMaxWorkloadKeyLength] = '\0';
+                            library.m_profiles[i].ringCount = std::min<uint32_t>(library.m_profiles[i].ringCount, kMaxRingProfiles);
+                        }
+                        ok = true;
+                    }
+                }
+            }
+        }
+
+        UnmapViewOfFile(view);
+        CloseHandle(mapping);
+        CloseHandle(file);
+
+        if (ok) outLibrary = std::move(library);
+        return ok;
+    }
+
+} // namespace AdaptiveArena
@@ -1,59 +1,181 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
-#include <fstream>
+#include <string>
+#include <vector>
 
-namespace AdaptiveArena 
+namespace AdaptiveArena
 {
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Profile Library File Layout
+    //
+    //   [ProfileFileHeader] [ProfileIndexEntry x entryCount] [SessionProfile x entryCount]
+    //
+    // 워크로드 키(영상 모드)마다 SessionProfile 하나를 두며, 색인은 키 순으로 정렬되어 있고 i번째 색인이 i번째 프로필을 가리킵니다.
+    // 헤더의 CRC32C는 색인과 프로필 전체에 대해 계산됩니다. 임시 파일에 쓰고 디스크에 반영한 뒤 원자적으로 교체하므로
+    // 저장 도중 종료되어도 직전 파일이 그대로 남습니다. 이전 형식(버전 1의 단일 프로필, 예측 크기 size_t 하나)은
+    // 기본 키의 프로필로 읽어서 변환합니다.
+
+    constexpr uint32_t kProfileMagic = 0x46504141;   // "AAPF"
+    constexpr uint32_t kProfileVersion = 2;          // 1: [헤더 16바이트] [SessionProfile]
+    constexpr size_t kMaxRingProfiles = 8;
+    constexpr size_t kSizeClassCount = 48;           // 2^0 ~ 2^47 바이트 (log2 올림)
+    constexpr size_t kMaxWorkloadProfiles = 16;
+    constexpr size_t kMaxWorkloadKeyLength = 31;
+    constexpr const char* kDefaultWorkloadKey = "default";
+
+    /**
+     * @brief  링 형상(헤더/페이로드 크기)별로 학습된 슬롯 구성입니다.
+     */
+    struct RingProfile
+    {
+        uint64_t headerSize;
+        uint64_t payloadSize;
+        uint32_t slotCount;       ///< 학습된 권장 슬롯 수
+        uint32_t scratchBytes;    ///< 학습된 프레임당 스크래치 피크 (여유분 제외)
+        uint32_t lastSession;     ///< 마지막으로 갱신된 세션 번호 (가득 차면 가장 오래된 항목부터 교체)
+        uint32_t reserved;
+    };
+
+    /**
+     * @brief  링 지연(Lag, 슬롯 수)의 분위수입니다.
+     */
+    struct JitterQuantiles
+    {
+        uint32_t p50 = 0;
+        uint32_t p90 = 0;
+        uint32_t p99 = 0;
+        uint32_t max = 0;
+        uint64_t samples = 0;
+    };
+
+    /**
+     * @brief  재시작 시 워크로드에 맞춘 상태로 바로 시작하기 위한 세션 프로필입니다 (파일에 그대로 기록되는 POD).
+     */
+    struct SessionProfile
+    {
+        uint64_t predictedBytes = 0;                      ///< LearningEngine 예측 피크 사용량
+        uint32_t sessionCount = 0;                        ///< 저장된 세션 수
+        uint32_t ringCount = 0;
+        RingProfile rings[kMaxRingProfiles] = {};
+        JitterQuantiles jitter;
+        uint64_t sizeClassCounts[kSizeClassCount] = {};   ///< 마지막 세션의 크기 등급별 할당 횟수
+
+        /**
+         * @brief  형상이 일치하는 링 항목을 찾습니다.
+         * @return const RingProfile*  없으면 nullptr
+         */
+        const RingProfile* FindRing(uint64_t headerSize, uint64_t payloadSize) const;
+
+        /**
+         * @brief  링 항목을 갱신하거나 추가합니다 (가득 차면 가장 오래 갱신되지 않은 항목을 교체).
+         */
+        void StoreRing(const RingProfile& ring);
+
+        /**
+         * @brief  형상이 가장 가까운 링 항목을 찾습니다 (슬롯 바이트 수의 로그 비율 기준).
+         * @return const RingProfile*  항목이 하나도 없으면 nullptr
+         */
+        const RingProfile* FindNearestRing(uint64_t headerSize, uint64_t payloadSize) const;
+
+        static size_t SizeClassOf(size_t bytes);
+    };
+
+    /**
+     * @brief  프로필 파일 헤더입니다 (버전 1은 앞의 16바이트만 사용).
+     */
+    struct ProfileFileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t profileBytes;    ///< sizeof(SessionProfile)
+        uint32_t checksum;        ///< 색인 + 프로필의 CRC32C
+        uint32_t entryCount;
+        uint32_t useClock;        ///< 워크로드 활성화 횟수 (LRU 교체 기준)
+    };
+
+    /**
+     * @brief  프로필 색인 항목입니다.
+     */
+    struct ProfileIndexEntry
+    {
+        char key[kMaxWorkloadKeyLength + 1];   ///< NUL 종료 워크로드 키
+        uint32_t lastUsed;                     ///< 마지막 활성화 시점의 useClock
+        uint32_t reserved;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  워크로드 키(B-mode, Color Doppler, 3D 등)별 SessionProfile 저장소입니다.
+     *         모드마다 학습 상태를 따로 두어 모드 전환이 다른 모드의 EMA를 오염시키지 않도록 합니다.
+     */
+    class ProfileLibrary
+    {
+    public:
+        /**
+         * @brief  키의 프로필을 찾습니다 (정렬된 색인에서 이진 탐색).
+         * @return const SessionProfile*  없으면 nullptr
+         */
+        const SessionProfile* Find(const std::string& key) const;
+
+        /**
+         * @brief  키의 프로필을 갱신하거나 추가합니다 (가득 차면 가장 오래 쓰이지 않은 키를 교체).
+         */
+        void Store(const std::string& key, const SessionProfile& profile);
+
+        /**
+         * @brief  키를 활성화된 것으로 표시합니다 (LRU 시계 증가).
+         */
+        void Touch(const std::string& key);
+
+        /**
+         * @brief  모든 키의 링 항목 중 형상이 가장 가까운 것을 찾습니다 (처음 보는 키의 초기값).
+         * @return const RingProfile*  없으면 nullptr
+         */
+        const RingProfile* FindNearestRing(uint64_t headerSize, uint64_t payloadSize) const;
+
+        size_t GetCount() const { return m_index.size(); }
+
+        /**
+         * @brief  키가 비어 있지 않고 kMaxWorkloadKeyLength 이하인지 확인합니다.
+         */
+        static bool IsValidKey(const std::string& key);
+
+    private:
+        friend class PersistenceManager;
+        size_t LowerBound(const std::string& key) const;
+
+        std::vector<ProfileIndexEntry> m_index;   // 키 순 정렬
+        std::vector<SessionProfile> m_profiles;   // m_index와 같은 순서
+        uint32_t m_useClock = 0;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /**
      * @brief  세션 데이터(학습 결과 등)를 파일로 저장하고 복원하는 관리자입니다.
      */
-    class PersistenceManager 
+    class PersistenceManager
     {
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Public Methods
     public:
         /**
-         * @brief  데이터를 파일로 저장합니다 (바이너리).
-         * @param  path  저장할 경로
-         * @param  data  저장할 예측 사이즈 값
-         * @return bool  성공 여부
-         */
-        static bool Save(const std::filesystem::path& path, size_t data) 
-        {
-            std::ofstream file(path, std::ios::binary);
-            if (!file.is_open()) 
-            {
-                return false;
-            }
-
-            file.write(reinterpret_cast<const char*>(&data), sizeof(data));
-            return true;
-        }
-
-        /**
-         * @brief  파일에서 데이터를 불러옵니다.
-         * @param  path  로드할 경로
-         * @param  outData  복원된 데이터를 담을 변수
-         * @return bool  성공 여부
-         */
-        static bool Load(const std::filesystem::path& path, size_t& outData) 
-        {
-            if (!std::filesystem::exists(path)) 
-            {
-                return false;
-            }
-
-            std::ifstream file(path, std::ios::binary);
-            if (!file.is_open()) 
-            {
-                return false;
-            }
-
-            file.read(reinterpret_cast<char*>(&outData), sizeof(outData));
-            return true;
-        }
+         * @brief  라이브러리를 임시 파일에 쓰고 디스크에 반영(Flush)한 뒤 원래 경로로 원자적으로 교체합니다.
+         * @param  path     저장할 경로
+         * @param  library  저장할 프로필 라이브러리
+         * @return bool     성공 여부 (실패 시 기존 파일은 그대로)
+         */
+        static bool Save(const std::filesystem::path& path, const ProfileLibrary& library);
+
+        /**
+         * @brief  파일을 메모리 매핑하여 라이브러리를 불러옵니다. 매직/버전/크기/체크섬이 맞지 않으면 거부합니다.
+         * @param  path        로드할 경로
+         * @param  outLibrary  복원된 라이브러리 (실패 시 변경하지 않음)
+         * @return bool        성공 여부
+         */
+        static bool Load(const std::filesystem::path& path, ProfileLibrary& outLibrary);
     };
 
 } // namespace AdaptiveArena
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RF Session Record File Layout
+    //
+    //   [RecordFileHeader (4KB 블록)]
+    //   [Frame 0 Payload (payloadStride)] [Frame 1 Payload] ... [Frame N-1 Payload]
+    //   [RecordIndexEntry x N (4KB 단위로 패딩)]
+    //
+    // 모든 페이로드는 4KB 경계에서 시작하므로 Direct I/O로 쓰고 메모리 매핑으로 그대로 읽을 수 있습니다.
+
+    constexpr uint32_t kRecordMagic = 0x46524141;   // "AARF"
+    constexpr uint32_t kRecordVersion = 1;
+    constexpr size_t kRecordAlignment = 4096;
+
+    /**
+     * @brief  녹화 파일의 첫 블록에 저장되는 파일 헤더입니다.
+     */
+    struct RecordFileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t headerSize;      ///< 원본 링의 슬롯 헤더 크기
+        uint64_t payloadSize;     ///< 프레임당 유효 페이로드 크기
+        uint64_t payloadStride;   ///< 파일 내 프레임 간격 (4KB 정렬)
+        uint64_t dataOffset;      ///< 첫 프레임 페이로드 위치
+        uint64_t frameCount;      ///< 기록된 프레임 수 (녹화 종료 시 확정)
+        uint64_t indexOffset;     ///< 인덱스 테이블 위치 (녹화 중에는 0)
+    };
+
+    /**
+     * @brief  프레임별 인덱스 항목. PacketHeader 필드와 파일 내 위치를 기록합니다.
+     */
+    struct RecordIndexEntry
+    {
+        uint64_t fileOffset;
+        uint64_t timestamp;
+        uint32_t frameIndex;
+        uint32_t channelCount;
+        uint32_t sampleDepth;
+        uint32_t flags;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,305 @@
+#define NOMINMAX
+#include "RingCoroutines.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RingTask
+    RingTask& RingTask::operator=(RingTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_handle) m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    RingTask::~RingTask()
+    {
+        // Spawn 되지 않은 코루틴 (시작 전 상태)
+        if (m_handle) m_handle.destroy();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // StageFrame
+    StageFrame& StageFrame::operator=(StageFrame&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            m_arena = std::exchange(other.m_arena, nullptr);
+            m_cursor = other.m_cursor;
+            m_index = other.m_index;
+        }
+        return *this;
+    }
+
+    void StageFrame::Release()
+    {
+        if (m_arena)
+        {
+            m_arena->Release(m_cursor);
+            m_arena = nullptr;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReservedSlot
+    ReservedSlot& ReservedSlot::operator=(ReservedSlot&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Commit();
+            m_arena = std::exchange(other.m_arena, nullptr);
+            m_index = other.m_index;
+        }
+        return *this;
+    }
+
+    void ReservedSlot::Commit()
+    {
+        if (m_arena)
+        {
+            m_arena->CommitWrite();
+            m_arena = nullptr;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FrameAwaiter
+    bool RingScheduler::FrameAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        return m_scheduler.Suspend(*this, handle);
+    }
+
+    StageFrame RingScheduler::FrameAwaiter::await_resume()
+    {
+        return m_acquired ? StageFrame(&m_scheduler.m_arena, m_cursor, m_index) : StageFrame();
+    }
+
+    bool RingScheduler::FrameAwaiter::TryComplete()
+    {
+        if (m_scheduler.m_arena.TryAcquire(m_cursor, m_index))
+        {
+            m_acquired = true;
+            return true;
+        }
+        return m_scheduler.m_stopping.load(std::memory_order_acquire);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SlotAwaiter
+    bool RingScheduler::SlotAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        return m_scheduler.Suspend(*this, handle);
+    }
+
+    ReservedSlot RingScheduler::SlotAwaiter::await_resume()
+    {
+        return m_claimed ? ReservedSlot(&m_scheduler.m_arena, m_index) : ReservedSlot();
+    }
+
+    bool RingScheduler::SlotAwaiter::TryComplete()
+    {
+        if (m_scheduler.m_stopping.load(std::memory_order_acquire)) return true;
+
+        m_claimed = m_scheduler.m_arena.TryClaimWrite(m_index);
+        return m_claimed;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    RingScheduler::RingScheduler(UltrasoundArena& arena, size_t threads)
+        : m_arena(arena)
+        , m_progressEpoch(0)
+        , m_polledEpoch(0)
+        , m_waiterCount(0)
+        , m_liveTasks(0)
+        , m_resumes(0)
+        , m_stopping(false)
+        , m_shutdown(false)
+    {
+        m_arena.SetProgressListener(this);
+
+        threads = std::max<size_t>(threads, 1);
+        for (size_t i = 0; i < threads; ++i)
+        {
+            m_threads.emplace_back(&RingScheduler::WorkerLoop, this, i);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    RingScheduler::~RingScheduler()
+    {
+        Stop();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_cv.notify_all();
+        for (auto& thread : m_threads)
+        {
+            if (thread.joinable()) thread.join();
+        }
+
+        m_arena.SetProgressListener(nullptr);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Spawn
+    void RingScheduler::Spawn(RingTask task)
+    {
+        auto handle = std::exchange(task.m_handle, nullptr);
+        if (!handle) return;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_stopping.load(std::memory_order_relaxed))
+        {
+            lock.unlock();
+            handle.destroy();
+            throw std::runtime_error("Ring scheduler is stopped.");
+        }
+
+        handle.promise().scheduler = this;
+        m_tasks.push_back(handle);
+        m_liveTasks.fetch_add(1, std::memory_order_relaxed);
+        m_ready.push_back(handle);
+        lock.unlock();
+        m_cv.notify_one();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void RingScheduler::Stop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stopping.store(true, std::memory_order_release);
+
+        // 대기 중인 코루틴은 빈 결과로 재개 (획득 가능한 프레임이 남아 있으면 그것부터 받음)
+        PollWaiters();
+        m_cv.notify_all();
+
+        m_cv.wait(lock, [this]() { return m_liveTasks.load(std::memory_order_relaxed) == 0; });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // OnRingProgress
+    void RingScheduler::OnRingProgress()
+    {
+        m_progressEpoch.fetch_add(1, std::memory_order_release);
+
+        // 대기 등록(Suspend)과 반대 순서로 확인하여 깨움 누락 방지
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiterCount.load(std::memory_order_relaxed) > 0)
+        {
+            { std::lock_guard<std::mutex> lock(m_mutex); }
+            m_cv.notify_one();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WorkerLoop
+    void RingScheduler::WorkerLoop(size_t ordinal)
+    {
+        m_arena.ApplyThreadPlacement(ThreadRole::Consumer, ordinal);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_shutdown)
+        {
+            // 1. 실행 대기열
+            if (!m_ready.empty())
+            {
+                std::coroutine_handle<> handle = m_ready.front();
+                m_ready.pop_front();
+                lock.unlock();
+
+                handle.resume();
+                m_resumes.fetch_add(1, std::memory_order_relaxed);
+
+                lock.lock();
+                if (handle.done())
+                {
+                    // 대기 함수는 RingTask 본문에서만 co_await 하므로 재개된 핸들은 항상 RingTask
+                    auto task = std::coroutine_handle<RingTask::promise_type>::from_address(handle.address());
+                    m_tasks.erase(std::remove(m_tasks.begin(), m_tasks.end(), task), m_tasks.end());
+                    lock.unlock();
+
+                    if (task.promise().exception)
+                    {
+                        try { std::rethrow_exception(task.promise().exception); }
+                        catch (const std::exception& e) { std::cerr << "[Ultrasound] Ring task failed: " << e.what() << std::endl; }
+                        catch (...) { std::cerr << "[Ultrasound] Ring task failed." << std::endl; }
+                    }
+                    task.destroy();
+
+                    lock.lock();
+                    m_liveTasks.fetch_sub(1, std::memory_order_relaxed);
+                    m_cv.notify_all();
+                }
+                continue;
+            }
+
+            // 2. 링이 진행했으면 대기 목록 확인
+            const uint64_t epoch = m_progressEpoch.load(std::memory_order_acquire);
+            if (epoch != m_polledEpoch && !m_waiters.empty())
+            {
+                m_polledEpoch = epoch;
+                PollWaiters();
+                continue;
+            }
+
+            // 3. 통보 대기. 통보 없는 진행(임대 반납, 외부 소비자 회수)에 대비해 짧은 주기로 다시 확인
+            bool signaled = m_cv.wait_for(lock, std::chrono::milliseconds(1), [this]()
+            {
+                return m_shutdown || !m_ready.empty() ||
+                       (!m_waiters.empty() && m_progressEpoch.load(std::memory_order_acquire) != m_polledEpoch);
+            });
+            if (!signaled && !m_waiters.empty()) PollWaiters();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PollWaiters
+    void RingScheduler::PollWaiters()
+    {
+        const size_t before = m_ready.size();
+        auto it = std::remove_if(m_waiters.begin(), m_waiters.end(), [this](Waiter* waiter)
+        {
+            if (!waiter->TryComplete()) return false;
+            m_ready.push_back(waiter->handle);
+            return true;
+        });
+        m_waiters.erase(it, m_waiters.end());
+        m_waiterCount.store(m_waiters.size(), std::memory_order_relaxed);
+
+        // 이 스레드가 하나를 맡고, 나머지는 다른 스레드가 나누어 실행
+        if (m_ready.size() > before + 1) m_cv.notify_all();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Suspend
+    bool RingScheduler::Suspend(Waiter& waiter, std::coroutine_handle<> handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        waiter.handle = handle;
+        m_waiters.push_back(&waiter);
+        m_waiterCount.store(m_waiters.size(), std::memory_order_relaxed);
+
+        // await_ready 이후 등록 전에 진행이 있었을 수 있으므로 다시 확인 (OnRingProgress와 반대 순서)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiter.TryComplete())
+        {
+            m_waiters.pop_back();
+            m_waiterCount.store(m_waiters.size(), std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace AdaptiveArena
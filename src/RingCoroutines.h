@@ -0,0 +1,258 @@
+#pragma once
+
+// C++20 전용 (ADAPTIVE_ARENA_COROUTINES 옵션의 ring_coro 타깃). 나머지 아레나 API는 C++17 그대로입니다.
+#include "UltrasoundArena.h"
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    class RingScheduler;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  RingScheduler에서 실행되는 단계 코루틴의 반환 타입입니다.
+     *         생성 시 멈춘 상태로 시작하며 RingScheduler::Spawn에 넘겨야 실행됩니다.
+     */
+    class RingTask
+    {
+    public:
+        struct promise_type
+        {
+            RingScheduler* scheduler = nullptr;
+            std::exception_ptr exception;
+
+            RingTask get_return_object() { return RingTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }   // 프레임은 스케줄러가 정리
+            void return_void() {}
+            void unhandled_exception() { exception = std::current_exception(); }
+        };
+
+        RingTask(RingTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+        RingTask& operator=(RingTask&& other) noexcept;
+        ~RingTask();
+
+        RingTask(const RingTask&) = delete;
+        RingTask& operator=(const RingTask&) = delete;
+
+    private:
+        friend class RingScheduler;
+        explicit RingTask(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  co_await NextFrame으로 획득한 슬롯입니다 (RAII). 소멸 또는 Release 시 커서를 반납하여 하류 단계에 넘깁니다.
+     */
+    class StageFrame
+    {
+    public:
+        StageFrame() = default;
+        StageFrame(UltrasoundArena* arena, size_t cursor, size_t index)
+            : m_arena(arena), m_cursor(cursor), m_index(index) {}
+        ~StageFrame() { Release(); }
+
+        StageFrame(StageFrame&& other) noexcept
+            : m_arena(std::exchange(other.m_arena, nullptr)), m_cursor(other.m_cursor), m_index(other.m_index) {}
+        StageFrame& operator=(StageFrame&& other) noexcept;
+
+        StageFrame(const StageFrame&) = delete;
+        StageFrame& operator=(const StageFrame&) = delete;
+
+        void Release();
+        explicit operator bool() const { return m_arena != nullptr; }
+
+        size_t GetIndex() const { return m_index; }
+        void* GetHeader() const { return m_arena ? m_arena->GetHeader(m_index) : nullptr; }
+        void* GetPayload() const { return m_arena ? m_arena->GetPayload(m_index) : nullptr; }
+        std::pmr::memory_resource* GetScratch() const { return m_arena ? m_arena->GetSlotScratch(m_index) : nullptr; }
+
+    private:
+        UltrasoundArena* m_arena = nullptr;
+        size_t m_cursor = 0;
+        size_t m_index = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  co_await ReserveSlot으로 예약한 쓰기 슬롯입니다 (RAII). Commit 하지 않고 소멸하면 그대로 발행합니다
+     *         (예약된 슬롯은 취소할 수 없으며, 발행하지 않으면 이후 프레임이 모두 막힘).
+     */
+    class ReservedSlot
+    {
+    public:
+        ReservedSlot() = default;
+        ReservedSlot(UltrasoundArena* arena, size_t index) : m_arena(arena), m_index(index) {}
+        ~ReservedSlot() { Commit(); }
+
+        ReservedSlot(ReservedSlot&& other) noexcept
+            : m_arena(std::exchange(other.m_arena, nullptr)), m_index(other.m_index) {}
+        ReservedSlot& operator=(ReservedSlot&& other) noexcept;
+
+        ReservedSlot(const ReservedSlot&) = delete;
+        ReservedSlot& operator=(const ReservedSlot&) = delete;
+
+        void Commit();
+        explicit operator bool() const { return m_arena != nullptr; }
+
+        size_t GetIndex() const { return m_index; }
+        void* GetHeader() const { return m_arena ? m_arena->GetHeader(m_index) : nullptr; }
+        void* GetPayload() const { return m_arena ? m_arena->GetPayload(m_index) : nullptr; }
+
+    private:
+        UltrasoundArena* m_arena = nullptr;
+        size_t m_index = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  링 단계 코루틴을 소수의 스레드에서 실행하는 스케줄러입니다.
+     *         프레임을 기다리는 코루틴은 스레드를 점유하지 않고 대기 목록에 걸려 있다가, 링이 진행(Commit/Release)할 때
+     *         조건이 충족된 것만 재개됩니다. 단계마다 OS 스레드를 두는 RingPipeline과 달리 단계 수와 스레드 수가 무관합니다.
+     *
+     *         RingTask Filter(RingScheduler& ring, size_t cursor)
+     *         {
+     *             while (true)
+     *             {
+     *                 StageFrame frame = co_await ring.NextFrame(cursor);
+     *                 if (!frame) co_return;   // 스케줄러 정지
+     *                 ...
+     *             }
+     *         }
+     */
+    class RingScheduler : private RingProgressListener
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Awaitables
+    private:
+        struct Waiter
+        {
+            std::coroutine_handle<> handle;
+            virtual bool TryComplete() = 0;   // 조건이 충족되면 결과를 채우고 true
+        };
+
+    public:
+        class FrameAwaiter : private Waiter
+        {
+        public:
+            bool await_ready() { return TryComplete(); }
+            bool await_suspend(std::coroutine_handle<> handle);
+            StageFrame await_resume();
+
+        private:
+            friend class RingScheduler;
+            FrameAwaiter(RingScheduler& scheduler, size_t cursor) : m_scheduler(scheduler), m_cursor(cursor) {}
+            bool TryComplete() override;
+
+            RingScheduler& m_scheduler;
+            size_t m_cursor;
+            size_t m_index = 0;
+            bool m_acquired = false;
+        };
+
+        class SlotAwaiter : private Waiter
+        {
+        public:
+            bool await_ready() { return TryComplete(); }
+            bool await_suspend(std::coroutine_handle<> handle);
+            ReservedSlot await_resume();
+
+        private:
+            friend class RingScheduler;
+            explicit SlotAwaiter(RingScheduler& scheduler) : m_scheduler(scheduler) {}
+            bool TryComplete() override;
+
+            RingScheduler& m_scheduler;
+            size_t m_index = 0;
+            bool m_claimed = false;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  threads  코루틴을 실행할 스레드 수 (단계 수보다 적어도 됨)
+         * @throw  std::runtime_error 링에 이미 다른 진행 통보 대상이 있을 때 발생
+         */
+        RingScheduler(UltrasoundArena& arena, size_t threads);
+
+        /**
+         * @brief  스레드를 정지하고 아직 끝나지 않은 코루틴 프레임을 정리합니다 (지역 StageFrame은 반납됨).
+         */
+        ~RingScheduler();
+
+        RingScheduler(const RingScheduler&) = delete;
+        RingScheduler& operator=(const RingScheduler&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  코루틴을 스케줄러에 넘기고 실행 대기열에 넣습니다.
+         */
+        void Spawn(RingTask task);
+
+        /**
+         * @brief  커서의 다음 프레임을 기다립니다. 정지 후에는 빈 StageFrame으로 재개됩니다.
+         */
+        FrameAwaiter NextFrame(size_t cursor) { return FrameAwaiter(*this, cursor); }
+
+        /**
+         * @brief  Back-pressure가 풀릴 때까지 기다려 쓰기 슬롯을 예약합니다 (Producer 코루틴은 하나여야 함).
+         *         정지 후에는 빈 ReservedSlot으로 재개됩니다.
+         */
+        SlotAwaiter ReserveSlot() { return SlotAwaiter(*this); }
+
+        /**
+         * @brief  대기 중인 코루틴을 모두 빈 결과로 재개시켜 종료를 유도하고, 모든 코루틴이 끝날 때까지 기다립니다.
+         */
+        void Stop();
+
+        size_t GetThreadCount() const { return m_threads.size(); }
+        size_t GetLiveTaskCount() const { return m_liveTasks.load(std::memory_order_relaxed); }
+        uint64_t GetResumeCount() const { return m_resumes.load(std::memory_order_relaxed); }
+
+    private:
+        void OnRingProgress() override;
+        void WorkerLoop(size_t ordinal);
+
+        /**
+         * @brief  대기 목록에서 조건이 충족된 코루틴을 실행 대기열로 옮깁니다 (m_mutex 보유 상태에서 호출).
+         */
+        void PollWaiters();
+
+        /**
+         * @brief  대기 등록 직전에 조건을 한 번 더 확인합니다. 충족되면 false를 반환하여 멈추지 않고 계속 실행합니다.
+         */
+        bool Suspend(Waiter& waiter, std::coroutine_handle<> handle);
+
+    private:
+        UltrasoundArena& m_arena;
+        std::vector<std::thread> m_threads;
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<std::coroutine_handle<>> m_ready;
+        std::vector<Waiter*> m_waiters;
+        std::vector<std::coroutine_handle<RingTask::promise_type>> m_tasks;   // 정리용 (살아있는 코루틴 프레임)
+
+        std::atomic<uint64_t> m_progressEpoch;   // 링 진행마다 증가
+        uint64_t m_polledEpoch;                  // 마지막으로 대기 목록을 확인한 시점 (m_mutex)
+        std::atomic<size_t> m_waiterCount;
+        std::atomic<size_t> m_liveTasks;
+        std::atomic<uint64_t> m_resumes;
+        std::atomic<bool> m_stopping;
+        bool m_shutdown;
+    };
+
+} // namespace AdaptiveArena
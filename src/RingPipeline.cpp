@@ -0,0 +1,151 @@
+#define NOMINMAX
+#include "RingPipeline.h"
+#include <stdexcept>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    RingPipeline::RingPipeline(UltrasoundArena& arena)
+        : m_arena(arena)
+        , m_running(false)
+        , m_stopRequested(false)
+        , m_detached(false)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    RingPipeline::~RingPipeline()
+    {
+        Stop();
+
+        // 한 번도 시작하지 않은 파이프라인의 커서도 Producer를 막지 않도록 분리
+        DetachStages();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AddStage
+    size_t RingPipeline::AddStage(const std::string& name, StageFunc func)
+    {
+        if (m_running || m_detached)
+        {
+            throw std::runtime_error("Stages must be registered before the pipeline starts.");
+        }
+
+        // 첫 단계는 Producer의 Commit을, 이후 단계는 직전 단계의 Release를 따라감
+        size_t upstream = m_stages.empty() ? UltrasoundArena::kProducerCursor : m_stages.back()->cursor;
+
+        auto stage = std::make_unique<Stage>();
+        stage->cursor = m_arena.AddCursor(name, upstream);
+        stage->func = std::move(func);
+        m_stages.push_back(std::move(stage));
+
+        return m_stages.size() - 1;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void RingPipeline::Start()
+    {
+        if (m_detached || m_running.exchange(true)) return;
+
+        m_stopRequested = false;
+        for (size_t i = 0; i < m_stages.size(); ++i)
+        {
+            m_stages[i]->finished = false;
+            m_stages[i]->worker = std::thread(&RingPipeline::StageLoop, this, i);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void RingPipeline::Stop()
+    {
+        if (!m_running.exchange(false)) return;
+
+        m_stopRequested = true;
+        for (auto& stage : m_stages)
+        {
+            if (stage->worker.joinable())
+            {
+                stage->worker.join();
+            }
+        }
+
+        // 정지한 단계의 커서가 Back-pressure와 링 확장 판단에 계속 남지 않도록 분리
+        DetachStages();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DetachStages
+    void RingPipeline::DetachStages()
+    {
+        if (m_detached) return;
+        m_detached = true;
+
+        for (auto& stage : m_stages)
+        {
+            m_arena.DetachCursor(stage->cursor);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetStageTelemetry
+    RingCursorTelemetry RingPipeline::GetStageTelemetry(size_t stage) const
+    {
+        if (stage >= m_stages.size()) return RingCursorTelemetry{ "", 0, 0, 0.0 };
+        return m_arena.GetCursorTelemetry(m_stages[stage]->cursor);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // StageLoop
+    void RingPipeline::StageLoop(size_t stageIndex)
+    {
+        Stage& stage = *m_stages[stageIndex];
+        const Stage* previous = (stageIndex > 0) ? m_stages[stageIndex - 1].get() : nullptr;
+        size_t idleSpins = 0;
+
+        // 첫 단계는 Producer와 캐시를 공유하는 코어에, 이후 단계는 각자 전용 코어에 고정
+        m_arena.ApplyThreadPlacement(ThreadRole::Consumer, stageIndex);
+
+        while (true)
+        {
+            size_t index = 0;
+            if (m_arena.TryAcquire(stage.cursor, index))
+            {
+                idleSpins = 0;
+                stage.func(index, m_arena.GetHeader(index), m_arena.GetPayload(index));
+                m_arena.Release(stage.cursor);
+                continue;
+            }
+
+            // 정지 요청 시: 상류가 모두 끝난 뒤 남은 프레임까지 비우고 종료 (순서 보장)
+            if (m_stopRequested && (!previous || previous->finished))
+            {
+                if (!m_arena.TryAcquire(stage.cursor, index)) break;
+
+                stage.func(index, m_arena.GetHeader(index), m_arena.GetPayload(index));
+                m_arena.Release(stage.cursor);
+                continue;
+            }
+
+            // Idle Backoff: 짧게 스핀 후 양보, 장시간 유휴 시에만 잠들기
+            if (++idleSpins < 64)
+            {
+                continue;
+            }
+            else if (idleSpins < 1024)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+        stage.finished = true;
+    }
+
+} // namespace AdaptiveArena
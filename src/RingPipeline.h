@@ -0,0 +1,96 @@
+#pragma once
+
+#include "UltrasoundArena.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  UltrasoundArena의 슬롯을 복사 없이 여러 처리 단계(Acquire → Filter → Beamform → Display)로 흘려보내는 파이프라인입니다.
+     *         각 단계는 링 위의 순서가 정해진 커서로 등록되며, 단계 k는 단계 k-1이 해제한 슬롯만 읽습니다.
+     *         마지막 단계가 해제한 슬롯만 Producer가 재사용하므로 자연스럽게 Back-pressure가 걸립니다.
+     */
+    class RingPipeline
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Types
+    public:
+        /**
+         * @brief  단계 처리 함수. 슬롯 위치와 해당 슬롯의 Header/Payload를 받습니다.
+         */
+        using StageFunc = std::function<void(size_t index, void* header, void* payload)>;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        explicit RingPipeline(UltrasoundArena& arena);
+        ~RingPipeline();
+
+        RingPipeline(const RingPipeline&) = delete;
+        RingPipeline& operator=(const RingPipeline&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  다음 처리 단계를 등록합니다. 등록 순서가 곧 처리 순서입니다.
+         * @param  name  텔레메트리 표시용 단계 이름
+         * @param  func  단계 처리 함수 (단계 전용 스레드에서 호출됨)
+         * @return size_t  단계 번호
+         * @throw  std::runtime_error 파이프라인 실행 중 등록 시 발생
+         */
+        size_t AddStage(const std::string& name, StageFunc func);
+
+        /**
+         * @brief  단계별 전용 스레드를 시작합니다. 정지된 파이프라인은 다시 시작되지 않습니다.
+         */
+        void Start();
+
+        /**
+         * @brief  이미 발행된 프레임을 모든 단계가 처리하도록 한 뒤 스레드를 정지하고 단계 커서를 링에서 분리합니다.
+         */
+        void Stop();
+
+        /**
+         * @brief  Producer가 쓸 슬롯을 예약합니다. 마지막 단계가 슬롯을 반납하지 않았으면 false를 반환합니다.
+         */
+        bool TryReserve(size_t& outIndex) { return m_arena.TryClaimWrite(outIndex); }
+
+        /**
+         * @brief  Producer가 채운 슬롯을 첫 번째 단계에 발행합니다.
+         */
+        void Publish() { m_arena.CommitWrite(); }
+
+        size_t GetStageCount() const { return m_stages.size(); }
+
+        /**
+         * @brief  단계별 지연(Lag) 및 평균 처리 시간을 반환합니다.
+         */
+        RingCursorTelemetry GetStageTelemetry(size_t stage) const;
+
+    private:
+        void StageLoop(size_t stage);
+        void DetachStages();
+
+    private:
+        struct Stage
+        {
+            size_t cursor;
+            StageFunc func;
+            std::thread worker;
+            std::atomic<bool> finished{false};
+        };
+
+        UltrasoundArena& m_arena;
+        std::vector<std::unique_ptr<Stage>> m_stages;
+        std::atomic<bool> m_running;
+        std::atomic<bool> m_stopRequested;
+        bool m_detached;                      // 단계 커서를 분리함 (Stop 또는 소멸 이후)
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  단일 Writer / 다중 Reader Seqlock 셀입니다. Reader는 Writer를 막지 않고, 쓰는 도중에 읽은 사본은 버전으로 걸러냅니다.
+     *         값은 8바이트 원자 워드 배열로 보관하므로 읽기/쓰기가 겹쳐도 데이터 경쟁(Data Race)이 아닙니다.
+     * @tparam T  Trivially Copyable 타입 (수 KB 이하 권장)
+     */
+    template <typename T>
+    class SeqlockCell
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqlockCell requires a trivially copyable type.");
+        static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    public:
+        SeqlockCell() : m_version(0), m_words{} {}
+
+        SeqlockCell(const SeqlockCell&) = delete;
+        SeqlockCell& operator=(const SeqlockCell&) = delete;
+
+        /**
+         * @brief  값을 게시합니다 (Writer 스레드 하나에서만 호출).
+         */
+        void Store(const T& value)
+        {
+            uint64_t words[kWords] = {};
+            std::memcpy(words, &value, sizeof(T));
+
+            const uint64_t version = m_version.load(std::memory_order_relaxed);
+            m_version.store(version + 1, std::memory_order_relaxed);   // 홀수: 쓰는 중
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < kWords; ++i)
+            {
+                m_words[i].store(words[i], std::memory_order_relaxed);
+            }
+            m_version.store(version + 2, std::memory_order_release);
+        }
+
+        /**
+         * @brief  일관된 사본을 한 번 시도해 읽습니다.
+         * @return bool  쓰는 도중이었거나 읽는 사이 갱신되었으면 false (out은 변경하지 않음)
+         */
+        bool TryLoad(T& out) const
+        {
+            const uint64_t before = m_version.load(std::memory_order_acquire);
+            if (before & 1) return false;
+
+            uint64_t words[kWords];
+            for (size_t i = 0; i < kWords; ++i)
+            {
+                words[i] = m_words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_version.load(std::memory_order_relaxed) != before) return false;
+
+            std::memcpy(&out, words, sizeof(T));
+            return true;
+        }
+
+        /**
+         * @brief  일관된 사본을 얻을 때까지 재시도합니다 (Writer가 드물게 쓰는 용도, 한 번도 게시되지 않았으면 T{}).
+         */
+        T Load() const
+        {
+            T value{};
+            while (!TryLoad(value)) {}
+            return value;
+        }
+
+    private:
+        std::atomic<uint64_t> m_version;
+        std::array<std::atomic<uint64_t>, kWords> m_words;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,339 @@
+#define NOMINMAX
+#include "SessionRecorder.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    SessionRecorder::SessionRecorder(UltrasoundArena& arena,
+                                     const std::filesystem::path& path,
+                                     size_t upstream,
+                                     size_t queueDepth)
+        : m_arena(arena)
+        , m_cursor(UltrasoundArena::kProducerCursor)
+        , m_queueDepth(std::clamp<size_t>(queueDepth, 1, kMaxQueueDepth))
+        , m_file(INVALID_HANDLE_VALUE)
+        , m_completionPort(nullptr)
+        , m_directIO(false)
+        , m_fileHeader{}
+        , m_pending(std::clamp<size_t>(queueDepth, 1, kMaxQueueDepth))
+        , m_submitted(0)
+        , m_retired(0)
+        , m_running(false)
+        , m_stopRequested(false)
+        , m_stopLimit(0)
+        , m_verifyIntegrity(false)
+        , m_recordedFrames(0)
+        , m_failedWrites(0)
+        , m_corruptFrames(0)
+    {
+        if (m_arena.GetPayloadStride() == 0)
+        {
+            throw std::runtime_error("Ring must be initialized before recording.");
+        }
+
+        // 1. Unbuffered + Overlapped (Direct I/O): 페이지 캐시를 거치지 않고 슬롯 메모리에서 곧바로 DMA
+        // 2. Fallback: 캐시를 거치는 Overlapped 핸들 (동기 핸들은 쓰기가 직렬화되므로 같은 Completion Port 경로 유지)
+        const DWORD attempts[] = { FILE_FLAG_NO_BUFFERING | FILE_FLAG_OVERLAPPED, FILE_FLAG_SEQUENTIAL_SCAN | FILE_FLAG_OVERLAPPED };
+        for (DWORD flags : attempts)
+        {
+            m_file = CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | flags, nullptr);
+            if (m_file == INVALID_HANDLE_VALUE) continue;
+
+            m_completionPort = CreateIoCompletionPort(m_file, nullptr, 0, 1);
+            if (m_completionPort)
+            {
+                m_directIO = (flags & FILE_FLAG_NO_BUFFERING) != 0;
+                break;
+            }
+            CloseHandle(m_file);
+            m_file = INVALID_HANDLE_VALUE;
+        }
+
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Failed to create session record file.");
+        }
+        if (!m_directIO)
+        {
+            std::cout << "[Recorder] Direct I/O unavailable. Falling back to buffered overlapped writes." << std::endl;
+        }
+
+        m_fileHeader.magic = kRecordMagic;
+        m_fileHeader.version = kRecordVersion;
+        m_fileHeader.headerSize = m_arena.GetHeaderSize();
+        m_fileHeader.payloadSize = m_arena.GetPayloadSize();
+        m_fileHeader.payloadStride = m_arena.GetPayloadStride();
+        m_fileHeader.dataOffset = kRecordAlignment;
+
+        // 파일이 준비된 뒤에만 커서 등록 (실패한 녹화기가 Producer를 막지 않도록)
+        m_cursor = m_arena.AddCursor("Recorder", upstream);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    SessionRecorder::~SessionRecorder()
+    {
+        Stop();
+
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            m_arena.DetachCursor(m_cursor);
+            if (m_completionPort) CloseHandle(m_completionPort);
+            CloseHandle(m_file);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void SessionRecorder::Start()
+    {
+        if (m_file == INVALID_HANDLE_VALUE || m_running.exchange(true)) return;
+
+        // 녹화 중 파일도 헤더로 식별 가능하도록 미리 기록 (frameCount/indexOffset은 종료 시 확정)
+        WriteBlocking(0, &m_fileHeader, sizeof(m_fileHeader));
+
+        m_startTime = std::chrono::steady_clock::now();
+        m_stopRequested = false;
+        m_thread = std::thread(&SessionRecorder::RecorderLoop, this);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void SessionRecorder::Stop()
+    {
+        if (!m_running.exchange(false)) return;
+
+        // 지금까지 발행된 프레임까지만 기록 (Producer가 계속 발행해도 녹화 스레드가 따라잡기를 끝없이 반복하지 않음)
+        m_stopLimit.store(m_arena.GetCursorUpstreamLimit(m_cursor), std::memory_order_relaxed);
+        m_stopRequested.store(true, std::memory_order_release);
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+
+        WriteTrailer();
+
+        m_arena.DetachCursor(m_cursor);
+        if (m_completionPort) CloseHandle(m_completionPort);
+        CloseHandle(m_file);
+        m_completionPort = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+
+        if (m_failedWrites.load() > 0)
+        {
+            std::cerr << "[Recorder] " << m_failedWrites.load() << " frame writes failed." << std::endl;
+        }
+        if (m_corruptFrames.load() > 0)
+        {
+            std::cerr << "[Recorder] " << m_corruptFrames.load() << " frames failed integrity verification." << std::endl;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetWriteThroughputGBs
+    double SessionRecorder::GetWriteThroughputGBs() const
+    {
+        if (!m_running) return 0.0;
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+        if (seconds <= 0.0) return 0.0;
+
+        double bytes = static_cast<double>(GetRecordedFrames()) * static_cast<double>(m_fileHeader.payloadStride);
+        return (bytes / (1024.0 * 1024.0 * 1024.0)) / seconds;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RecorderLoop
+    void SessionRecorder::RecorderLoop()
+    {
+        m_arena.ApplyThreadPlacement(ThreadRole::Recorder);
+        size_t idleSpins = 0;
+
+        while (true)
+        {
+            bool progressed = false;
+
+            // 1. Submit: Queue Depth까지 슬롯을 잡아 쓰기 제출 (정지 요청 후에는 Stop 시점의 상류 위치까지만)
+            const bool stopping = m_stopRequested.load(std::memory_order_acquire);
+            const uint64_t stopLimit = m_stopLimit.load(std::memory_order_relaxed);
+            while (m_submitted - m_retired < m_queueDepth)
+            {
+                if (stopping && m_arena.GetCursorAcquired(m_cursor) >= stopLimit) break;
+
+                size_t index = 0;
+                uint64_t sequence = 0;
+                if (!m_arena.TryAcquire(m_cursor, index, sequence)) break;
+
+                Submit(m_pending[m_submitted % m_queueDepth], index);
+                ++m_submitted;
+                progressed = true;
+            }
+
+            // 2. Reap: 큐가 가득 찼을 때만 완료를 기다림
+            ReapCompletions(m_submitted - m_retired == m_queueDepth);
+
+            // 3. Retire: 완료된 쓰기를 시퀀스 순서로 반납
+            while (m_retired < m_submitted)
+            {
+                PendingWrite& pending = m_pending[m_retired % m_queueDepth];
+                if (!pending.done.load(std::memory_order_acquire)) break;
+
+                // 쓰기 실패: 파일의 해당 위치는 쓰레기이므로 인덱스에 손상으로 표시 (재생 시 식별 가능)
+                if (pending.failed)
+                {
+                    ++m_failedWrites;
+                    m_index[pending.record].flags |= kPacketFlagCorrupted;
+                }
+                pending.done.store(false, std::memory_order_relaxed);
+
+                m_arena.Release(m_cursor);
+                ++m_retired;
+                m_recordedFrames.fetch_add(1, std::memory_order_relaxed);
+                progressed = true;
+            }
+
+            if (progressed)
+            {
+                idleSpins = 0;
+                continue;
+            }
+
+            if (stopping && m_retired == m_submitted && m_arena.GetCursorAcquired(m_cursor) >= stopLimit)
+            {
+                break;
+            }
+
+            if (++idleSpins < 1024)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Submit
+    void SessionRecorder::Submit(PendingWrite& pending, size_t slotIndex)
+    {
+        const uint64_t offset = m_fileHeader.dataOffset + m_submitted * m_fileHeader.payloadStride;
+
+        // 인덱스: 헤더는 작으므로 복사, 페이로드는 슬롯 메모리 그대로 제출
+        RecordIndexEntry entry{ offset, 0, 0, 0, 0, 0 };
+        auto* header = static_cast<const PacketHeader*>(m_arena.GetHeader(slotIndex));
+        if (header && m_fileHeader.headerSize >= sizeof(PacketHeader))
+        {
+            entry.timestamp = header->timestamp;
+            entry.frameIndex = header->frameIndex;
+            entry.channelCount = header->channelCount;
+            entry.sampleDepth = header->sampleDepth;
+            entry.flags = header->flags;
+        }
+
+        // Lazy 검증: 손상된 프레임도 기록하되 인덱스에 표시 (재생 시 식별 가능)
+        if (m_verifyIntegrity && !m_arena.VerifyPayload(slotIndex))
+        {
+            entry.flags |= kPacketFlagCorrupted;
+            m_corruptFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_index.push_back(entry);
+
+        pending.record = m_submitted;
+        pending.buffer = m_arena.GetPayload(slotIndex);
+        pending.failed = false;
+        std::memset(&pending.overlapped, 0, sizeof(pending.overlapped));
+        pending.overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+        pending.overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        BOOL ok = WriteFile(m_file, pending.buffer, static_cast<DWORD>(m_fileHeader.payloadStride), nullptr, &pending.overlapped);
+        if (!ok && GetLastError() != ERROR_IO_PENDING)
+        {
+            pending.failed = true;
+            pending.done.store(true, std::memory_order_release);
+        }
+        // 동기 완료 시에도 Completion Port로 완료 패킷이 전달되므로 여기서 done 처리하지 않음
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReapCompletions
+    void SessionRecorder::ReapCompletions(bool wait)
+    {
+        DWORD timeoutMs = wait ? 1 : 0;
+        while (true)
+        {
+            DWORD bytes = 0;
+            ULONG_PTR key = 0;
+            LPOVERLAPPED overlapped = nullptr;
+            BOOL ok = GetQueuedCompletionStatus(m_completionPort, &bytes, &key, &overlapped, timeoutMs);
+            if (!overlapped) break; // Timeout
+
+            auto* pending = reinterpret_cast<PendingWrite*>(overlapped);
+            pending->failed = !ok || bytes != m_fileHeader.payloadStride;
+            pending->done.store(true, std::memory_order_release);
+            timeoutMs = 0;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriteBlocking
+    bool SessionRecorder::WriteBlocking(uint64_t offset, const void* data, size_t length)
+    {
+        // Direct I/O 정렬 조건을 맞추기 위해 4KB 단위로 패딩된 정렬 버퍼 사용
+        size_t padded = (length + kRecordAlignment - 1) / kRecordAlignment * kRecordAlignment;
+        if (padded == 0) return true;
+
+        void* buffer = ::operator new(padded, std::align_val_t{kRecordAlignment});
+        std::memset(buffer, 0, padded);
+        std::memcpy(buffer, data, length);
+
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        // 이벤트 핸들의 하위 비트를 세우면 Completion Port로 패킷이 전달되지 않음
+        DWORD written = 0;
+        BOOL ok = FALSE;
+        HANDLE event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (event)
+        {
+            overlapped.hEvent = reinterpret_cast<HANDLE>(reinterpret_cast<ULONG_PTR>(event) | 1);
+
+            ok = WriteFile(m_file, buffer, static_cast<DWORD>(padded), nullptr, &overlapped);
+            if (ok || GetLastError() == ERROR_IO_PENDING)
+            {
+                ok = GetOverlappedResult(m_file, &overlapped, &written, TRUE);
+            }
+            CloseHandle(event);
+        }
+        else
+        {
+            std::cerr << "[Recorder] CreateEventW failed. Write at offset " << offset << " skipped." << std::endl;
+        }
+
+        ::operator delete(buffer, std::align_val_t{kRecordAlignment});
+        return ok && written == padded;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriteTrailer
+    void SessionRecorder::WriteTrailer()
+    {
+        m_fileHeader.frameCount = m_index.size();
+        m_fileHeader.indexOffset = m_fileHeader.dataOffset + m_index.size() * m_fileHeader.payloadStride;
+
+        bool ok = WriteBlocking(m_fileHeader.indexOffset, m_index.data(), m_index.size() * sizeof(RecordIndexEntry));
+        ok = WriteBlocking(0, &m_fileHeader, sizeof(m_fileHeader)) && ok;
+        FlushFileBuffers(m_file);
+
+        std::cout << "[Recorder] Session closed. Frames: " << m_fileHeader.frameCount
+                  << (ok ? "" : " (trailer write failed)") << std::endl;
+    }
+
+} // namespace AdaptiveArena
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "UltrasoundArena.h"
+#include "RecordFormat.h"
+#include <atomic>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  링 페이로드를 복사 없이 디스크로 스트리밍하는 녹화 소비자(Consumer)입니다.
+     *         슬롯 메모리를 그대로 Unbuffered(Direct) Overlapped I/O로 제출하고 I/O Completion Port로 완료를 수거합니다.
+     *         Direct I/O를 열 수 없는 볼륨에서는 캐시를 거치는 Overlapped 핸들로 같은 Completion Port 경로를 사용합니다.
+     *         슬롯은 쓰기가 끝날 때까지만 잡고 있으며, 완료 순서와 무관하게 시퀀스 순서로 반납합니다.
+     */
+    class SessionRecorder
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  arena       녹화할 링 (InitializeRing 이후여야 함)
+         * @param  path        녹화 파일 경로
+         * @param  upstream    상류 커서 ID (기본: Producer와 병렬로 녹화)
+         * @param  queueDepth  동시에 진행할 최대 쓰기 수
+         * @throw  std::runtime_error 파일 생성 실패 시 발생
+         */
+        SessionRecorder(UltrasoundArena& arena,
+                        const std::filesystem::path& path,
+                        size_t upstream = UltrasoundArena::kProducerCursor,
+                        size_t queueDepth = 16);
+        ~SessionRecorder();
+
+        SessionRecorder(const SessionRecorder&) = delete;
+        SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        void Start();
+
+        /**
+         * @brief  호출 시점까지 상류가 넘겨준 프레임을 모두 기록한 뒤 인덱스와 파일 헤더를 확정하고 정지합니다.
+         *         그 뒤에 발행되는 프레임은 기록하지 않으므로 Producer가 계속 실행 중이어도 반환됩니다.
+         */
+        void Stop();
+
+        /**
+         * @brief  기록 전에 슬롯 체크섬을 검증합니다 (Start 이전에 설정). 불일치 프레임은 kPacketFlagCorrupted로 표시됩니다.
+         */
+        void SetVerifyIntegrity(bool enable) { m_verifyIntegrity = enable; }
+        uint64_t GetCorruptFrames() const { return m_corruptFrames.load(std::memory_order_relaxed); }
+
+        bool IsDirectIO() const { return m_directIO; }
+        uint64_t GetRecordedFrames() const { return m_recordedFrames.load(std::memory_order_relaxed); }
+        double GetWriteThroughputGBs() const;
+
+    private:
+        struct PendingWrite
+        {
+            OVERLAPPED overlapped;   // 반드시 첫 멤버 (Completion 시 포인터로 역참조)
+            uint64_t record;
+            const void* buffer = nullptr;
+            std::atomic<bool> done{false};
+            bool failed = false;
+        };
+
+        void RecorderLoop();
+        void Submit(PendingWrite& pending, size_t slotIndex);
+        void ReapCompletions(bool wait);
+        bool WriteBlocking(uint64_t offset, const void* data, size_t length);
+        void WriteTrailer();
+
+    private:
+        static constexpr size_t kMaxQueueDepth = 64;
+
+        UltrasoundArena& m_arena;
+        size_t m_cursor;
+        size_t m_queueDepth;
+
+        HANDLE m_file;
+        HANDLE m_completionPort;
+        bool m_directIO;
+
+        RecordFileHeader m_fileHeader;
+        std::vector<RecordIndexEntry> m_index;
+
+        // In-flight 쓰기 (record % queueDepth 위치에 순서대로 배치)
+        std::vector<PendingWrite> m_pending;
+        uint64_t m_submitted;
+        uint64_t m_retired;
+
+        std::thread m_thread;
+        std::atomic<bool> m_running;
+        std::atomic<bool> m_stopRequested;
+        std::atomic<uint64_t> m_stopLimit;   // Stop 시점의 상류 위치 (이 시퀀스 직전까지만 기록)
+        bool m_verifyIntegrity;
+        std::atomic<uint64_t> m_recordedFrames;
+        std::atomic<uint64_t> m_failedWrites;
+        std::atomic<uint64_t> m_corruptFrames;
+        std::chrono::steady_clock::time_point m_startTime;
+    };
+
+} // namespace AdaptiveArena
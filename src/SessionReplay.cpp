@@ -0,0 +1,290 @@
+#define NOMINMAX
+#include "SessionReplay.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    SessionReplay::SessionReplay(UltrasoundArena& arena, const std::filesystem::path& path)
+        : m_arena(arena)
+        , m_file(INVALID_HANDLE_VALUE)
+        , m_mapping(nullptr)
+        , m_base(nullptr)
+        , m_fileSize(0)
+        , m_zeroCopyUsed(false)
+        , m_header{}
+        , m_index(nullptr)
+        , m_prefetchedUntil(0)
+        , m_stopRequested(false)
+        , m_finished(true)
+        , m_replayedFrames(0)
+        , m_blockedClaims(0)
+    {
+        // 1. 순차 접근 힌트와 함께 파일 열기 (OS Read-ahead 강화)
+        m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Failed to open session record file.");
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(m_file, &size) || static_cast<uint64_t>(size.QuadPart) < sizeof(RecordFileHeader))
+        {
+            CloseMapping();
+            throw std::runtime_error("Session record file is truncated.");
+        }
+        m_fileSize = static_cast<uint64_t>(size.QuadPart);
+
+        // 2. Copy-on-Write 매핑: 읽기는 페이지 캐시를 그대로 공유
+        m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (m_mapping)
+        {
+            m_base = static_cast<uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0));
+        }
+        if (!m_base)
+        {
+            CloseMapping();
+            throw std::runtime_error("Failed to map session record file.");
+        }
+
+        // 3. 형식 검증
+        std::memcpy(&m_header, m_base, sizeof(m_header));
+        if (m_header.magic != kRecordMagic || m_header.version != kRecordVersion)
+        {
+            CloseMapping();
+            throw std::runtime_error("Unsupported session record format.");
+        }
+        if (m_header.indexOffset == 0 || m_header.indexOffset > m_fileSize ||
+            m_header.frameCount > (m_fileSize - m_header.indexOffset) / sizeof(RecordIndexEntry))
+        {
+            CloseMapping();
+            throw std::runtime_error("Session record has no index (recording was not closed).");
+        }
+        if (m_header.payloadSize > m_header.payloadStride || m_header.payloadStride > m_fileSize)
+        {
+            CloseMapping();
+            throw std::runtime_error("Session record header is corrupted.");
+        }
+        if (m_arena.GetPayloadStride() < m_header.payloadSize)
+        {
+            CloseMapping();
+            throw std::runtime_error("Ring payload is smaller than the recorded frame.");
+        }
+
+        m_index = reinterpret_cast<const RecordIndexEntry*>(m_base + m_header.indexOffset);
+
+        // 4. 모든 프레임이 파일 안에 있는지 확인 (잘리거나 손상된 녹화가 재생 중 접근 위반을 일으키지 않도록)
+        //    프레임은 녹화 순서대로 기록되므로 위치도 엄격히 증가해야 함 (PrefetchAhead가 범위 길이를 차이로 계산)
+        const uint64_t lastOffset = m_fileSize - m_header.payloadStride;
+        for (uint64_t i = 0; i < m_header.frameCount; ++i)
+        {
+            if (m_index[i].fileOffset < m_header.dataOffset || m_index[i].fileOffset > lastOffset)
+            {
+                CloseMapping();
+                throw std::runtime_error("Session record index entry " + std::to_string(i) + " points outside the file.");
+            }
+            if (i > 0 && m_index[i].fileOffset <= m_index[i - 1].fileOffset)
+            {
+                CloseMapping();
+                throw std::runtime_error("Session record index entry " + std::to_string(i) + " is out of order.");
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    SessionReplay::~SessionReplay()
+    {
+        Stop();
+
+        // 매핑을 가리키는 프레임을 모든 커서와 임대가 반납한 뒤에 연결 해제 후 매핑 정리
+        if (m_zeroCopyUsed && !m_arena.DrainExternalPayloads(kDrainTimeout))
+        {
+            // 아직 읽는 소비자가 있으므로 뷰는 프로세스 종료까지 남겨 둠 (핸들만 닫아도 뷰가 매핑을 유지)
+            std::cerr << "[Replay] Consumers still hold zero-copy frames; the file view is left mapped." << std::endl;
+            m_base = nullptr;
+        }
+        CloseMapping();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void SessionReplay::Start(const ReplayOptions& options)
+    {
+        Stop();
+
+        // Zero-Copy 시 소비자는 링의 페이로드 크기만큼 읽으므로, 녹화 프레임 간격을 넘어서면 안 됨
+        if (options.zeroCopy && m_arena.GetPayloadSize() > m_header.payloadStride)
+        {
+            throw std::runtime_error("Zero-copy replay requires ring payload size <= recorded stride.");
+        }
+
+        // 공유 링의 외부 소비자는 세그먼트만 매핑하므로 이 프로세스의 파일 뷰를 볼 수 없음
+        if (options.zeroCopy && m_arena.IsSharedRing())
+        {
+            throw std::runtime_error("Zero-copy replay is not available on a shared ring.");
+        }
+
+        m_zeroCopyUsed = m_zeroCopyUsed || options.zeroCopy;
+        m_stopRequested = false;
+        m_finished = false;
+        m_replayedFrames = 0;
+        m_blockedClaims = 0;
+        m_startTime = std::chrono::steady_clock::now();
+        m_thread = std::thread(&SessionReplay::ReplayLoop, this, options);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void SessionReplay::Stop()
+    {
+        m_stopRequested = true;
+        Wait();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Wait
+    void SessionReplay::Wait()
+    {
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetReplayRateFps
+    double SessionReplay::GetReplayRateFps() const
+    {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+        return (seconds > 0.0) ? static_cast<double>(GetReplayedFrames()) / seconds : 0.0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReplayLoop
+    void SessionReplay::ReplayLoop(ReplayOptions options)
+    {
+        m_arena.ApplyThreadPlacement(ThreadRole::Producer);
+
+        const uint64_t total = m_header.frameCount;
+        const size_t copyBytes = static_cast<size_t>(std::min<uint64_t>(m_arena.GetPayloadSize(), m_header.payloadSize));
+        const bool paced = (options.pace != ReplayPace::AsFastAsPossible);
+        const double scale = (options.pace == ReplayPace::Scaled && options.rate > 0.0) ? 1.0 / options.rate : 1.0;
+
+        // 타임스탬프(ns)가 기록되지 않은 세션은 고정 프레임 간격으로 재생
+        const bool hasTimestamps = total > 1 && m_index[total - 1].timestamp > m_index[0].timestamp;
+
+        for (size_t loop = 0; total > 0 && (options.loops == 0 || loop < options.loops); ++loop)
+        {
+            const auto loopStart = std::chrono::steady_clock::now();
+            m_prefetchedUntil = 0;
+
+            for (uint64_t frame = 0; frame < total; ++frame)
+            {
+                if (m_stopRequested) break;
+
+                PrefetchAhead(frame);
+
+                // 1. Pacing: 목표 시각 1ms 전까지는 잠들고, 나머지는 양보하며 정밀 대기
+                if (paced)
+                {
+                    uint64_t offsetNs = hasTimestamps ? (m_index[frame].timestamp - m_index[0].timestamp)
+                                                      : frame * kDefaultFrameIntervalNs;
+                    auto target = loopStart + std::chrono::nanoseconds(static_cast<int64_t>(offsetNs * scale));
+
+                    while (!m_stopRequested)
+                    {
+                        auto remaining = target - std::chrono::steady_clock::now();
+                        if (remaining <= std::chrono::nanoseconds(0)) break;
+
+                        if (remaining > std::chrono::milliseconds(1))
+                        {
+                            std::this_thread::sleep_for(remaining - std::chrono::milliseconds(1));
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+                // 2. Back-pressure: 가장 느린 소비자가 슬롯을 반납할 때까지 대기
+                size_t slot = 0;
+                while (!m_arena.TryClaimWrite(slot))
+                {
+                    if (m_stopRequested) break;
+                    m_blockedClaims.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                }
+                if (m_stopRequested) break;
+
+                // 3. 헤더 복원 + 페이로드 공급 (복사 또는 매핑 직접 연결)
+                //    timestamp/frameIndex는 CommitWrite가 발행 시각/순번으로 기록 (녹화 시각은 Pacing에만 사용)
+                const RecordIndexEntry& entry = m_index[frame];
+                auto* header = static_cast<PacketHeader*>(m_arena.GetHeader(slot));
+                if (header && m_arena.GetHeaderSize() >= sizeof(PacketHeader))
+                {
+                    header->channelCount = entry.channelCount;
+                    header->sampleDepth = entry.sampleDepth;
+                    header->flags = entry.flags & ~kPacketFlagChecksum;   // 체크섬은 Commit 시 다시 계산
+                }
+
+                if (options.zeroCopy)
+                {
+                    m_arena.BindExternalPayload(slot, const_cast<uint8_t*>(FramePayload(frame)));
+                }
+                else
+                {
+                    m_arena.WritePayload(slot, FramePayload(frame), copyBytes);
+                }
+
+                m_arena.CommitWrite();
+                m_replayedFrames.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if (m_stopRequested) break;
+        }
+
+        m_finished.store(true, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PrefetchAhead
+    void SessionReplay::PrefetchAhead(uint64_t frame)
+    {
+        // 창의 절반을 소비했을 때 다음 창을 미리 읽어 페이지 폴트를 재생 경로 밖으로 밀어냄
+        if (frame + kReadAheadFrames / 2 < m_prefetchedUntil) return;
+
+        uint64_t first = std::max(frame, m_prefetchedUntil);
+        uint64_t last = std::min<uint64_t>(m_header.frameCount, frame + kReadAheadFrames);
+        if (first >= last) return;
+
+        WIN32_MEMORY_RANGE_ENTRY range{};
+        range.VirtualAddress = const_cast<uint8_t*>(FramePayload(first));
+        range.NumberOfBytes = static_cast<SIZE_T>(m_index[last - 1].fileOffset + m_header.payloadStride - m_index[first].fileOffset);
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+        m_prefetchedUntil = last;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CloseMapping
+    void SessionReplay::CloseMapping()
+    {
+        if (m_base) UnmapViewOfFile(m_base);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+
+        m_base = nullptr;
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+        m_index = nullptr;
+    }
+
+} // namespace AdaptiveArena
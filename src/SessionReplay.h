@@ -0,0 +1,112 @@
+#pragma once
+
+#include "UltrasoundArena.h"
+#include "RecordFormat.h"
+#include <filesystem>
+#include <thread>
+
+namespace AdaptiveArena
+{
+    /**
+     * @brief  녹화 세션 재생 속도 모드
+     */
+    enum class ReplayPace
+    {
+        Original,        ///< 기록된 타임스탬프 간격 그대로
+        Scaled,          ///< 타임스탬프 간격을 배율(rate)로 나눈 속도
+        AsFastAsPossible ///< 대기 없이 (Back-pressure만 적용)
+    };
+
+    /**
+     * @brief  재생 옵션
+     */
+    struct ReplayOptions
+    {
+        ReplayPace pace = ReplayPace::Original;
+        double rate = 1.0;          ///< Scaled 모드의 속도 배율 (2.0 = 2배속)
+        bool zeroCopy = false;      ///< 슬롯 페이로드를 파일 매핑에 직접 연결 (Copy-on-Write)
+        size_t loops = 1;           ///< 반복 재생 횟수 (0 = 정지할 때까지 무한 반복)
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  녹화된 RF 세션 파일을 메모리 매핑하여 UltrasoundArena에 프레임을 공급하는 재생 Producer입니다.
+     *         수집 장비가 없는 CI 환경에서도 실제 트래픽으로 반복 가능한 처리량/지연 측정을 할 수 있게 합니다.
+     */
+    class SessionReplay
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  arena  재생 대상 링 (녹화 파일의 페이로드 크기 이상으로 초기화되어 있어야 함)
+         * @param  path   SessionRecorder가 기록한 파일 경로
+         * @throw  std::runtime_error 파일 열기/매핑 실패, 형식 불일치, 인덱스 누락 또는 파일 밖을 가리키는 인덱스 항목이 있을 때 발생
+         */
+        SessionReplay(UltrasoundArena& arena, const std::filesystem::path& path);
+        ~SessionReplay();
+
+        SessionReplay(const SessionReplay&) = delete;
+        SessionReplay& operator=(const SessionReplay&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  재생 스레드를 시작합니다.
+         * @throw  std::runtime_error Zero-Copy를 공유 링에 요청하거나 링 페이로드가 녹화 간격보다 클 때 발생
+         */
+        void Start(const ReplayOptions& options);
+
+        /**
+         * @brief  재생을 중단하고 스레드를 정리합니다.
+         */
+        void Stop();
+
+        /**
+         * @brief  지정한 반복 횟수의 재생이 끝날 때까지 대기합니다.
+         */
+        void Wait();
+
+        bool IsFinished() const { return m_finished.load(std::memory_order_acquire); }
+        uint64_t GetFrameCount() const { return m_header.frameCount; }
+        uint64_t GetReplayedFrames() const { return m_replayedFrames.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  Back-pressure로 인해 Producer가 대기한 횟수
+         */
+        uint64_t GetBlockedClaims() const { return m_blockedClaims.load(std::memory_order_relaxed); }
+        double GetReplayRateFps() const;
+
+    private:
+        void ReplayLoop(ReplayOptions options);
+        void PrefetchAhead(uint64_t frame);
+        void CloseMapping();
+        const uint8_t* FramePayload(uint64_t frame) const { return m_base + m_index[frame].fileOffset; }
+
+    private:
+        static constexpr size_t kReadAheadFrames = 8;
+        static constexpr std::chrono::milliseconds kDrainTimeout{ 5000 };   // 소멸 시 Zero-Copy 프레임 반납 대기 한도
+        static constexpr uint64_t kDefaultFrameIntervalNs = 33333333; // 타임스탬프가 없는 녹화는 30 FPS로 간주
+
+        UltrasoundArena& m_arena;
+
+        HANDLE m_file;
+        HANDLE m_mapping;
+        uint8_t* m_base;            // Copy-on-Write 뷰 (읽기는 Zero-Copy, 소비자가 쓰면 해당 페이지만 사본 생성)
+        uint64_t m_fileSize;
+        bool m_zeroCopyUsed;
+
+        RecordFileHeader m_header;
+        const RecordIndexEntry* m_index;
+        uint64_t m_prefetchedUntil;
+
+        std::thread m_thread;
+        std::atomic<bool> m_stopRequested;
+        std::atomic<bool> m_finished;
+        std::atomic<uint64_t> m_replayedFrames;
+        std::atomic<uint64_t> m_blockedClaims;
+        std::chrono::steady_clock::time_point m_startTime;
+    };
+
+} // namespace AdaptiveArena
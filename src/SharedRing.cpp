@@ -0,0 +1,161 @@
+#define NOMINMAX
+#include "SharedRing.h"
+#include <stdexcept>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    SharedRingConsumer::SharedRingConsumer(const std::wstring& name)
+        : m_mapping(nullptr)
+        , m_event(nullptr)
+        , m_control(nullptr)
+        , m_data(nullptr)
+        , m_entry(nullptr)
+    {
+        // 1. Control 블록 (읽기/쓰기): 커서와 대기 플래그만 기록
+        m_mapping = OpenFileMappingW(FILE_MAP_READ | FILE_MAP_WRITE, FALSE, name.c_str());
+        if (!m_mapping)
+        {
+            throw std::runtime_error("Shared ring segment not found.");
+        }
+
+        m_control = static_cast<SharedRingControl*>(MapViewOfFile(m_mapping, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, kSharedControlBytes));
+        if (!m_control || m_control->magic != kSharedRingMagic || m_control->version != kSharedRingVersion)
+        {
+            Close();
+            throw std::runtime_error("Shared ring segment has an unsupported layout.");
+        }
+
+        // 2. 데이터 영역 (읽기 전용, Zero-Copy)
+        m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, static_cast<DWORD>(kSharedControlBytes),
+                                                           static_cast<SIZE_T>(m_control->totalSize - kSharedControlBytes)));
+        if (!m_data)
+        {
+            Close();
+            throw std::runtime_error("Failed to map shared ring data.");
+        }
+
+        // 3. 빈 소비자 자리 확보: 현재 Commit 위치부터 읽기 시작
+        for (size_t i = 0; i < kMaxSharedConsumers && !m_entry; ++i)
+        {
+            SharedConsumerEntry& entry = m_control->consumers[i];
+            uint32_t expected = 0;
+            if (!entry.active.compare_exchange_strong(expected, 2)) continue; // 2 = 초기화 중 (Producer가 아직 게이팅하지 않음)
+
+            uint64_t start = m_control->commitIndex.load(std::memory_order_acquire);
+            entry.pid.store(GetCurrentProcessId());
+            entry.waiting.store(0);
+            entry.acquired.store(start);
+            entry.released.store(start);
+
+            // 붙는 데 시간 제한을 넘겨 Producer가 자리를 회수했으면 다음 자리로
+            expected = 2;
+            if (!entry.active.compare_exchange_strong(expected, 1, std::memory_order_seq_cst)) continue;
+
+            // 게이팅이 시작된 뒤의 Commit 위치로 재동기화 (활성화 직전에 재사용된 슬롯을 읽지 않도록)
+            start = m_control->commitIndex.load(std::memory_order_seq_cst);
+            entry.acquired.store(start);
+            entry.released.store(start);
+
+            m_entry = &entry;
+            m_event = OpenEventW(SYNCHRONIZE | EVENT_MODIFY_STATE, FALSE, SharedRingEventName(name, i).c_str());
+        }
+
+        if (!m_entry)
+        {
+            Close();
+            throw std::runtime_error("No free consumer slot in shared ring.");
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    SharedRingConsumer::~SharedRingConsumer()
+    {
+        Close();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TryAcquire
+    bool SharedRingConsumer::TryAcquire(const void*& outHeader, const void*& outPayload)
+    {
+        uint64_t next = m_entry->acquired.load(std::memory_order_relaxed);
+        if (next >= m_control->commitIndex.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        // 공유 링은 확장하지 않으므로 시퀀스 → 슬롯은 단순 모듈러
+        size_t slot = static_cast<size_t>(next % m_control->slotCount);
+        outHeader = m_data + (m_control->headersOffset - kSharedControlBytes) + slot * m_control->headerSize;
+        outPayload = m_data + (m_control->payloadsOffset - kSharedControlBytes) + slot * m_control->payloadStride;
+
+        m_entry->acquired.store(next + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Release
+    void SharedRingConsumer::Release()
+    {
+        if (m_entry->released.load(std::memory_order_relaxed) < m_entry->acquired.load(std::memory_order_relaxed))
+        {
+            m_entry->released.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WaitForFrame
+    bool SharedRingConsumer::WaitForFrame(DWORD timeoutMs)
+    {
+        auto available = [this]()
+        {
+            return m_entry->acquired.load(std::memory_order_relaxed) < m_control->commitIndex.load(std::memory_order_seq_cst);
+        };
+
+        if (available()) return true;
+        if (!m_event) return false;
+
+        // 대기 플래그를 세운 뒤 재확인 (Producer는 Commit 후 플래그를 보고 신호) → 놓친 깨움 없음
+        m_entry->waiting.store(1, std::memory_order_seq_cst);
+        if (!available())
+        {
+            WaitForSingleObject(m_event, timeoutMs);
+        }
+        m_entry->waiting.store(0, std::memory_order_relaxed);
+
+        return available();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetLag
+    size_t SharedRingConsumer::GetLag() const
+    {
+        uint64_t commit = m_control->commitIndex.load(std::memory_order_acquire);
+        uint64_t released = m_entry->released.load(std::memory_order_relaxed);
+        return (commit > released) ? static_cast<size_t>(commit - released) : 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Close
+    void SharedRingConsumer::Close()
+    {
+        // 자리 반납: 이후 Producer의 Back-pressure 계산에서 제외
+        if (m_entry)
+        {
+            m_entry->active.store(0, std::memory_order_release);
+            m_entry = nullptr;
+        }
+        if (m_event) CloseHandle(m_event);
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_control) UnmapViewOfFile(m_control);
+        if (m_mapping) CloseHandle(m_mapping);
+
+        m_event = nullptr;
+        m_data = nullptr;
+        m_control = nullptr;
+        m_mapping = nullptr;
+    }
+
+} // namespace AdaptiveArena
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <windows.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Shared-Memory Ring Layout
+    //
+    //   [SharedRingControl (64KB, 매핑 할당 단위)] [Headers (slotCount x headerSize)] [Payloads (slotCount x payloadStride)]
+    //
+    // Control 블록은 소비자 프로세스가 읽기/쓰기로, 데이터 영역은 읽기 전용으로 매핑합니다.
+
+    constexpr uint32_t kSharedRingMagic = 0x52534141;   // "AASR"
+    constexpr uint32_t kSharedRingVersion = 1;
+    constexpr size_t kSharedControlBytes = 64 * 1024;   // MapViewOfFile 오프셋 정렬 단위
+    constexpr size_t kMaxSharedConsumers = 8;
+    constexpr uint32_t kSharedAttachTimeoutMs = 1000;   // 붙는 중(2) 상태의 최대 유지 시간 (초기화 도중 종료된 소비자 회수)
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared ring cursors require address-free atomics.");
+
+    /**
+     * @brief  프로세스 외부 소비자 한 개의 커서 상태 (공유 메모리에 위치)
+     */
+    struct SharedConsumerEntry
+    {
+        std::atomic<uint32_t> active;     ///< 0 = 빈 자리, 1 = 사용 중, 2 = 붙는 중 (kSharedAttachTimeout 동안 머물면 Producer가 회수)
+        std::atomic<uint32_t> pid;        ///< 소비자 프로세스 ID (비정상 종료 감지용)
+        std::atomic<uint32_t> waiting;    ///< 1이면 Producer가 Commit 시 이벤트를 신호
+        uint32_t reserved;
+        std::atomic<uint64_t> acquired;
+        std::atomic<uint64_t> released;
+    };
+
+    /**
+     * @brief  공유 링의 형상과 커서를 담는 Control 블록
+     */
+    struct SharedRingControl
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t producerPid;
+        uint32_t reserved;
+        uint64_t headerSize;
+        uint64_t payloadSize;
+        uint64_t payloadStride;
+        uint64_t slotCount;
+        uint64_t headersOffset;
+        uint64_t payloadsOffset;
+        uint64_t totalSize;
+        std::atomic<uint64_t> commitIndex;
+        SharedConsumerEntry consumers[kMaxSharedConsumers];
+    };
+
+    static_assert(sizeof(SharedRingControl) <= kSharedControlBytes, "Shared ring control block exceeds its reserved region.");
+
+    /**
+     * @brief  공유 링의 소비자 이벤트 이름 (Producer가 생성, 소비자가 열기)
+     */
+    inline std::wstring SharedRingEventName(const std::wstring& name, size_t consumer)
+    {
+        return name + L".evt" + std::to_wstring(consumer);
+    }
+
+    /**
+     * @brief  프로세스가 아직 살아있는지 확인합니다 (종료되었거나 존재하지 않으면 false).
+     *         권한 부족(다른 사용자, 상승된 권한) 등으로 열지 못한 프로세스는 살아있는 것으로 봅니다.
+     */
+    inline bool IsProcessAlive(uint32_t pid)
+    {
+        HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, pid);
+        if (!process) return GetLastError() != ERROR_INVALID_PARAMETER;   // 해당 PID의 프로세스가 없을 때만 종료로 판단
+
+        bool alive = (WaitForSingleObject(process, 0) == WAIT_TIMEOUT);
+        CloseHandle(process);
+        return alive;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  다른 프로세스의 UltrasoundArena가 공유 메모리에 만든 링에 붙는 읽기 전용 소비자 핸들입니다.
+     *         헤더/페이로드는 복사 없이 매핑된 주소를 그대로 돌려주며, 커서만 Control 블록에 기록합니다.
+     */
+    class SharedRingConsumer
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  name  InitializeSharedRing에 지정한 세그먼트 이름
+         * @throw  std::runtime_error 세그먼트를 찾지 못하거나 형식이 다르거나 소비자 자리가 없을 때 발생
+         */
+        explicit SharedRingConsumer(const std::wstring& name);
+        ~SharedRingConsumer();
+
+        SharedRingConsumer(const SharedRingConsumer&) = delete;
+        SharedRingConsumer& operator=(const SharedRingConsumer&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  다음 프레임을 획득합니다. 반환된 포인터는 Release 전까지 유효합니다.
+         * @return bool  아직 발행된 프레임이 없으면 false
+         */
+        bool TryAcquire(const void*& outHeader, const void*& outPayload);
+
+        /**
+         * @brief  가장 오래 잡고 있던 프레임을 Producer에게 반납합니다.
+         */
+        void Release();
+
+        /**
+         * @brief  새 프레임이 발행될 때까지 이벤트로 대기합니다 (폴링 없음).
+         * @return bool  대기 후 읽을 프레임이 있으면 true
+         */
+        bool WaitForFrame(DWORD timeoutMs);
+
+        size_t GetLag() const;
+        size_t GetPayloadSize() const { return static_cast<size_t>(m_control->payloadSize); }
+
+        /**
+         * @brief  Producer 프로세스가 종료되었는지 확인합니다.
+         */
+        bool IsProducerAlive() const { return IsProcessAlive(m_control->producerPid); }
+
+    private:
+        void Close();
+
+    private:
+        HANDLE m_mapping;
+        HANDLE m_event;
+        SharedRingControl* m_control;
+        const uint8_t* m_data;      // 읽기 전용 데이터 뷰 (kSharedControlBytes 이후)
+        SharedConsumerEntry* m_entry;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,81 @@
+#define NOMINMAX
+#include "SlotScratch.h"
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    SlotScratch::SlotScratch(void* buffer, size_t capacity, std::pmr::memory_resource* upstream)
+        : m_base(static_cast<uint8_t*>(buffer))
+        , m_capacity(buffer ? capacity : 0)
+        , m_offset(0)
+        , m_overflow(upstream)
+        , m_overflowBytes(0)
+        , m_overflowCount(0)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Reset
+    size_t SlotScratch::Reset()
+    {
+        size_t used = GetUsed();
+        m_offset.store(0, std::memory_order_relaxed);
+
+        if (m_overflowBytes.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_overflowMutex);
+            m_overflow.release();
+            m_overflowBytes.store(0, std::memory_order_relaxed);
+        }
+        return used;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetUsed
+    size_t SlotScratch::GetUsed() const
+    {
+        return m_offset.load(std::memory_order_relaxed) + m_overflowBytes.load(std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // do_allocate
+    void* SlotScratch::do_allocate(size_t bytes, size_t alignment)
+    {
+        // 1. 슬롯 영역에서 포인터 증가 (여러 소비자가 동시에 할당할 수 있으므로 CAS)
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_base);
+        size_t offset = m_offset.load(std::memory_order_relaxed);
+        while (m_base)
+        {
+            size_t aligned = static_cast<size_t>(((base + offset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - base);
+            if (aligned + bytes > m_capacity || aligned + bytes < aligned) break;
+
+            if (m_offset.compare_exchange_weak(offset, aligned + bytes, std::memory_order_relaxed))
+            {
+                return m_base + aligned;
+            }
+        }
+
+        // 2. 영역 부족: 상류에서 빌림 (학습된 크기가 커지면 다음 확장/세션부터 사라짐)
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        void* p = m_overflow.allocate(bytes, alignment);
+        m_overflowBytes.fetch_add(bytes, std::memory_order_relaxed);
+        m_overflowCount.fetch_add(1, std::memory_order_relaxed);
+        return p;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // do_deallocate
+    void SlotScratch::do_deallocate(void* /*p*/, size_t /*bytes*/, size_t /*alignment*/)
+    {
+        // 단조 리소스: 개별 해제는 무시하고 슬롯 재사용 시 Reset으로 일괄 회수
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // do_is_equal
+    bool SlotScratch::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+} // namespace AdaptiveArena
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  링 슬롯 하나에 딸린 단조(Monotonic) 스크래치 메모리 리소스입니다.
+     *         슬롯 페이로드 바로 뒤의 고정 영역에서 포인터 증가만으로 할당하며, 해제는 무시하고 Reset에서 한꺼번에 되돌립니다.
+     *         영역이 부족하면 상류 리소스에서 빌린 블록(std::pmr::monotonic_buffer_resource)으로 넘어가고 초과로 집계합니다.
+     *         같은 슬롯을 읽는 여러 커서가 동시에 할당해도 안전하며, Reset은 슬롯을 재사용하는 Producer만 호출합니다.
+     */
+    class SlotScratch : public std::pmr::memory_resource
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor
+    public:
+        /**
+         * @param  buffer    스크래치 영역 (소유하지 않음)
+         * @param  upstream  영역이 부족할 때 사용할 리소스
+         */
+        SlotScratch(void* buffer, size_t capacity, std::pmr::memory_resource* upstream);
+
+        SlotScratch(const SlotScratch&) = delete;
+        SlotScratch& operator=(const SlotScratch&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  모든 할당을 되돌립니다. 이 슬롯을 사용하는 스레드가 없을 때만 호출해야 합니다.
+         * @return size_t  직전 Reset 이후 사용한 바이트 (정렬 여백과 초과분 포함)
+         */
+        size_t Reset();
+
+        void* GetBuffer() const { return m_base; }
+        size_t GetCapacity() const { return m_capacity; }
+        size_t GetUsed() const;
+        uint64_t GetOverflowCount() const { return m_overflowCount.load(std::memory_order_relaxed); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // PMR Overrides
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        uint8_t* m_base;
+        size_t m_capacity;
+        std::atomic<size_t> m_offset;
+
+        // 초과 할당 (드문 경로)
+        std::mutex m_overflowMutex;
+        std::pmr::monotonic_buffer_resource m_overflow;
+        std::atomic<size_t> m_overflowBytes;
+        std::atomic<uint64_t> m_overflowCount;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,192 @@
+#define NOMINMAX
+#include "StreamingCopy.h"
+#include <algorithm>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    StreamingCopier::StreamingCopier(size_t helperThreads, std::function<void(size_t)> threadInit)
+        : m_threadInit(std::move(threadInit))
+        , m_parts(helperThreads + 1)
+        , m_generation(0)
+        , m_computeCrc(false)
+        , m_exit(false)
+        , m_remaining(0)
+    {
+        for (size_t i = 0; i < helperThreads; ++i)
+        {
+            m_helpers.emplace_back(&StreamingCopier::HelperLoop, this, i);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    StreamingCopier::~StreamingCopier()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_exit = true;
+        }
+        m_cv.notify_all();
+
+        for (auto& helper : m_helpers)
+        {
+            if (helper.joinable()) helper.join();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Copy
+    void StreamingCopier::Copy(void* dst, const void* src, size_t length, PayloadChecksum* checksum)
+    {
+        auto* d = static_cast<uint8_t*>(dst);
+        const auto* s = static_cast<const uint8_t*>(src);
+
+        if (m_helpers.empty() || length < kParallelThreshold)
+        {
+            if (checksum)
+            {
+                // 조각마다 체크섬 → 복사: 원본은 캐시에서 두 번 읽히고, 메모리에서는 한 번만 읽힘
+                for (size_t offset = 0; offset < length; offset += kChunkBytes)
+                {
+                    size_t chunk = std::min(kChunkBytes, length - offset);
+                    checksum->Update(s + offset, chunk);
+                    StreamCopy(d + offset, s + offset, chunk);
+                }
+            }
+            else
+            {
+                StreamCopy(d, s, length);
+            }
+            return;
+        }
+
+        // 1. 4KB 경계로 분할 (보조 스레드 몫 + 호출 스레드 몫)
+        //    몫은 올림으로 계산해야 조각 합이 length를 덮음 (마지막 조각은 짧거나 비어 있을 수 있음)
+        const size_t partCount = m_parts.size();
+        const size_t partBytes = ((length + partCount - 1) / partCount + 4095) & ~size_t(4095);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            size_t offset = 0;
+            for (size_t i = 0; i < partCount; ++i)
+            {
+                size_t bytes = std::min(partBytes, length - std::min(offset, length));
+                m_parts[i] = Part{ d + offset, s + offset, bytes, 0 };
+                offset += bytes;
+            }
+            m_computeCrc = (checksum != nullptr);
+            m_remaining.store(m_helpers.size(), std::memory_order_relaxed);
+            ++m_generation;
+        }
+        m_cv.notify_all();
+
+        // 2. 마지막 조각은 호출 스레드가 처리
+        Part& own = m_parts.back();
+        own.crc = CopyPart(own.dst, own.src, own.length, checksum != nullptr, 0);
+
+        // 3. 보조 스레드 완료 대기 (각자 SFENCE 후 완료 표시)
+        while (m_remaining.load(std::memory_order_acquire) > 0)
+        {
+            std::this_thread::yield();
+        }
+
+        if (checksum)
+        {
+            for (const Part& part : m_parts)
+            {
+                checksum->Append(part.crc, part.length);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // HelperLoop
+    void StreamingCopier::HelperLoop(size_t helper)
+    {
+        if (m_threadInit) m_threadInit(helper);
+
+        uint64_t seen = 0;
+        while (true)
+        {
+            Part part{};
+            bool computeCrc = false;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&]() { return m_exit || m_generation != seen; });
+                if (m_exit) return;
+
+                seen = m_generation;
+                part = m_parts[helper];
+                computeCrc = m_computeCrc;
+            }
+
+            uint32_t crc = CopyPart(part.dst, part.src, part.length, computeCrc, 0);
+            m_parts[helper].crc = crc;
+
+            // Non-Temporal 저장은 일반 release 순서에 포함되지 않으므로 이 스레드에서 직접 SFENCE
+            _mm_sfence();
+            m_remaining.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CopyPart
+    uint32_t StreamingCopier::CopyPart(uint8_t* dst, const uint8_t* src, size_t length, bool computeCrc, uint32_t crc)
+    {
+        for (size_t offset = 0; offset < length; offset += kChunkBytes)
+        {
+            size_t chunk = std::min(kChunkBytes, length - offset);
+            if (computeCrc)
+            {
+                crc = Crc32c::Extend(crc, src + offset, chunk);
+            }
+            StreamCopy(dst + offset, src + offset, chunk);
+        }
+        return crc;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // StreamCopy
+    void StreamingCopier::StreamCopy(void* dst, const void* src, size_t length)
+    {
+        auto* d = static_cast<uint8_t*>(dst);
+        const auto* s = static_cast<const uint8_t*>(src);
+
+        // 1. 목적지를 16바이트 경계로 맞춤 (슬롯 페이로드는 4KB 정렬이므로 보통 생략됨)
+        size_t head = std::min(length, (16 - (reinterpret_cast<uintptr_t>(d) & 15)) & 15);
+        std::memcpy(d, s, head);
+        d += head;
+        s += head;
+        length -= head;
+
+        // 2. 캐시 라인(64B) 단위 Streaming Store
+        while (length >= 64)
+        {
+            __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+            __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16));
+            __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32));
+            __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d), v0);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), v1);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), v2);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), v3);
+            d += 64;
+            s += 64;
+            length -= 64;
+        }
+        while (length >= 16)
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d), _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+            d += 16;
+            s += 16;
+            length -= 16;
+        }
+
+        // 3. 나머지
+        std::memcpy(d, s, length);
+    }
+
+} // namespace AdaptiveArena
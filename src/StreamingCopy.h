@@ -0,0 +1,82 @@
+#pragma once
+
+#include "PayloadIntegrity.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  Non-Temporal(Streaming) 저장으로 링 페이로드를 채우는 복사기입니다.
+     *         목적지를 캐시에 올리지 않으므로 수 MB 프레임을 써도 소비자의 LLC 작업 집합을 밀어내지 않습니다.
+     *         큰 프레임은 보조 스레드와 나누어 복사하며, 체크섬이 필요하면 원본을 읽는 김에 함께 계산합니다.
+     *         단일 Producer 스레드에서만 호출해야 합니다.
+     */
+    class StreamingCopier
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  helperThreads  보조 스레드 수 (0이면 호출 스레드만 사용)
+         * @param  threadInit     각 보조 스레드가 시작할 때 호출 (코어 고정 등, 인자는 보조 스레드 번호)
+         */
+        explicit StreamingCopier(size_t helperThreads = 0, std::function<void(size_t)> threadInit = nullptr);
+        ~StreamingCopier();
+
+        StreamingCopier(const StreamingCopier&) = delete;
+        StreamingCopier& operator=(const StreamingCopier&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  src를 dst로 Non-Temporal 복사합니다.
+         *         보조 스레드의 저장은 반환 전에 SFENCE로 완료되며, 호출 스레드의 저장은 호출자가 SFENCE 해야 합니다 (CommitWrite).
+         * @param  checksum  nullptr이 아니면 복사한 범위의 체크섬을 이어서 반영
+         */
+        void Copy(void* dst, const void* src, size_t length, PayloadChecksum* checksum);
+
+        size_t GetHelperCount() const { return m_helpers.size(); }
+
+        /**
+         * @brief  단일 스레드 Non-Temporal 복사 (SFENCE 없음)
+         */
+        static void StreamCopy(void* dst, const void* src, size_t length);
+
+    private:
+        struct Part
+        {
+            uint8_t* dst;
+            const uint8_t* src;
+            size_t length;
+            uint32_t crc;
+        };
+
+        void HelperLoop(size_t helper);
+        static uint32_t CopyPart(uint8_t* dst, const uint8_t* src, size_t length, bool computeCrc, uint32_t crc);
+
+    private:
+        static constexpr size_t kParallelThreshold = 1024 * 1024;   // 이보다 작은 프레임은 분할 비용이 더 큼
+        static constexpr size_t kChunkBytes = 64 * 1024;            // 체크섬 → 복사 교대 단위 (원본이 L2에 남아 있는 크기)
+
+        std::function<void(size_t)> m_threadInit;
+        std::vector<std::thread> m_helpers;
+        std::vector<Part> m_parts;
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        uint64_t m_generation;
+        bool m_computeCrc;
+        bool m_exit;
+        std::atomic<size_t> m_remaining;
+    };
+
+} // namespace AdaptiveArena
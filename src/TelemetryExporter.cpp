@@ -0,0 +1,504 @@
+#define NOMINMAX
+#include "TelemetryExporter.h"
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32.lib")
+#endif
+
+namespace AdaptiveArena
+{
+    namespace
+    {
+        constexpr int kPollIntervalMs = 100;   // 정지 요청 확인 주기 (select 대기 상한)
+
+        // Prometheus 레이블 값 / JSON 문자열 이스케이프
+        std::string EscapeLabel(const char* text)
+        {
+            std::string out;
+            for (const char* c = text; *c; ++c)
+            {
+                if (*c == '\\' || *c == '"') out += '\\';
+                if (*c == '\n') { out += "\\n"; continue; }
+                out += *c;
+            }
+            return out;
+        }
+
+        std::string EscapeJson(const char* text)
+        {
+            std::string out;
+            for (const char* c = text; *c; ++c)
+            {
+                const unsigned char ch = static_cast<unsigned char>(*c);
+                if (ch == '\\' || ch == '"') { out += '\\'; out += *c; }
+                else if (ch < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+                    out += escaped;
+                }
+                else out += *c;
+            }
+            return out;
+        }
+
+        void AppendFormat(std::string& out, const char* format, ...)
+        {
+            char line[512];
+            va_list args;
+            va_start(args, format);
+            const int length = std::vsnprintf(line, sizeof(line), format, args);
+            va_end(args);
+            if (length > 0) out.append(line, std::min<size_t>(static_cast<size_t>(length), sizeof(line) - 1));
+        }
+
+        void AppendMetric(std::string& out, const char* name, const char* type, const char* help, double value)
+        {
+            AppendFormat(out, "# HELP %s %s\n# TYPE %s %s\n%s %.17g\n", name, help, name, type, name, value);
+        }
+
+        void AppendHeader(std::string& out, const char* name, const char* type, const char* help)
+        {
+            AppendFormat(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+        }
+
+        size_t StageCount(const TelemetrySnapshot& snapshot)
+        {
+            return std::min<size_t>(static_cast<size_t>(snapshot.stageCount), kMaxTelemetryStages);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    TelemetryExporter::TelemetryExporter(const Resource& source, const ExporterOptions& options)
+        : m_source(source)
+        , m_options(options)
+        , m_listenSocket(static_cast<uintptr_t>(INVALID_SOCKET))
+        , m_winsockStarted(false)
+        , m_boundPort(0)
+        , m_stopRequested(false)
+        , m_scrapes(0)
+        , m_lines(0)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    TelemetryExporter::~TelemetryExporter()
+    {
+        Stop();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void TelemetryExporter::Start()
+    {
+        if (m_thread.joinable()) return;
+
+        // 1. JSON-lines 파일 (이어쓰기)
+        if (!m_options.jsonLinesPath.empty())
+        {
+            m_jsonFile.open(m_options.jsonLinesPath, std::ios::out | std::ios::app);
+            if (!m_jsonFile)
+            {
+                throw std::runtime_error("Failed to open telemetry JSON-lines file: " + m_options.jsonLinesPath.string());
+            }
+        }
+
+        // 2. HTTP 엔드포인트 (바인딩 실패는 호출자에게 즉시)
+        if (m_options.port != 0)
+        {
+            WSADATA wsaData;
+            if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+            {
+                Stop();
+                throw std::runtime_error("Failed to initialize Winsock for the telemetry exporter.");
+            }
+            m_winsockStarted = true;
+
+            SOCKET listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(m_options.port);
+            if (listener == INVALID_SOCKET ||
+                inet_pton(AF_INET, m_options.bindAddress.c_str(), &address.sin_addr) != 1 ||
+                bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+                listen(listener, 8) != 0)
+            {
+                if (listener != INVALID_SOCKET) closesocket(listener);
+                Stop();
+                throw std::runtime_error("Failed to bind telemetry exporter to " + m_options.bindAddress + ":" + std::to_string(m_options.port) + ".");
+            }
+            m_listenSocket = static_cast<uintptr_t>(listener);
+            m_boundPort = m_options.port;
+        }
+
+        m_stopRequested.store(false, std::memory_order_relaxed);
+        m_thread = std::thread(&TelemetryExporter::ExporterLoop, this);
+
+        std::cout << "[Internal] Telemetry exporter started";
+        if (m_boundPort) std::cout << " (http://" << m_options.bindAddress << ":" << m_boundPort << "/metrics)";
+        if (m_jsonFile.is_open()) std::cout << " (JSON-lines: " << m_options.jsonLinesPath.string() << ")";
+        std::cout << "." << std::endl;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void TelemetryExporter::Stop()
+    {
+        if (m_thread.joinable())
+        {
+            m_stopRequested.store(true, std::memory_order_relaxed);
+            m_cv.notify_all();
+            m_thread.join();
+        }
+
+        if (m_listenSocket != static_cast<uintptr_t>(INVALID_SOCKET))
+        {
+            closesocket(static_cast<SOCKET>(m_listenSocket));
+            m_listenSocket = static_cast<uintptr_t>(INVALID_SOCKET);
+        }
+        if (m_winsockStarted)
+        {
+            WSACleanup();
+            m_winsockStarted = false;
+        }
+        if (m_jsonFile.is_open()) m_jsonFile.close();
+        m_boundPort = 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ExporterLoop
+    void TelemetryExporter::ExporterLoop()
+    {
+        // 측정 대상(할당/링 스레드)보다 뒤로
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+        auto nextLine = std::chrono::steady_clock::now();
+        while (!m_stopRequested.load(std::memory_order_relaxed))
+        {
+            // 1. JSON-lines 주기
+            if (m_jsonFile.is_open() && std::chrono::steady_clock::now() >= nextLine)
+            {
+                AppendJsonLine();
+                nextLine += std::max(m_options.jsonInterval, std::chrono::milliseconds(1));
+                const auto now = std::chrono::steady_clock::now();
+                if (nextLine < now) nextLine = now + m_options.jsonInterval;
+            }
+
+            // 2. 다음 할 일까지 대기 (최대 kPollIntervalMs, 그 사이 들어온 연결은 하나씩 처리)
+            auto wait = std::chrono::milliseconds(kPollIntervalMs);
+            if (m_jsonFile.is_open())
+            {
+                const auto untilLine = std::chrono::duration_cast<std::chrono::milliseconds>(nextLine - std::chrono::steady_clock::now());
+                wait = std::max(std::chrono::milliseconds(0), std::min(wait, untilLine));
+            }
+
+            if (m_listenSocket == static_cast<uintptr_t>(INVALID_SOCKET))
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait_for(lock, wait, [this]() { return m_stopRequested.load(std::memory_order_relaxed); });
+                continue;
+            }
+
+            const SOCKET listener = static_cast<SOCKET>(m_listenSocket);
+            fd_set readable;
+            FD_ZERO(&readable);
+            FD_SET(listener, &readable);
+            timeval timeout;
+            timeout.tv_sec = static_cast<long>(wait.count() / 1000);
+            timeout.tv_usec = static_cast<long>((wait.count() % 1000) * 1000);
+            if (select(static_cast<int>(listener + 1), &readable, nullptr, nullptr, &timeout) <= 0) continue;
+
+            SOCKET client = accept(listener, nullptr, nullptr);
+            if (client == INVALID_SOCKET) continue;
+            ServeClient(static_cast<uintptr_t>(client));
+            closesocket(client);
+        }
+
+        // 정지 시 마지막 한 줄
+        if (m_jsonFile.is_open()) AppendJsonLine();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ServeClient
+    void TelemetryExporter::ServeClient(uintptr_t clientHandle)
+    {
+        const SOCKET client = static_cast<SOCKET>(clientHandle);
+
+        // 1. 요청 헤더 수신 (크기/시간 상한: 느린 클라이언트가 Exporter를 붙잡지 못하도록)
+        const DWORD timeoutMs = kRequestTimeoutMs;
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeoutMs), sizeof(timeoutMs));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeoutMs), sizeof(timeoutMs));
+
+        std::string request;
+        char buffer[512];
+        while (request.size() < kMaxRequestBytes && request.find("\r\n\r\n") == std::string::npos)
+        {
+            const int received = recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0) break;
+            request.append(buffer, static_cast<size_t>(received));
+        }
+
+        // 2. GET /metrics (Prometheus), GET /series?name=&seconds=&points= (시계열 JSON)
+        std::string status = "200 OK";
+        std::string contentType = "text/plain; version=0.0.4; charset=utf-8";
+        std::string body;
+        const size_t targetEnd = request.find(' ', 4);
+        const std::string target = (request.compare(0, 4, "GET ") == 0 && targetEnd != std::string::npos) ? request.substr(4, targetEnd - 4) : std::string();
+        const std::string path = target.substr(0, target.find('?'));
+        if (request.compare(0, 4, "GET ") != 0)
+        {
+            status = "405 Method Not Allowed";
+            body = "Only GET is supported.\n";
+        }
+        else if (path == "/metrics")
+        {
+            body = FormatPrometheus(ReadSnapshot());
+            m_scrapes.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (path == "/series")
+        {
+            if (FormatSeries(target, body))
+            {
+                contentType = "application/json";
+            }
+            else
+            {
+                status = "400 Bad Request";
+            }
+        }
+        else
+        {
+            status = "404 Not Found";
+            body = "Metrics are served at /metrics and /series.\n";
+        }
+
+        std::string response = "HTTP/1.1 " + status + "\r\nContent-Type: " + contentType + "\r\nContent-Length: " + 
+                               std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+
+        // 3. 응답 송신
+        size_t sent = 0;
+        while (sent < response.size())
+        {
+            const int chunk = send(client, response.data() + sent, static_cast<int>(response.size() - sent), 0);
+            if (chunk <= 0) break;
+            sent += static_cast<size_t>(chunk);
+        }
+        shutdown(client, SD_SEND);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FormatSeries
+    bool TelemetryExporter::FormatSeries(const std::string& target, std::string& body) const
+    {
+        // 쿼리: name (필수), seconds (기본 3600), points (기본 300, 최대 kMaxSeriesPoints)
+        std::string name;
+        uint64_t seconds = 3600;
+        size_t points = 300;
+        const size_t query = target.find('?');
+        size_t position = (query == std::string::npos) ? target.size() : query + 1;
+        while (position < target.size())
+        {
+            size_t end = target.find('&', position);
+            if (end == std::string::npos) end = target.size();
+            const std::string pair = target.substr(position, end - position);
+            const size_t equals = pair.find('=');
+            if (equals != std::string::npos)
+            {
+                const std::string key = pair.substr(0, equals);
+                const std::string value = pair.substr(equals + 1);
+                if (key == "name") name = value;
+                else if (key == "seconds") seconds = std::strtoull(value.c_str(), nullptr, 10);
+                else if (key == "points") points = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+            }
+            position = end + 1;
+        }
+
+        TelemetrySeries series;
+        if (!TelemetryTimeSeries::FindSeries(name.c_str(), series))
+        {
+            body = "Unknown series. Use name=";
+            for (size_t s = 0; s < TelemetryTimeSeries::kSeriesCount; ++s)
+            {
+                body += (s == 0 ? "" : "|");
+                body += TelemetryTimeSeries::GetSeriesName(static_cast<TelemetrySeries>(s));
+            }
+            body += "\n";
+            return false;
+        }
+
+        // 오른쪽 끝은 마지막 샘플 시각
+        const uint64_t nowNs = m_source.GetTelemetry().timestampNs;
+        const uint64_t windowNs = std::min<uint64_t>(seconds, 7 * 24 * 3600) * 1000000000ull;
+        std::vector<SeriesPoint> result;
+        if (nowNs > 0)
+        {
+            m_source.QueryTelemetrySeries(series, nowNs > windowNs ? nowNs - windowNs : 0, nowNs, 
+                                          std::min(std::max<size_t>(points, 1), kMaxSeriesPoints), result);
+        }
+
+        body.clear();
+        body.reserve(64 + result.size() * 96);
+        AppendFormat(body, "{\"series\":\"%s\",\"now_ns\":%llu,\"points\":[", name.c_str(), static_cast<unsigned long long>(nowNs));
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            const SeriesPoint& point = result[i];
+            AppendFormat(body, "%s[%llu,%.6g,%.6g,%.6g,%u]", i == 0 ? "" : ",", static_cast<unsigned long long>(point.timestampNs), 
+                         point.min, point.max, point.mean, point.samples);
+        }
+        body += "]}\n";
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AppendJsonLine
+    void TelemetryExporter::AppendJsonLine()
+    {
+        m_jsonFile << FormatJsonLine(ReadSnapshot());
+        m_jsonFile.flush();
+        if (m_jsonFile) m_lines.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReadSnapshot
+    TelemetrySnapshot TelemetryExporter::ReadSnapshot() const
+    {
+        // 샘플러가 게시한 사본 (잠금 없음). 샘플러가 꺼져 있으면 직접 수집 (요청/주기당 한 번)
+        TelemetrySnapshot snapshot = m_source.GetTelemetry();
+        if (snapshot.sequence == 0) 
+        {
+            m_source.CaptureTelemetry(snapshot);
+            snapshot.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+        return snapshot;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FormatPrometheus
+    std::string TelemetryExporter::FormatPrometheus(const TelemetrySnapshot& s)
+    {
+        std::string out;
+        out.reserve(4096);
+
+        // 1. Allocator
+        AppendHeader(out, "adaptive_arena_info", "gauge", "Active workload key.");
+        AppendFormat(out, "adaptive_arena_info{workload=\"%s\"} 1\n", EscapeLabel(s.workloadKey).c_str());
+        AppendMetric(out, "adaptive_arena_telemetry_sequence", "counter", "Telemetry samples published by the sampler.", static_cast<double>(s.sequence));
+        AppendMetric(out, "adaptive_arena_usage_bytes", "gauge", "Bytes currently allocated through the arena.", static_cast<double>(s.currentUsage));
+        AppendMetric(out, "adaptive_arena_peak_bytes", "gauge", "Peak allocated bytes in the active workload period.", static_cast<double>(s.peakUsage));
+        AppendMetric(out, "adaptive_arena_predicted_bytes", "gauge", "EMA-predicted pool size.", static_cast<double>(s.predictedBytes));
+        AppendMetric(out, "adaptive_arena_allocation_latency_seconds", "gauge", "Latency of the most recent allocation.", s.lastAllocationLatencyNs * 1e-9);
+        AppendMetric(out, "adaptive_arena_checkpoints_total", "counter", "Profile checkpoints written.", static_cast<double>(s.checkpoints));
+
+        // 2. NUMA
+        AppendMetric(out, "adaptive_arena_numa_nodes", "gauge", "NUMA nodes with a pool.", static_cast<double>(s.numa.nodeCount));
+        AppendMetric(out, "adaptive_arena_numa_local_allocations_total", "counter", "Allocations served from the caller's node.", static_cast<double>(s.numa.localAllocations));
+        AppendMetric(out, "adaptive_arena_numa_remote_allocations_total", "counter", "Allocations served from another node.", static_cast<double>(s.numa.remoteAllocations));
+        AppendMetric(out, "adaptive_arena_numa_remote_bytes_total", "counter", "Bytes allocated from another node.", static_cast<double>(s.numa.remoteBytes));
+        AppendMetric(out, "adaptive_arena_numa_remote_frame_reads_total", "counter", "Frames acquired from a node other than the ring's.", static_cast<double>(s.numa.remoteFrameReads));
+
+        if (s.ringSlots == 0) return out;
+
+        // 3. Ring
+        AppendMetric(out, "adaptive_arena_ring_slots", "gauge", "Slots in rotation.", static_cast<double>(s.ringSlots));
+        AppendMetric(out, "adaptive_arena_ring_lag_frames", "gauge", "Committed frames not yet released by the slowest cursor.", static_cast<double>(s.ringLag));
+        AppendMetric(out, "adaptive_arena_ring_predicted_slots", "gauge", "Slot count recommended by the jitter model.", static_cast<double>(s.predictedSlots));
+        AppendMetric(out, "adaptive_arena_ring_throughput_bytes_per_second", "gauge", "EMA of committed payload bandwidth.", s.throughputGBs * 1024.0 * 1024.0 * 1024.0);
+        AppendMetric(out, "adaptive_arena_ring_dropped_frames_total", "counter", "Frames overwritten before every cursor consumed them.", static_cast<double>(s.droppedFrames));
+        AppendMetric(out, "adaptive_arena_ring_expansions_total", "counter", "Times the ring grew (jitter absorption or cine retention).", static_cast<double>(s.ringExpansions));
+        AppendMetric(out, "adaptive_arena_ring_retained_frames", "gauge", "Frames held in the cine retention window.", static_cast<double>(s.retainedFrames));
+        AppendMetric(out, "adaptive_arena_ring_retention_frozen", "gauge", "1 while the retention window is frozen.", s.retentionFrozen ? 1.0 : 0.0);
+        AppendMetric(out, "adaptive_arena_ring_scratch_bytes", "gauge", "Per-slot scratch size.", static_cast<double>(s.scratchBytes));
+        AppendMetric(out, "adaptive_arena_ring_scratch_overflows_total", "counter", "Scratch allocations that spilled to the arena pool.", static_cast<double>(s.scratchOverflows));
+        AppendMetric(out, "adaptive_arena_ring_cuda_active", "gauge", "1 when slots are CUDA pinned memory.", s.cudaActive ? 1.0 : 0.0);
+
+        // 4. Stages (Commit → Acquire 지연은 Summary: 분위수 + _sum/_count)
+        const size_t stages = StageCount(s);
+        if (stages == 0) return out;
+
+        AppendHeader(out, "adaptive_arena_stage_lag_frames", "gauge", "Frames handed to the stage and not yet released.");
+        for (size_t i = 0; i < stages; ++i)
+        {
+            AppendFormat(out, "adaptive_arena_stage_lag_frames{stage=\"%s\"} %llu\n", EscapeLabel(s.stages[i].name).c_str(), static_cast<unsigned long long>(s.stages[i].lag));
+        }
+        AppendHeader(out, "adaptive_arena_stage_service_seconds_avg", "gauge", "Mean Acquire to Release time.");
+        for (size_t i = 0; i < stages; ++i)
+        {
+            AppendFormat(out, "adaptive_arena_stage_service_seconds_avg{stage=\"%s\"} %.9g\n", EscapeLabel(s.stages[i].name).c_str(), s.stages[i].avgServiceUs * 1e-6);
+        }
+        AppendHeader(out, "adaptive_arena_stage_queue_latency_seconds", "summary", "Commit to Acquire latency.");
+        for (size_t i = 0; i < stages; ++i)
+        {
+            const std::string stage = EscapeLabel(s.stages[i].name);
+            const LatencyPercentiles& latency = s.stages[i].queueLatency;
+            AppendFormat(out, "adaptive_arena_stage_queue_latency_seconds{stage=\"%s\",quantile=\"0.5\"} %.9g\n", stage.c_str(), latency.p50Us * 1e-6);
+            AppendFormat(out, "adaptive_arena_stage_queue_latency_seconds{stage=\"%s\",quantile=\"0.99\"} %.9g\n", stage.c_str(), latency.p99Us * 1e-6);
+            AppendFormat(out, "adaptive_arena_stage_queue_latency_seconds{stage=\"%s\",quantile=\"0.999\"} %.9g\n", stage.c_str(), latency.p999Us * 1e-6);
+            AppendFormat(out, "adaptive_arena_stage_queue_latency_seconds{stage=\"%s\",quantile=\"1\"} %.9g\n", stage.c_str(), latency.maxUs * 1e-6);
+            AppendFormat(out, "adaptive_arena_stage_queue_latency_seconds_sum{stage=\"%s\"} %.9g\n", stage.c_str(), latency.meanUs * 1e-6 * static_cast<double>(latency.samples));
+            AppendFormat(out, "adaptive_arena_stage_queue_latency_seconds_count{stage=\"%s\"} %llu\n", stage.c_str(), static_cast<unsigned long long>(latency.samples));
+        }
+        AppendHeader(out, "adaptive_arena_stage_lost_frames_total", "counter", "Frames missing from the stage's frameIndex sequence.");
+        for (size_t i = 0; i < stages; ++i)
+        {
+            AppendFormat(out, "adaptive_arena_stage_lost_frames_total{stage=\"%s\"} %llu\n", EscapeLabel(s.stages[i].name).c_str(), static_cast<unsigned long long>(s.stages[i].lostFrames));
+        }
+        AppendHeader(out, "adaptive_arena_stage_duplicate_frames_total", "counter", "Frames the stage acquired twice.");
+        for (size_t i = 0; i < stages; ++i)
+        {
+            AppendFormat(out, "adaptive_arena_stage_duplicate_frames_total{stage=\"%s\"} %llu\n", EscapeLabel(s.stages[i].name).c_str(), static_cast<unsigned long long>(s.stages[i].duplicateFrames));
+        }
+        return out;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FormatJsonLine
+    std::string TelemetryExporter::FormatJsonLine(const TelemetrySnapshot& s)
+    {
+        std::string out;
+        out.reserve(1024);
+        AppendFormat(out, "{\"timestamp_ns\":%llu,\"sequence\":%llu,\"workload\":\"%s\"", 
+                     static_cast<unsigned long long>(s.timestampNs), static_cast<unsigned long long>(s.sequence), EscapeJson(s.workloadKey).c_str());
+        AppendFormat(out, ",\"usage_bytes\":%llu,\"peak_bytes\":%llu,\"predicted_bytes\":%llu,\"allocation_latency_ns\":%.1f,\"checkpoints\":%llu",
+                     static_cast<unsigned long long>(s.currentUsage), static_cast<unsigned long long>(s.peakUsage), 
+                     static_cast<unsigned long long>(s.predictedBytes), s.lastAllocationLatencyNs, static_cast<unsigned long long>(s.checkpoints));
+        AppendFormat(out, ",\"numa\":{\"nodes\":%llu,\"local_allocations\":%llu,\"remote_allocations\":%llu,\"remote_bytes\":%llu,\"remote_frame_reads\":%llu}",
+                     static_cast<unsigned long long>(s.numa.nodeCount), static_cast<unsigned long long>(s.numa.localAllocations), 
+                     static_cast<unsigned long long>(s.numa.remoteAllocations), static_cast<unsigned long long>(s.numa.remoteBytes), 
+                     static_cast<unsigned long long>(s.numa.remoteFrameReads));
+
+        if (s.ringSlots > 0)
+        {
+            AppendFormat(out, ",\"ring\":{\"slots\":%llu,\"lag\":%llu,\"predicted_slots\":%llu,\"throughput_gbs\":%.3f,\"dropped_frames\":%llu,\"expansions\":%llu",
+                         static_cast<unsigned long long>(s.ringSlots), static_cast<unsigned long long>(s.ringLag), 
+                         static_cast<unsigned long long>(s.predictedSlots), s.throughputGBs, static_cast<unsigned long long>(s.droppedFrames),
+                         static_cast<unsigned long long>(s.ringExpansions));
+            AppendFormat(out, ",\"retained_frames\":%llu,\"retention_frozen\":%s,\"scratch_bytes\":%llu,\"scratch_overflows\":%llu,\"cuda\":%s,\"stages\":[",
+                         static_cast<unsigned long long>(s.retainedFrames), s.retentionFrozen ? "true" : "false", 
+                         static_cast<unsigned long long>(s.scratchBytes), static_cast<unsigned long long>(s.scratchOverflows), s.cudaActive ? "true" : "false");
+            for (size_t i = 0; i < StageCount(s); ++i)
+            {
+                const StageTelemetry& stage = s.stages[i];
+                AppendFormat(out, "%s{\"name\":\"%s\",\"lag\":%llu,\"avg_service_us\":%.2f,\"queue_p50_us\":%.2f,\"queue_p99_us\":%.2f,\"queue_p999_us\":%.2f,\"queue_max_us\":%.2f,\"lost\":%llu,\"duplicates\":%llu}",
+                             i == 0 ? "" : ",", EscapeJson(stage.name).c_str(), static_cast<unsigned long long>(stage.lag), stage.avgServiceUs,
+                             stage.queueLatency.p50Us, stage.queueLatency.p99Us, stage.queueLatency.p999Us, stage.queueLatency.maxUs,
+                             static_cast<unsigned long long>(stage.lostFrames), static_cast<unsigned long long>(stage.duplicateFrames));
+            }
+            out += "]}";
+        }
+        out += "}\n";
+        return out;
+    }
+
+} // namespace AdaptiveArena
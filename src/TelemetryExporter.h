@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../include/AdaptiveArena.h"
+#include "TelemetryTimeSeries.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace AdaptiveArena
+{
+    /**
+     * @brief  헤드리스 Exporter 설정입니다.
+     */
+    struct ExporterOptions 
+    {
+        uint16_t port = 9464;                            ///< Prometheus 텍스트 엔드포인트 포트 (0이면 HTTP 끔)
+        std::string bindAddress = "127.0.0.1";           ///< 기본은 로컬 전용 (외부 수집은 에이전트/프록시 경유)
+        std::filesystem::path jsonLinesPath;             ///< JSON-lines 파일 (비어 있으면 끔, 이어쓰기)
+        std::chrono::milliseconds jsonInterval{ 1000 };  ///< JSON 한 줄을 추가하는 주기
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  GUI 없이 아레나 지표를 내보내는 Exporter입니다. 샘플러가 게시한 TelemetrySnapshot만 읽으므로 아레나 잠금을 잡지 않으며,
+     *         한 스레드(BELOW_NORMAL)가 연결을 하나씩 처리하고 요청 크기와 대기 시간에 상한을 두어 부하가 늘지 않습니다.
+     *         GET /metrics 에 Prometheus 텍스트 형식(0.0.4)으로, GET /series?name=ring_lag&seconds=3600&points=300 에
+     *         다중 해상도 시계열(JSON, 점마다 [시작 ns, min, max, mean, 샘플 수])로 응답하고, 설정 시 JSON-lines 파일에 주기적으로 한 줄씩 추가합니다.
+     */
+    class TelemetryExporter
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  source   내보낼 대상 (Exporter보다 오래 살아 있어야 함)
+         * @param  options  엔드포인트/파일 설정
+         */
+        TelemetryExporter(const Resource& source, const ExporterOptions& options);
+        ~TelemetryExporter();
+
+        TelemetryExporter(const TelemetryExporter&) = delete;
+        TelemetryExporter& operator=(const TelemetryExporter&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  소켓과 파일을 연 뒤 Exporter 스레드를 시작합니다 (실패는 호출 스레드에서 바로 보고).
+         * @throw  std::runtime_error Winsock 초기화, 바인딩, 파일 열기에 실패할 때 발생
+         */
+        void Start();
+
+        /**
+         * @brief  스레드를 정지하고 소켓과 파일을 닫습니다 (중복 호출 무시).
+         */
+        void Stop();
+
+        uint64_t GetScrapeCount() const { return m_scrapes.load(std::memory_order_relaxed); }
+        uint64_t GetLinesWritten() const { return m_lines.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  실제로 바인딩된 포트 (options.port가 0이 아닌데 바인딩 전이면 0)
+         */
+        uint16_t GetBoundPort() const { return m_boundPort; }
+
+        /**
+         * @brief  스냅샷을 Prometheus 텍스트 형식 / JSON 한 줄(개행 포함)로 변환합니다.
+         */
+        static std::string FormatPrometheus(const TelemetrySnapshot& snapshot);
+        static std::string FormatJsonLine(const TelemetrySnapshot& snapshot);
+
+        static constexpr size_t kMaxRequestBytes = 2048;
+        static constexpr int kRequestTimeoutMs = 250;
+        static constexpr size_t kMaxSeriesPoints = 2000;
+
+    private:
+        void ExporterLoop();
+        void ServeClient(uintptr_t client);
+        void AppendJsonLine();
+        bool FormatSeries(const std::string& target, std::string& body) const;
+        TelemetrySnapshot ReadSnapshot() const;
+
+    private:
+        const Resource& m_source;
+        ExporterOptions m_options;
+
+        uintptr_t m_listenSocket;   // SOCKET (헤더에 Winsock을 노출하지 않기 위해)
+        bool m_winsockStarted;
+        uint16_t m_boundPort;
+        std::ofstream m_jsonFile;
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::atomic<bool> m_stopRequested;
+        std::thread m_thread;
+
+        std::atomic<uint64_t> m_scrapes;
+        std::atomic<uint64_t> m_lines;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,120 @@
+#define NOMINMAX
+#include "TelemetrySampler.h"
+#include <windows.h>
+#include <algorithm>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    TelemetrySampler::TelemetrySampler(const Resource& source, size_t historyCapacity)
+        : m_source(source)
+        , m_capacity(std::max<size_t>(historyCapacity, 1))
+        , m_history(new SeqlockCell<TelemetrySnapshot>[std::max<size_t>(historyCapacity, 1)])
+        , m_published(0)
+        , m_rateHz(0.0)
+        , m_stopRequested(false)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    TelemetrySampler::~TelemetrySampler()
+    {
+        Stop();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void TelemetrySampler::Start(double hz)
+    {
+        Stop();
+        if (!(hz > 0.0)) return;
+
+        const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(1.0 / hz));
+        m_stopRequested = false;
+        m_rateHz.store(hz, std::memory_order_relaxed);
+        m_thread = std::thread(&TelemetrySampler::SamplerLoop, this, std::max(period, std::chrono::nanoseconds(1)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void TelemetrySampler::Stop()
+    {
+        if (!m_thread.joinable()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopRequested = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+        m_rateHz.store(0.0, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReadHistory
+    size_t TelemetrySampler::ReadHistory(uint64_t afterSequence, std::vector<TelemetrySnapshot>& out) const
+    {
+        const uint64_t last = m_published.load(std::memory_order_acquire);
+        if (last <= afterSequence) return 0;
+
+        // 링에 남아 있는 가장 오래된 샘플부터
+        const uint64_t first = std::max<uint64_t>(afterSequence + 1, last >= m_capacity ? last - m_capacity + 1 : 1);
+        size_t added = 0;
+        TelemetrySnapshot snapshot;
+        for (uint64_t seq = first; seq <= last; ++seq)
+        {
+            // 읽는 사이 Writer가 한 바퀴 돌아 덮어썼으면 sequence가 달라지므로 건너뜀
+            if (!m_history[seq % m_capacity].TryLoad(snapshot) || snapshot.sequence != seq) continue;
+            out.push_back(snapshot);
+            ++added;
+        }
+        return added;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SamplerLoop
+    void TelemetrySampler::SamplerLoop(std::chrono::nanoseconds period)
+    {
+        // 할당/링 스레드보다 뒤로 (관측이 측정 대상을 방해하지 않도록)
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto nextDue = std::chrono::steady_clock::now();
+        while (!m_stopRequested)
+        {
+            lock.unlock();
+            Sample();
+            lock.lock();
+
+            // 고정 주기 (수집이 밀렸으면 따라잡으려 몰아서 찍지 않고 지금부터 다시)
+            nextDue += period;
+            const auto now = std::chrono::steady_clock::now();
+            if (nextDue < now) nextDue = now;
+            m_cv.wait_until(lock, nextDue, [this]() { return m_stopRequested; });
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Sample
+    void TelemetrySampler::Sample()
+    {
+        TelemetrySnapshot snapshot;
+        m_source.CaptureTelemetry(snapshot);
+
+        const uint64_t sequence = m_published.load(std::memory_order_relaxed) + 1;
+        snapshot.sequence = sequence;
+        snapshot.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+
+        // 이력 먼저, 그다음 최신 값과 번호 게시 (번호를 본 Reader는 해당 이력 칸도 볼 수 있음)
+        m_history[sequence % m_capacity].Store(snapshot);
+        m_latest.Store(snapshot);
+        m_published.store(sequence, std::memory_order_release);
+
+        // 장기 이력 (고정 메모리, 게시 후 반영하므로 관측자의 최신 값 지연과 무관)
+        m_series.Append(snapshot);
+    }
+
+} // namespace AdaptiveArena
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../include/AdaptiveArena.h"
+#include "Seqlock.h"
+#include "TelemetryTimeSeries.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  고정 주기로 TelemetrySnapshot을 수집해 Seqlock으로 게시하는 샘플러입니다.
+     *         수집(CaptureTelemetry)은 샘플러 스레드에서만 일어나므로 관측자 수나 화면 주사율과 무관하게
+     *         아레나 잠금은 샘플당 한 번만 잡히고, 관측자는 잠금 없이 최신 사본과 이력 링을 읽습니다.
+     */
+    class TelemetrySampler
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  source           수집 대상 (샘플러보다 오래 살아 있어야 함)
+         * @param  historyCapacity  이력 링에 보관할 샘플 수
+         */
+        explicit TelemetrySampler(const Resource& source, size_t historyCapacity = kDefaultHistoryCapacity);
+        ~TelemetrySampler();
+
+        TelemetrySampler(const TelemetrySampler&) = delete;
+        TelemetrySampler& operator=(const TelemetrySampler&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  주어진 주기로 샘플링을 (다시) 시작합니다 (대상이 완전히 생성된 뒤 호출).
+         * @param  hz  초당 샘플 수 (0 이하이면 정지)
+         */
+        void Start(double hz);
+
+        /**
+         * @brief  샘플러 스레드를 정지합니다. 대상이 파괴되기 전에 호출해야 합니다 (중복 호출 무시, 게시된 값은 유지).
+         */
+        void Stop();
+
+        /**
+         * @brief  마지막으로 게시된 사본을 반환합니다 (잠금 없음, 샘플이 없으면 sequence == 0).
+         */
+        TelemetrySnapshot GetLatest() const { return m_latest.Load(); }
+
+        /**
+         * @brief  afterSequence 이후의 샘플을 오래된 순서로 out에 추가합니다 (링에서 이미 덮어쓴 샘플은 건너뜀).
+         * @return size_t  추가한 샘플 수
+         */
+        size_t ReadHistory(uint64_t afterSequence, std::vector<TelemetrySnapshot>& out) const;
+
+        /**
+         * @brief  샘플러가 채우는 다중 해상도 시계열을 조회합니다 (TelemetryTimeSeries::Query 참고).
+         */
+        size_t QuerySeries(TelemetrySeries series, uint64_t fromNs, uint64_t toNs, size_t maxPoints, std::vector<SeriesPoint>& out) const 
+        {
+            return m_series.Query(series, fromNs, toNs, maxPoints, out);
+        }
+
+        uint64_t GetSampleCount() const { return m_published.load(std::memory_order_acquire); }
+        double GetRate() const { return m_rateHz.load(std::memory_order_relaxed); }
+
+        static constexpr size_t kDefaultHistoryCapacity = 1024;
+
+    private:
+        void SamplerLoop(std::chrono::nanoseconds period);
+        void Sample();
+
+    private:
+        const Resource& m_source;
+        const size_t m_capacity;
+
+        SeqlockCell<TelemetrySnapshot> m_latest;
+        std::unique_ptr<SeqlockCell<TelemetrySnapshot>[]> m_history;   // sequence % m_capacity
+        std::atomic<uint64_t> m_published;                              // 마지막으로 게시된 sequence
+        std::atomic<double> m_rateHz;
+        TelemetryTimeSeries m_series;                                   // 샘플마다 원본/1초/10초/1분 단계에 반영
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        bool m_stopRequested;                   // m_mutex
+        std::thread m_thread;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,233 @@
+#define NOMINMAX
+#include "TelemetryTimeSeries.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace AdaptiveArena
+{
+    namespace
+    {
+        constexpr uint64_t kSecondNs = 1000000000ull;
+
+        // 단계별 구간 폭과 보관 구간 수 (원본 4096 샘플은 20 Hz에서 약 3.4분)
+        constexpr uint64_t kTierWidthNs[TelemetryTimeSeries::kTierCount] = { 0, kSecondNs, 10 * kSecondNs, 60 * kSecondNs };
+        constexpr size_t kTierCapacity[TelemetryTimeSeries::kTierCount] = { 4096, 3600, 2160, 1440 };
+
+        const char* const kSeriesNames[TelemetryTimeSeries::kSeriesCount] = {
+            "usage_bytes", "peak_bytes", "predicted_bytes", "allocation_latency_ns",
+            "ring_slots", "ring_lag", "throughput_gbs", "dropped_frames", "queue_latency_p99_us"
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    TelemetryTimeSeries::TelemetryTimeSeries()
+    {
+        for (size_t t = 0; t < kTierCount; ++t)
+        {
+            Tier& tier = m_tiers[t];
+            tier.widthNs = kTierWidthNs[t];
+            tier.capacity = kTierCapacity[t];
+            tier.head = 0;
+            tier.size = 0;
+            tier.starts.assign(tier.capacity, 0);
+            tier.counts.assign(tier.capacity, 0);
+            tier.stats.assign(tier.capacity * kSeriesCount, Stats{ 0.0, 0.0, 0.0 });
+            tier.open = false;
+            tier.openStart = 0;
+            tier.openCount = 0;
+            tier.openStats.fill(Stats{ 0.0, 0.0, 0.0 });
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Append
+    void TelemetryTimeSeries::Append(const TelemetrySnapshot& snapshot)
+    {
+        std::array<double, kSeriesCount> values;
+        ExtractValues(snapshot, values);
+        const uint64_t now = snapshot.timestampNs;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (Tier& tier : m_tiers)
+        {
+            // 1. 원본: 샘플 하나가 구간 하나
+            if (tier.widthNs == 0)
+            {
+                Stats stats[kSeriesCount];
+                for (size_t s = 0; s < kSeriesCount; ++s) stats[s] = Stats{ values[s], values[s], values[s] };
+                CloseBucket(tier, now, 1, stats);
+                continue;
+            }
+
+            // 2. 집계 단계: 구간 경계를 넘으면 현재 구간을 닫고 새 구간 시작
+            const uint64_t start = now - now % tier.widthNs;
+            if (tier.open && start != tier.openStart)
+            {
+                CloseBucket(tier, tier.openStart, tier.openCount, tier.openStats.data());
+                tier.open = false;
+            }
+            if (!tier.open)
+            {
+                tier.open = true;
+                tier.openStart = start;
+                tier.openCount = 0;
+                for (size_t s = 0; s < kSeriesCount; ++s) tier.openStats[s] = Stats{ values[s], values[s], 0.0 };
+            }
+
+            tier.openCount++;
+            for (size_t s = 0; s < kSeriesCount; ++s)
+            {
+                Stats& stats = tier.openStats[s];
+                stats.min = std::min(stats.min, values[s]);
+                stats.max = std::max(stats.max, values[s]);
+                stats.sum += values[s];
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Query
+    size_t TelemetryTimeSeries::Query(TelemetrySeries series, uint64_t fromNs, uint64_t toNs, size_t maxPoints, std::vector<SeriesPoint>& out) const
+    {
+        const size_t s = static_cast<size_t>(series);
+        if (s >= kSeriesCount || maxPoints == 0 || fromNs > toNs) return 0;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // 1. 구간을 덮는 가장 세밀한 단계 (maxPoints 안에 들지 않으면 다음 단계, 끝까지 없으면 가장 거친 단계)
+        const Tier* chosen = nullptr;
+        size_t lo = 0, hi = 0;
+        bool includeOpen = false;
+        for (const Tier& tier : m_tiers)
+        {
+            // fromNs에 걸친 구간까지 포함 (시작이 fromNs - width 이후)
+            const uint64_t firstStart = (tier.widthNs > 0 && fromNs >= tier.widthNs) ? fromNs - tier.widthNs + 1 : (tier.widthNs > 0 ? 0 : fromNs);
+            chosen = &tier;
+            lo = LowerBound(tier, firstStart);
+            hi = LowerBound(tier, toNs == std::numeric_limits<uint64_t>::max() ? toNs : toNs + 1);
+            includeOpen = tier.open && tier.openStart <= toNs && tier.openStart + tier.widthNs > fromNs;
+
+            const size_t count = (hi - lo) + (includeOpen ? 1 : 0);
+            const bool covers = tier.size < tier.capacity || tier.starts[SlotOf(tier, 0)] <= fromNs;
+            if (covers && count <= maxPoints) break;
+        }
+
+        const size_t count = (hi - lo) + (includeOpen ? 1 : 0);
+        if (count == 0) return 0;
+
+        // 2. 출력 (필요하면 인접 구간을 group개씩 합침: min은 최소, max는 최대, mean은 샘플 수 가중)
+        const size_t group = (count + maxPoints - 1) / maxPoints;
+        const size_t before = out.size();
+        SeriesPoint merged;
+        double mergedSum = 0.0;
+        size_t inGroup = 0;
+
+        auto emit = [&](uint64_t start, uint32_t samples, const Stats& stats)
+        {
+            if (inGroup == 0)
+            {
+                merged = SeriesPoint{};
+                merged.timestampNs = start;
+                merged.min = stats.min;
+                merged.max = stats.max;
+                mergedSum = 0.0;
+            }
+            merged.min = std::min(merged.min, stats.min);
+            merged.max = std::max(merged.max, stats.max);
+            merged.samples += samples;
+            mergedSum += stats.sum;
+            if (++inGroup == group)
+            {
+                merged.mean = merged.samples ? mergedSum / merged.samples : 0.0;
+                out.push_back(merged);
+                inGroup = 0;
+            }
+        };
+
+        for (size_t i = lo; i < hi; ++i)
+        {
+            const size_t slot = SlotOf(*chosen, i);
+            emit(chosen->starts[slot], chosen->counts[slot], chosen->stats[slot * kSeriesCount + s]);
+        }
+        if (includeOpen) emit(chosen->openStart, chosen->openCount, chosen->openStats[s]);
+        if (inGroup > 0)
+        {
+            merged.mean = merged.samples ? mergedSum / merged.samples : 0.0;
+            out.push_back(merged);
+        }
+        return out.size() - before;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetSeriesName
+    const char* TelemetryTimeSeries::GetSeriesName(TelemetrySeries series)
+    {
+        const size_t s = static_cast<size_t>(series);
+        return s < kSeriesCount ? kSeriesNames[s] : "";
+    }
+
+    bool TelemetryTimeSeries::FindSeries(const char* name, TelemetrySeries& out)
+    {
+        for (size_t s = 0; s < kSeriesCount; ++s)
+        {
+            if (std::strcmp(name, kSeriesNames[s]) == 0)
+            {
+                out = static_cast<TelemetrySeries>(s);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ExtractValues
+    void TelemetryTimeSeries::ExtractValues(const TelemetrySnapshot& snapshot, std::array<double, kSeriesCount>& values)
+    {
+        double queueP99 = 0.0;
+        for (size_t i = 0; i < std::min<size_t>(static_cast<size_t>(snapshot.stageCount), kMaxTelemetryStages); ++i)
+        {
+            queueP99 = std::max(queueP99, snapshot.stages[i].queueLatency.p99Us);
+        }
+
+        values[static_cast<size_t>(TelemetrySeries::UsageBytes)] = static_cast<double>(snapshot.currentUsage);
+        values[static_cast<size_t>(TelemetrySeries::PeakBytes)] = static_cast<double>(snapshot.peakUsage);
+        values[static_cast<size_t>(TelemetrySeries::PredictedBytes)] = static_cast<double>(snapshot.predictedBytes);
+        values[static_cast<size_t>(TelemetrySeries::AllocationLatencyNs)] = snapshot.lastAllocationLatencyNs;
+        values[static_cast<size_t>(TelemetrySeries::RingSlots)] = static_cast<double>(snapshot.ringSlots);
+        values[static_cast<size_t>(TelemetrySeries::RingLag)] = static_cast<double>(snapshot.ringLag);
+        values[static_cast<size_t>(TelemetrySeries::ThroughputGBs)] = snapshot.throughputGBs;
+        values[static_cast<size_t>(TelemetrySeries::DroppedFrames)] = static_cast<double>(snapshot.droppedFrames);
+        values[static_cast<size_t>(TelemetrySeries::QueueLatencyP99Us)] = queueP99;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CloseBucket
+    void TelemetryTimeSeries::CloseBucket(Tier& tier, uint64_t start, uint32_t count, const Stats* stats)
+    {
+        // 링이 가득 차면 가장 오래된 구간을 덮어씀
+        const size_t slot = tier.head;
+        tier.starts[slot] = start;
+        tier.counts[slot] = count;
+        std::copy(stats, stats + kSeriesCount, tier.stats.begin() + slot * kSeriesCount);
+        tier.head = (tier.head + 1) % tier.capacity;
+        if (tier.size < tier.capacity) tier.size++;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // LowerBound
+    size_t TelemetryTimeSeries::LowerBound(const Tier& tier, uint64_t timestampNs)
+    {
+        // 닫힌 구간의 시작 시각은 오래된 순서로 단조 증가 (링 순서 기준 이분 탐색)
+        size_t lo = 0, hi = tier.size;
+        while (lo < hi)
+        {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (tier.starts[SlotOf(tier, mid)] < timestampNs) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+} // namespace AdaptiveArena
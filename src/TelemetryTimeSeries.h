@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../include/AdaptiveArena.h"
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  고정 메모리 다중 해상도 텔레메트리 시계열입니다. 샘플러가 스냅샷마다 Append하면 원본, 1초, 10초, 1분 단위의
+     *         단계(Tier)에 동시에 반영되며, 각 단계는 고정 크기 링이라 오래된 구간부터 덮어씁니다 (원본 약 3분, 1초 1시간, 10초 6시간, 1분 24시간).
+     *         구간마다 min/max/mean을 보관하므로 거친 해상도에서도 짧은 스파이크가 max로 남습니다.
+     */
+    class TelemetryTimeSeries
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        TelemetryTimeSeries();
+        ~TelemetryTimeSeries() = default;
+
+        TelemetryTimeSeries(const TelemetryTimeSeries&) = delete;
+        TelemetryTimeSeries& operator=(const TelemetryTimeSeries&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  스냅샷의 각 항목을 모든 단계에 반영합니다 (O(1), timestampNs는 단조 증가해야 함).
+         */
+        void Append(const TelemetrySnapshot& snapshot);
+
+        /**
+         * @brief  [fromNs, toNs] 구간을 덮는 가장 세밀한 단계를 골라 최대 maxPoints개의 점을 out에 추가합니다.
+         *         어떤 단계로도 maxPoints 안에 들지 않으면 가장 거친 단계의 인접 구간을 합쳐 줄입니다 (O(log n + maxPoints)).
+         * @return size_t  추가한 점 수
+         */
+        size_t Query(TelemetrySeries series, uint64_t fromNs, uint64_t toNs, size_t maxPoints, std::vector<SeriesPoint>& out) const;
+
+        /**
+         * @brief  시리즈 이름 (Exporter 쿼리/레이블용, 예: "ring_lag")과 역변환
+         */
+        static const char* GetSeriesName(TelemetrySeries series);
+        static bool FindSeries(const char* name, TelemetrySeries& out);
+
+        static constexpr size_t kSeriesCount = static_cast<size_t>(TelemetrySeries::Count);
+        static constexpr size_t kTierCount = 4;
+
+    private:
+        struct Stats
+        {
+            double min;
+            double max;
+            double sum;
+        };
+
+        // 단계 하나: 구간 시작 시각과 샘플 수는 모든 시리즈가 공유 (같은 스냅샷에서 함께 기록되므로)
+        struct Tier
+        {
+            uint64_t widthNs;              // 0이면 원본 (샘플마다 한 구간)
+            size_t capacity;
+            size_t head;                   // 다음에 닫힐 구간의 위치
+            size_t size;                   // 닫힌 구간 수
+            std::vector<uint64_t> starts;
+            std::vector<uint32_t> counts;
+            std::vector<Stats> stats;      // [slot * kSeriesCount + series]
+
+            // 아직 닫히지 않은 현재 구간 (원본 단계는 사용하지 않음)
+            bool open;
+            uint64_t openStart;
+            uint32_t openCount;
+            std::array<Stats, kSeriesCount> openStats;
+        };
+
+        static void ExtractValues(const TelemetrySnapshot& snapshot, std::array<double, kSeriesCount>& values);
+        static void CloseBucket(Tier& tier, uint64_t start, uint32_t count, const Stats* stats);
+
+        // 순서상 i번째(0이 가장 오래된) 닫힌 구간의 링 위치
+        static size_t SlotOf(const Tier& tier, size_t ordinal) { return (tier.head + tier.capacity - tier.size + ordinal) % tier.capacity; }
+        static size_t LowerBound(const Tier& tier, uint64_t timestampNs);
+
+    private:
+        mutable std::mutex m_mutex;   // 샘플러(초당 수십 회)와 관측자(화면 갱신 시)만 잡음
+        std::array<Tier, kTierCount> m_tiers;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,248 @@
+#define NOMINMAX
+#include "ThreadPlacement.h"
+#include <windows.h>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+namespace AdaptiveArena
+{
+    namespace
+    {
+        constexpr unsigned kMaxProcessors = 64;
+
+        uint64_t Bit(unsigned processor) { return uint64_t(1) << processor; }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    ThreadPlacer::ThreadPlacer(const ThreadPlacement& spec)
+        : m_spec(spec)
+        , m_arenaMask(0)
+        , m_telemetryMask(0)
+        , m_floatingMask(0)
+        , m_producerCore(0)
+        , m_sharedCacheLevel(0)
+    {
+        Topology topology = QueryTopology();
+
+        uint64_t allMask = 0;
+        for (uint64_t core : topology.cores) allMask |= core;
+
+        // 1. 아레나 코어 집합과 GUI/텔레메트리 코어 분리
+        if (!spec.cores.empty())
+        {
+            for (unsigned processor : spec.cores)
+            {
+                if (processor < kMaxProcessors) m_arenaMask |= Bit(processor) & allMask;
+            }
+            if (spec.isolateTelemetry) m_telemetryMask = allMask & ~m_arenaMask;
+        }
+        else
+        {
+            // 첫 물리 코어는 인터럽트/OS 작업도 몰리므로 텔레메트리에 양보
+            if (spec.isolateTelemetry && topology.cores.size() > 1) m_telemetryMask = topology.cores.front();
+            m_arenaMask = allMask & ~m_telemetryMask;
+        }
+        if (m_arenaMask == 0) m_arenaMask = allMask;
+
+        // 2. 후보 순서: 물리 코어마다 첫 논리 프로세서 → 이후 SMT 형제
+        std::vector<unsigned> candidates;
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (uint64_t core : topology.cores)
+            {
+                bool first = true;
+                for (unsigned p = 0; p < kMaxProcessors; ++p)
+                {
+                    if (!(core & m_arenaMask & Bit(p))) continue;
+                    if (first == (pass == 0)) candidates.push_back(p);
+                    first = false;
+                }
+            }
+        }
+        if (candidates.empty()) candidates.push_back(0);
+        m_producerCore = candidates.front();
+
+        // 3. 첫 소비자: 다른 물리 코어 + 공유 L2 → 다른 물리 코어 + 공유 L3 → SMT 형제 → 다음 후보
+        const uint64_t producerCore = FindMask(topology.cores, m_producerCore);
+        const uint64_t producerL2 = FindMask(topology.l2, m_producerCore);
+        const uint64_t producerL3 = FindMask(topology.l3, m_producerCore);
+
+        auto pick = [&](uint64_t allowed) -> int
+        {
+            for (unsigned p : candidates)
+            {
+                if (p != m_producerCore && (allowed & Bit(p))) return static_cast<int>(p);
+            }
+            return -1;
+        };
+
+        int firstConsumer = -1;
+        if (spec.shareProducerCache)
+        {
+            if ((firstConsumer = pick(producerL2 & ~producerCore)) >= 0) m_sharedCacheLevel = 2;
+            else if ((firstConsumer = pick(producerL3 & ~producerCore)) >= 0) m_sharedCacheLevel = 3;
+            else if ((firstConsumer = pick(producerCore)) >= 0) m_sharedCacheLevel = producerL2 ? 2 : 0;
+        }
+        if (firstConsumer < 0) firstConsumer = pick(~uint64_t(0));
+        if (firstConsumer < 0) firstConsumer = static_cast<int>(m_producerCore);   // 단일 코어
+        m_consumerCores.push_back(static_cast<unsigned>(firstConsumer));
+
+        // 4. 나머지 소비자: Producer와 L3를 공유하는 코어 우선
+        std::vector<unsigned> rest;
+        for (unsigned p : candidates)
+        {
+            if (p != m_producerCore && p != m_consumerCores.front()) rest.push_back(p);
+        }
+        std::stable_partition(rest.begin(), rest.end(), [&](unsigned p) { return (producerL3 & Bit(p)) != 0; });
+        m_consumerCores.insert(m_consumerCores.end(), rest.begin(), rest.end());
+
+        m_floatingMask = m_arenaMask & ~Bit(m_producerCore) & ~Bit(m_consumerCores.front());
+        if (m_floatingMask == 0) m_floatingMask = m_arenaMask;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Apply
+    bool ThreadPlacer::Apply(ThreadRole role, size_t ordinal, int numaNode) const
+    {
+        if (!m_spec.enabled) return false;
+
+        // 1. 역할별 Affinity
+        uint64_t mask = 0;
+        switch (role)
+        {
+        case ThreadRole::Producer:
+            mask = m_spec.pinThreads ? Bit(m_producerCore) : m_arenaMask;
+            break;
+        case ThreadRole::Consumer:
+            mask = m_spec.pinThreads ? Bit(GetConsumerCore(ordinal)) : m_arenaMask;
+            break;
+        case ThreadRole::Worker:
+        case ThreadRole::Recorder:
+            mask = m_floatingMask;
+            break;
+        case ThreadRole::Warmer:
+        {
+            mask = m_arenaMask;
+            GROUP_AFFINITY node{};
+            if (numaNode >= 0 && GetNumaNodeProcessorMaskEx(static_cast<USHORT>(numaNode), &node) && node.Group == 0)
+            {
+                // 페이로드 First-touch는 링 노드에서 해야 하므로 노드가 우선
+                uint64_t nodeMask = static_cast<uint64_t>(node.Mask);
+                mask = (m_arenaMask & nodeMask) ? (m_arenaMask & nodeMask) : nodeMask;
+            }
+            break;
+        }
+        case ThreadRole::Telemetry:
+            mask = m_telemetryMask;
+            break;
+        }
+
+        bool pinned = false;
+        if (mask != 0)
+        {
+            GROUP_AFFINITY affinity{};
+            affinity.Mask = static_cast<KAFFINITY>(mask);
+            affinity.Group = 0;
+            pinned = SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != FALSE;
+        }
+
+        // 2. 우선순위 (거부되면 한 단계씩 낮춰 시도, 모두 실패하면 현재 우선순위 유지)
+        switch (role)
+        {
+        case ThreadRole::Producer:
+        case ThreadRole::Consumer:
+            if (m_spec.realtimePriority) SetPriorityWithFallback({ THREAD_PRIORITY_TIME_CRITICAL, THREAD_PRIORITY_HIGHEST, THREAD_PRIORITY_ABOVE_NORMAL });
+            break;
+        case ThreadRole::Worker:
+            if (m_spec.realtimePriority) SetPriorityWithFallback({ THREAD_PRIORITY_HIGHEST, THREAD_PRIORITY_ABOVE_NORMAL });
+            break;
+        case ThreadRole::Recorder:
+            if (m_spec.realtimePriority) SetPriorityWithFallback({ THREAD_PRIORITY_ABOVE_NORMAL });
+            break;
+        case ThreadRole::Telemetry:
+            if (m_spec.isolateTelemetry) SetPriorityWithFallback({ THREAD_PRIORITY_BELOW_NORMAL });
+            break;
+        case ThreadRole::Warmer:
+            break;
+        }
+
+        return pinned;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // QueryTopology
+    ThreadPlacer::Topology ThreadPlacer::QueryTopology()
+    {
+        Topology topology;
+
+        DWORD length = 0;
+        GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+        std::vector<uint8_t> buffer(length);
+        if (length > 0 && GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length))
+        {
+            for (DWORD offset = 0; offset < length; )
+            {
+                const auto* info = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+                if (info->Relationship == RelationProcessorCore && info->Processor.GroupMask[0].Group == 0)
+                {
+                    topology.cores.push_back(static_cast<uint64_t>(info->Processor.GroupMask[0].Mask));
+                }
+                else if (info->Relationship == RelationCache && info->Cache.GroupMask.Group == 0 &&
+                         (info->Cache.Type == CacheUnified || info->Cache.Type == CacheData))
+                {
+                    uint64_t mask = static_cast<uint64_t>(info->Cache.GroupMask.Mask);
+                    if (info->Cache.Level == 2) topology.l2.push_back(mask);
+                    else if (info->Cache.Level == 3) topology.l3.push_back(mask);
+                }
+                offset += info->Size;
+            }
+        }
+
+        // 조회 실패: 논리 프로세서마다 코어 하나, 캐시 공유 정보 없음
+        if (topology.cores.empty())
+        {
+            DWORD count = std::min<DWORD>(std::max<DWORD>(GetActiveProcessorCount(0), 1), kMaxProcessors);
+            for (unsigned p = 0; p < count; ++p) topology.cores.push_back(Bit(p));
+        }
+        return topology;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FindMask
+    uint64_t ThreadPlacer::FindMask(const std::vector<uint64_t>& masks, unsigned processor)
+    {
+        for (uint64_t mask : masks)
+        {
+            if (mask & Bit(processor)) return mask;
+        }
+        return 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetPriorityWithFallback
+    bool ThreadPlacer::SetPriorityWithFallback(std::initializer_list<int> priorities)
+    {
+        static std::atomic<bool> warned(false);
+
+        for (int priority : priorities)
+        {
+            if (SetThreadPriority(GetCurrentThread(), priority))
+            {
+                if (priority != *priorities.begin() && !warned.exchange(true))
+                {
+                    std::cout << "[Placement] Requested thread priority denied; running at " << priority << "." << std::endl;
+                }
+                return true;
+            }
+        }
+
+        if (!warned.exchange(true))
+        {
+            std::cout << "[Placement] Thread priority change denied; keeping default priority." << std::endl;
+        }
+        return false;
+    }
+
+} // namespace AdaptiveArena
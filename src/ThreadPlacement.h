@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../include/AdaptiveArena.h"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  ThreadPlacement 명세를 프로세서/캐시 토폴로지에 맞춰 역할별 코어 배치로 풀어내고, 호출 스레드에 적용합니다.
+     *         배치는 생성 시 한 번 계산되며 이후 읽기 전용이므로 여러 스레드가 동시에 Apply 할 수 있습니다.
+     *         프로세서 그룹 0(최대 64개 논리 프로세서)만 사용합니다.
+     */
+    class ThreadPlacer
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor
+    public:
+        explicit ThreadPlacer(const ThreadPlacement& spec);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        /**
+         * @brief  호출 스레드에 역할에 맞는 Affinity와 우선순위를 적용합니다.
+         * @param  ordinal   같은 역할 내 순번 (Consumer는 단계 번호, 0이 Producer와 캐시를 공유하는 첫 소비자)
+         * @param  numaNode  Warmer가 머물러야 할 NUMA 노드 (-1이면 제한 없음)
+         * @return bool      Affinity 적용에 성공하면 true (우선순위는 가능한 만큼만 적용)
+         */
+        bool Apply(ThreadRole role, size_t ordinal = 0, int numaNode = -1) const;
+
+        unsigned GetProducerCore() const { return m_producerCore; }
+        unsigned GetConsumerCore(size_t ordinal) const { return m_consumerCores[ordinal % m_consumerCores.size()]; }
+
+        /**
+         * @brief  Producer와 첫 소비자가 공유하는 가장 가까운 캐시 레벨 (2, 3, 0이면 공유 없음)
+         */
+        int GetSharedCacheLevel() const { return m_sharedCacheLevel; }
+        uint64_t GetArenaMask() const { return m_arenaMask; }
+        uint64_t GetTelemetryMask() const { return m_telemetryMask; }
+
+    private:
+        struct Topology
+        {
+            std::vector<uint64_t> cores;   // 물리 코어별 논리 프로세서 마스크 (SMT 형제 포함)
+            std::vector<uint64_t> l2;
+            std::vector<uint64_t> l3;
+        };
+
+        static Topology QueryTopology();
+        static uint64_t FindMask(const std::vector<uint64_t>& masks, unsigned processor);
+        static bool SetPriorityWithFallback(std::initializer_list<int> priorities);
+
+    private:
+        ThreadPlacement m_spec;
+        uint64_t m_arenaMask;
+        uint64_t m_telemetryMask;
+        uint64_t m_floatingMask;             // Producer/첫 소비자 코어를 뺀 나머지 (Worker, Recorder)
+        unsigned m_producerCore;
+        std::vector<unsigned> m_consumerCores;
+        int m_sharedCacheLevel;
+    };
+
+} // namespace AdaptiveArena
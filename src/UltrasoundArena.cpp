@@ -1,8 +1,14 @@
 #define NOMINMAX
 #include "UltrasoundArena.h"
+#include "SharedRing.h"
+#include "NumaTopology.h"
 #include <windows.h> // For VirtualAlloc (Pinned Memory simulation)
+#include <xmmintrin.h>
 #include <algorithm>
 #include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
 
 namespace AdaptiveArena 
 {
@@ -11,21 +17,50 @@ namespace AdaptiveArena
     UltrasoundArena::UltrasoundArena(const std::string& secretKey, 
                                      const std::filesystem::path& logPath, 
                                      size_t hardLimit,
-                                     bool gpuDirect)
-        : InternalResource(secretKey, logPath, hardLimit)
+                                     bool gpuDirect,
+                                     const std::string& workloadKey)
+        : InternalResource(secretKey, logPath, hardLimit, workloadKey)
         , m_gpuDirect(gpuDirect)
+        , m_ringNode(-1)
+        , m_externalBindings(0)
         , m_headerSize(0)
         , m_payloadSize(0)
+        , m_payloadStride(0)
+        , m_scratchStride(0)
         , m_slotCount(0)
+        , m_initialSlots(0)
+        , m_workloadSlots(0)
         , m_writeIndex(0)
         , m_readIndex(0)
+        , m_commitIndex(0)
+        , m_sharedMapping(nullptr)
+        , m_sharedControl(nullptr)
+        , m_cursorCount(0)
+        , m_overwrittenFrames(0)
+        , m_remoteFrameReads(0)
+        , m_remoteFrameBytes(0)
+        , m_parkedCount(0)
+        , m_retentionFrames(0)
+        , m_retentionWindowNs(0)
+        , m_frozenBegin(0)
+        , m_frozenEnd(0)
+        , m_retentionEvictions(0)
+        , m_ringExpansions(0)
+        , m_retentionLimitLogged(false)
+        , m_expansionLimitLogged(false)
+        , m_copier(std::make_unique<StreamingCopier>())
+        , m_integrityCheck(false)
+        , m_integritySeed(PayloadChecksum::SeedFromKey(secretKey))
+        , m_integrityFailures(0)
         , m_totalBytesProcessed(0)
         , m_avgThroughputGBs(0.0)
+        , m_progressListener(nullptr)
     {
         // 1. Try to load CUDA
         m_cudaFuncs = CudaWrapper::LoadCudaLibrary();
 
         m_lastAdaptTime = std::chrono::steady_clock::now();
+        m_lastGovernTime = m_lastAdaptTime;
         m_lastThroughputCheck = std::chrono::steady_clock::now();
     }
 
@@ -33,35 +68,225 @@ namespace AdaptiveArena
     // Destructor
     UltrasoundArena::~UltrasoundArena() 
     {
+        // 마지막 체크포인트에 링 형상이 포함되도록 링을 정리하기 전에 기록/샘플러 스레드 정지
+        StopTelemetry();
+        StopCheckpoints();
+
+        // 스크래치 초과분은 이 아레나의 PMR 풀로 반환되므로 먼저 정리
+        m_slotStates.clear();
+
+        if (m_sharedControl) 
+        {
+            // 공유 링: 슬롯은 세그먼트 내부를 가리키므로 매핑만 해제
+            for (HANDLE event : m_sharedEvents) 
+            {
+                if (event) CloseHandle(event);
+            }
+            UnmapViewOfFile(m_sharedControl);
+            CloseHandle(m_sharedMapping);
+            for (void* p : m_sharedScratch) FreePinned(p, m_scratchStride);
+            return;
+        }
+
         for (void* p : m_headers) 
         {
             ::operator delete(p);
         }
         for (void* p : m_payloads) 
         {
-            FreePinned(p, m_payloadSize);
+            FreePinned(p, m_payloadStride);
         }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // InitializeRing
     void UltrasoundArena::InitializeRing(size_t headerSize, size_t payloadSize, size_t initialSlots) 
+    {
+        InitializeRing(headerSize, payloadSize, initialSlots, RingPrefaultOptions{});
+    }
+
+    void UltrasoundArena::InitializeRing(size_t headerSize, size_t payloadSize, size_t initialSlots, const RingPrefaultOptions& options) 
     {
         m_headerSize = headerSize;
         m_payloadSize = payloadSize;
+        RestoreRingProfile(headerSize, payloadSize);
+
+        // 페이로드 간격을 페이지 단위로 정렬 (Direct I/O 및 DMA가 슬롯을 그대로 사용할 수 있도록)
+        m_payloadStride = (payloadSize + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+
+        // 스크래치는 페이로드 할당의 뒤쪽에 이어 붙여 같은 Super-Page에서 함께 First-touch
+        m_scratchStride = ResolveScratchStride(options.scratchBytes);
+        const size_t slotBytes = m_payloadStride + m_scratchStride;
         
         // 학습된 슬롯 수가 있으면 그것을 우선 사용
         size_t predicted = m_learningEngine.GetPredictedSlotCount();
         m_slotCount = std::max(initialSlots, predicted);
+        m_initialSlots = initialSlots;
+        m_workloadSlots = m_slotCount.load();
+        const size_t slotCount = m_slotCount;
 
-        m_headers.reserve(m_slotCount);
-        m_payloads.reserve(m_slotCount);
-
-        for (size_t i = 0; i < m_slotCount; ++i) 
+        m_headers.reserve(slotCount);
+        for (size_t i = 0; i < slotCount; ++i) 
         {
             m_headers.push_back(::operator new(m_headerSize));
-            m_payloads.push_back(AllocatePinned(m_payloadSize));
         }
+
+        // 1. 페이로드 할당 + First-touch를 주 소비자 노드에 고정된 스레드들이 나누어 수행
+        // 노드 우선순위: 옵션 → Builder 바인딩 → 호출 스레드의 노드
+        if (options.numaNode >= 0) m_ringNode = options.numaNode;
+        else if (m_numaBinding >= 0) m_ringNode = m_numaBinding;
+        else m_ringNode = NumaTopology::GetCurrentNode();
+        size_t threads = options.threads ? options.threads : std::min<size_t>(NumaTopology::GetNodeProcessorCount(m_ringNode), 8);
+        threads = std::clamp<size_t>(threads, 1, std::max<size_t>(slotCount, 1));
+
+        auto startTime = std::chrono::steady_clock::now();
+        std::atomic<size_t> completed(0);
+        m_payloads.assign(slotCount, nullptr);
+
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) 
+        {
+            workers.emplace_back([this, t, threads, slotCount, slotBytes, &completed]() 
+            {
+                if (!ApplyThreadPlacement(ThreadRole::Warmer)) NumaTopology::PinCurrentThreadToNode(m_ringNode);
+                for (size_t i = t; i < slotCount; i += threads) 
+                {
+                    void* payload = AllocatePinned(slotBytes, m_ringNode);
+                    if (payload) PrefaultPages(payload, slotBytes);
+                    m_payloads[i] = payload;
+                    completed.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        // 2. 진행률 보고 (호출 스레드)
+        while (completed.load(std::memory_order_relaxed) < slotCount) 
+        {
+            if (options.progress) options.progress(completed.load(std::memory_order_relaxed), slotCount);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        for (auto& worker : workers) worker.join();
+        if (options.progress) options.progress(slotCount, slotCount);
+
+        if (std::find(m_payloads.begin(), m_payloads.end(), nullptr) != m_payloads.end()) 
+        {
+            for (void* p : m_payloads) FreePinned(p, m_payloadStride);
+            for (void* p : m_headers) ::operator delete(p);
+            m_payloads.clear();
+            m_headers.clear();
+            throw std::runtime_error("Failed to allocate ring payloads.");
+        }
+
+        auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+        std::cout << "[Ultrasound] Ring prefaulted: " << slotCount << " slots on NUMA node " << m_ringNode 
+                  << " (" << threads << " threads, " << elapsedMs << " ms)." << std::endl;
+
+        m_externalPayloads.assign(slotCount, nullptr);
+        m_slotStates.clear();
+        for (size_t i = 0; i < slotCount; ++i) 
+        {
+            m_slotStates.push_back(MakeSlotState(static_cast<uint8_t*>(m_payloads[i]) + m_payloadStride, m_scratchStride));
+        }
+
+        // 초기 배치: 시퀀스 0부터 항등 매핑
+        RingEpoch epoch{ m_writeIndex.load(), 0, std::vector<size_t>(m_slotCount) };
+        std::iota(epoch.order.begin(), epoch.order.end(), size_t(0));
+        m_epochs.assign(1, std::move(epoch));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // InitializeSharedRing
+    void UltrasoundArena::InitializeSharedRing(const std::wstring& name, size_t headerSize, size_t payloadSize, size_t slotCount) 
+    {
+        if (!m_headers.empty()) 
+        {
+            throw std::runtime_error("Ring is already initialized.");
+        }
+
+        m_headerSize = headerSize;
+        m_payloadSize = payloadSize;
+        RestoreRingProfile(headerSize, payloadSize);
+        m_payloadStride = (payloadSize + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+        m_scratchStride = ResolveScratchStride(0);
+        size_t slots = std::max(slotCount, m_learningEngine.GetPredictedSlotCount());
+        m_initialSlots = slotCount;
+        m_workloadSlots = slots;
+
+        // 1. 세그먼트 배치 계산 (Control | Headers | Payloads), 모든 영역은 페이지 정렬
+        size_t headersOffset = kSharedControlBytes;
+        size_t headersBytes = (slots * headerSize + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+        size_t payloadsOffset = headersOffset + headersBytes;
+        size_t totalSize = payloadsOffset + slots * m_payloadStride;
+        if (totalSize + slots * m_scratchStride > m_hardLimit) 
+        {
+            throw std::runtime_error("Shared ring exceeds the hard limit.");
+        }
+
+        // 2. 페이징 파일 기반 이름 있는 세그먼트 생성
+        m_sharedMapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                             static_cast<DWORD>(static_cast<uint64_t>(totalSize) >> 32),
+                                             static_cast<DWORD>(totalSize & 0xFFFFFFFFull), name.c_str());
+        if (!m_sharedMapping || GetLastError() == ERROR_ALREADY_EXISTS) 
+        {
+            if (m_sharedMapping) CloseHandle(m_sharedMapping);
+            m_sharedMapping = nullptr;
+            throw std::runtime_error("Failed to create shared ring segment (name in use?).");
+        }
+
+        auto* base = static_cast<uint8_t*>(MapViewOfFile(m_sharedMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+        if (!base) 
+        {
+            CloseHandle(m_sharedMapping);
+            m_sharedMapping = nullptr;
+            throw std::runtime_error("Failed to map shared ring segment.");
+        }
+
+        // 3. 소비자별 깨움 이벤트 (Auto-Reset)
+        m_sharedEvents.resize(kMaxSharedConsumers, nullptr);
+        for (size_t i = 0; i < kMaxSharedConsumers; ++i) 
+        {
+            m_sharedEvents[i] = CreateEventW(nullptr, FALSE, FALSE, SharedRingEventName(name, i).c_str());
+        }
+
+        // 4. Control 블록 작성 (새 세그먼트는 0으로 초기화되어 있음). magic은 마지막에 기록하여 완성된 형상만 노출
+        auto* control = reinterpret_cast<SharedRingControl*>(base);
+        control->version = kSharedRingVersion;
+        control->producerPid = GetCurrentProcessId();
+        control->headerSize = headerSize;
+        control->payloadSize = payloadSize;
+        control->payloadStride = m_payloadStride;
+        control->slotCount = slots;
+        control->headersOffset = headersOffset;
+        control->payloadsOffset = payloadsOffset;
+        control->totalSize = totalSize;
+        control->commitIndex.store(m_commitIndex.load());
+        std::atomic_thread_fence(std::memory_order_release);
+        control->magic = kSharedRingMagic;
+
+        // 5. 슬롯 포인터를 세그먼트 내부로 연결
+        std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+        for (size_t i = 0; i < slots; ++i) 
+        {
+            m_headers.push_back(base + headersOffset + i * headerSize);
+            m_payloads.push_back(base + payloadsOffset + i * m_payloadStride);
+        }
+        m_externalPayloads.assign(slots, nullptr);
+        for (size_t i = 0; i < slots; ++i) 
+        {
+            // 스크래치는 다른 프로세스에 노출할 필요가 없으므로 세그먼트 밖에 할당 (실패 시 상류 풀만 사용)
+            void* scratch = AllocatePinned(m_scratchStride, m_ringNode);
+            if (scratch) m_sharedScratch.push_back(scratch);
+            m_slotStates.push_back(MakeSlotState(scratch, m_scratchStride));
+        }
+
+        RingEpoch epoch{ m_writeIndex.load(), 0, std::vector<size_t>(slots) };
+        std::iota(epoch.order.begin(), epoch.order.end(), size_t(0));
+        m_epochs.assign(1, std::move(epoch));
+
+        m_sharedControl = control;
+        m_lastRecoveryCheck = std::chrono::steady_clock::now();
+        m_sharedAttachSince.assign(kMaxSharedConsumers, std::chrono::steady_clock::time_point{});
+        m_slotCount = slots;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,14 +295,56 @@ namespace AdaptiveArena
     {
         AdaptToJitter();
         m_totalBytesProcessed += (m_headerSize + m_payloadSize);
-        return m_writeIndex.fetch_add(1) % m_slotCount;
+        uint64_t sequence = m_writeIndex.fetch_add(1);
+
+        // Back-pressure 없이 (GetNextWriteIndex 직접 호출) 아직 해제되지 않은 슬롯을 재사용하면 유실로 집계
+        if (HasGatingConsumers() && sequence - GetSlowestReleased() >= m_slotCount.load(std::memory_order_relaxed)) 
+        {
+            m_overwrittenFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        size_t index = GetSlotForSequence(sequence);
+
+        // 슬롯의 이전 프레임에 대한 새 임대를 막음 (기존 임대는 TryClaimWrite 경로에서만 보호됨)
+        if (SlotState* state = GetSlotState(index)) 
+        {
+            state->commitNs.store(0, std::memory_order_relaxed);
+            state->sequence.store(sequence, std::memory_order_release);
+
+            // 직전 프레임의 스크래치 사용량을 학습하고 비움
+            if (state->scratch) 
+            {
+                size_t used = state->scratch->Reset();
+                if (used > 0) m_learningEngine.UpdateScratch(used);
+            }
+        }
+
+        // 재사용되는 슬롯의 이전 프레임 체크섬 무효화
+        if (m_integrityCheck && m_headerSize >= sizeof(PacketHeader)) 
+        {
+            if (auto* header = static_cast<PacketHeader*>(GetHeader(index))) 
+            {
+                header->flags &= ~kPacketFlagChecksum;
+            }
+        }
+
+        // 재사용되는 슬롯은 외부 페이로드 연결을 해제 (연결이 있을 때만 잠금)
+        if (m_externalBindings.load(std::memory_order_relaxed) > 0) 
+        {
+            std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+            if (index < m_externalPayloads.size() && m_externalPayloads[index]) 
+            {
+                m_externalPayloads[index] = nullptr;
+                m_externalBindings.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+        return index;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // GetNextReadIndex
     size_t UltrasoundArena::GetNextReadIndex() 
     {
-        return m_readIndex.fetch_add(1) % m_slotCount;
+        return GetSlotForSequence(m_readIndex.fetch_add(1));
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,10 +355,563 @@ namespace AdaptiveArena
         // However, if we wanted to ensure we are reading indices consistent with a specific buffer state, we could lock.
         // For lag calculation, atomic load is sufficient and lock-free is better for performance.
         size_t w = m_writeIndex.load();
-        size_t r = m_readIndex.load();
+        size_t r = HasGatingConsumers() ? static_cast<size_t>(GetSlowestReleased()) : m_readIndex.load();
         return (w > r) ? (w - r) : 0;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetSlotForSequence
+    size_t UltrasoundArena::GetSlotForSequence(uint64_t sequence) const 
+    {
+        std::shared_lock<std::shared_mutex> lock(m_sharedMutex);
+        if (m_epochs.empty()) return 0;
+
+        // 대부분의 시퀀스는 최신 Epoch에 속하므로 뒤에서부터 탐색
+        auto it = m_epochs.rbegin();
+        while (std::next(it) != m_epochs.rend() && it->startSequence > sequence) 
+        {
+            ++it;
+        }
+
+        const size_t position = (it->basePosition + static_cast<size_t>(sequence - it->startSequence)) % it->order.size();
+        return it->order[position];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AddCursor
+    size_t UltrasoundArena::AddCursor(const std::string& name, size_t upstream) 
+    {
+        std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+
+        size_t id = m_cursorCount.load();
+        if (id >= kMaxCursors) 
+        {
+            throw std::runtime_error("Cursor limit exceeded.");
+        }
+        if (upstream != kProducerCursor && upstream >= id) 
+        {
+            throw std::runtime_error("Upstream cursor must be registered before its downstream.");
+        }
+
+        // 늦게 합류한 커서는 상류의 현재 위치부터 시작 (과거 프레임을 재생하지 않음)
+        uint64_t start = GetUpstreamLimit(upstream);
+
+        RingCursor& cursor = m_cursors[id];
+        cursor.name = name;
+        cursor.upstream = upstream;
+        cursor.origin = start;
+        cursor.acquired.store(start);
+        cursor.released.store(start);
+        cursor.busyNs.store(0);
+        cursor.detached.store(false);
+        cursor.queueLatency = std::make_unique<LatencyHistogram>();
+        cursor.serviceLatency = std::make_unique<LatencyHistogram>();
+        cursor.lastFrameIndex.store(static_cast<uint32_t>(start - 1));
+        cursor.lostFrames.store(0);
+        cursor.gapEvents.store(0);
+        cursor.duplicateFrames.store(0);
+        cursor.lastLossNs.store(0);
+
+        m_cursorCount.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TryClaimWrite
+    bool UltrasoundArena::TryClaimWrite(size_t& outIndex) 
+    {
+        // 죽은 외부 소비자가 링을 막거나 자리를 차지하고 있을 수 있으므로 주기적으로 회수 시도
+        if (m_sharedControl) 
+        {
+            RecoverSharedConsumers();
+        }
+
+        uint64_t w = m_writeIndex.load(std::memory_order_relaxed);
+        uint64_t inFlight = w - GetSlowestReleased();
+
+        if (HasGatingConsumers() && inFlight >= m_slotCount.load()) 
+        {
+            // 링이 가득 참: 가장 느린 커서가 반납할 때까지 덮어쓰지 않음.
+            // 이때의 수요(가득 찬 깊이 + 1)를 학습시켜 다음 확장 주기에 슬롯을 늘리도록 유도합니다.
+            AdaptToJitter(static_cast<size_t>(inFlight) + 1);
+            return false;
+        }
+
+        // 보존 창/고정/임대 중인 슬롯은 재사용하지 않음
+        if (!ReclaimSlotForWrite(w)) 
+        {
+            return false;
+        }
+
+        outIndex = GetNextWriteIndex();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CommitWrite
+    void UltrasoundArena::CommitWrite() 
+    {
+        // WritePayload의 Non-Temporal 저장은 release 순서에 포함되지 않으므로 발행 전에 완료시킴
+        _mm_sfence();
+
+        // Single Producer: 예약 순서대로 발행 (헤더/페이로드 쓰기가 커서에게 보이도록 release)
+        uint64_t sequence = m_commitIndex.load(std::memory_order_relaxed);
+        if (sequence < m_writeIndex.load(std::memory_order_relaxed)) 
+        {
+            // 발행 시각 기록: 커서의 Commit → Acquire 지연 기준점
+            size_t slot = GetSlotForSequence(sequence);
+            auto* header = static_cast<PacketHeader*>(GetHeader(slot));
+            if (header && m_headerSize >= sizeof(PacketHeader)) 
+            {
+                header->timestamp = TscClock::NowNs();
+                header->frameIndex = static_cast<uint32_t>(sequence);
+
+                // Producer가 채우는 동안 계산하지 않았다면 여기서 한 번에 계산
+                if (m_integrityCheck && !(header->flags & kPacketFlagChecksum)) 
+                {
+                    PayloadChecksum checksum = BeginPayloadChecksum();
+                    checksum.Update(GetPayload(slot), m_payloadSize);
+                    header->checksum = checksum.Finalize();
+                    header->flags |= kPacketFlagChecksum;
+                }
+            }
+
+            if (SlotState* state = GetSlotState(slot)) 
+            {
+                state->commitNs.store(TscClock::NowNs(), std::memory_order_relaxed);
+            }
+
+            uint64_t committed = m_commitIndex.fetch_add(1, std::memory_order_release) + 1;
+
+            // 공유 링: 외부 소비자에게 발행하고, 대기 중인 소비자만 깨움 (불필요한 시스템 콜 회피)
+            if (m_sharedControl) 
+            {
+                m_sharedControl->commitIndex.store(committed, std::memory_order_seq_cst);
+                for (size_t i = 0; i < kMaxSharedConsumers; ++i) 
+                {
+                    const SharedConsumerEntry& entry = m_sharedControl->consumers[i];
+                    if (entry.active.load(std::memory_order_relaxed) == 1 && entry.waiting.load(std::memory_order_seq_cst)) 
+                    {
+                        SetEvent(m_sharedEvents[i]);
+                    }
+                }
+            }
+
+            if (RingProgressListener* listener = m_progressListener.load(std::memory_order_acquire)) 
+            {
+                listener->OnRingProgress();
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TryAcquire
+    bool UltrasoundArena::TryAcquire(size_t cursor, size_t& outIndex) 
+    {
+        uint64_t sequence = 0;
+        return TryAcquire(cursor, outIndex, sequence);
+    }
+
+    bool UltrasoundArena::TryAcquire(size_t cursor, size_t& outIndex, uint64_t& outSequence) 
+    {
+        if (cursor >= GetCursorCount()) return false;
+
+        RingCursor& c = m_cursors[cursor];
+        uint64_t next = c.acquired.load(std::memory_order_relaxed);
+        if (next >= GetUpstreamLimit(c.upstream)) 
+        {
+            return false;
+        }
+
+        outIndex = GetSlotForSequence(next);
+        outSequence = next;
+        c.acquired.store(next + 1, std::memory_order_relaxed);
+
+        uint64_t nowNs = TscClock::NowNs();
+        if (SlotState* state = GetSlotState(outIndex)) 
+        {
+            state->acquireNs[cursor].store(nowNs, std::memory_order_relaxed);
+        }
+
+        // Commit → Acquire: 하류 커서일수록 상류 단계의 처리 시간이 누적됨 (End-to-End)
+        const auto* header = static_cast<const PacketHeader*>(GetHeader(outIndex));
+        if (header && m_headerSize >= sizeof(PacketHeader)) 
+        {
+            if (nowNs >= header->timestamp) 
+            {
+                c.queueLatency->Record(nowNs - header->timestamp);
+            }
+            CheckFrameSequence(cursor, header->frameIndex, nowNs);
+        }
+
+        // 링 페이로드와 다른 노드에서 읽는 프레임 (Interconnect 트래픽)
+        if (m_numaPool.GetNodeCount() > 1 && NumaTopology::GetCurrentNode() != m_ringNode) 
+        {
+            m_remoteFrameReads.fetch_add(1, std::memory_order_relaxed);
+            m_remoteFrameBytes.fetch_add(m_payloadSize, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AcquireRead
+    bool UltrasoundArena::AcquireRead(size_t cursor, size_t& outIndex) 
+    {
+        uint64_t sequence = 0;
+        if (!TryAcquire(cursor, outIndex, sequence)) 
+        {
+            return false;
+        }
+
+        // 다음 프레임이 이미 발행되어 있을 때만 (발행 전 슬롯은 Producer가 곧 덮어씀)
+        if (sequence + 1 < GetUpstreamLimit(m_cursors[cursor].upstream)) 
+        {
+            size_t next = GetSlotForSequence(sequence + 1);
+            _mm_prefetch(static_cast<const char*>(GetHeader(next)), _MM_HINT_T0);
+
+            const auto* payload = static_cast<const char*>(GetPayload(next));
+            size_t lines = std::min(kPrefetchLines, (m_payloadSize + 63) / 64);
+            for (size_t i = 0; payload && i < lines; ++i) 
+            {
+                _mm_prefetch(payload + i * 64, _MM_HINT_T0);
+            }
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CheckFrameSequence
+    void UltrasoundArena::CheckFrameSequence(size_t cursor, uint32_t frameIndex, uint64_t nowNs) 
+    {
+        RingCursor& c = m_cursors[cursor];
+        uint32_t last = c.lastFrameIndex.load(std::memory_order_relaxed);
+
+        // 32-bit 순번의 Wrap-around를 고려한 부호 있는 차이
+        int32_t delta = static_cast<int32_t>(frameIndex - last);
+        if (delta == 1) 
+        {
+            c.lastFrameIndex.store(frameIndex, std::memory_order_relaxed);
+            return;
+        }
+
+        if (delta <= 0) 
+        {
+            // Producer가 커서를 앞질러 슬롯이 재순환됨: 이미 본 프레임
+            c.duplicateFrames.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Gap: 읽기 전에 덮어쓰인 프레임
+        uint32_t missing = static_cast<uint32_t>(delta - 1);
+        c.lastFrameIndex.store(frameIndex, std::memory_order_relaxed);
+        c.lostFrames.fetch_add(missing, std::memory_order_relaxed);
+        c.gapEvents.fetch_add(1, std::memory_order_relaxed);
+        c.lastLossNs.store(nowNs, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_lossMutex);
+        if (m_lossEvents.size() >= kMaxLossEvents) 
+        {
+            m_lossEvents.pop_front();
+        }
+        m_lossEvents.push_back({ nowNs, cursor, last + 1, missing });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetRecentLossEvents
+    std::vector<FrameLossEvent> UltrasoundArena::GetRecentLossEvents() const 
+    {
+        std::lock_guard<std::mutex> lock(m_lossMutex);
+        return std::vector<FrameLossEvent>(m_lossEvents.begin(), m_lossEvents.end());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Release
+    void UltrasoundArena::Release(size_t cursor) 
+    {
+        if (cursor >= GetCursorCount()) return;
+
+        RingCursor& c = m_cursors[cursor];
+        if (c.released.load(std::memory_order_relaxed) >= c.acquired.load(std::memory_order_relaxed)) 
+        {
+            return; // Acquire 없이 Release 호출 (무시)
+        }
+
+        // 여러 프레임을 동시에 들고 있는 단계(Batch, Recorder)도 있으므로 해제되는 시퀀스 자신의 Acquire 시각을 기준으로 측정
+        uint64_t nowNs = TscClock::NowNs();
+        const SlotState* state = GetSlotState(GetSlotForSequence(c.released.load(std::memory_order_relaxed)));
+        uint64_t acquiredNs = state ? state->acquireNs[cursor].load(std::memory_order_relaxed) : nowNs;
+        if (nowNs > acquiredNs) 
+        {
+            c.busyNs.fetch_add(nowNs - acquiredNs, std::memory_order_relaxed);
+            c.serviceLatency->Record(nowNs - acquiredNs);
+        }
+
+        // 하류 커서가 이 슬롯의 처리 결과를 볼 수 있도록 release
+        c.released.fetch_add(1, std::memory_order_release);
+
+        if (RingProgressListener* listener = m_progressListener.load(std::memory_order_acquire)) 
+        {
+            listener->OnRingProgress();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DetachCursor
+    void UltrasoundArena::DetachCursor(size_t cursor) 
+    {
+        if (cursor >= GetCursorCount()) return;
+        m_cursors[cursor].detached.store(true, std::memory_order_release);
+
+        // 분리된 커서가 막고 있던 Producer/하류 커서가 다시 진행할 수 있음
+        if (RingProgressListener* listener = m_progressListener.load(std::memory_order_acquire)) 
+        {
+            listener->OnRingProgress();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetProgressListener
+    void UltrasoundArena::SetProgressListener(RingProgressListener* listener) 
+    {
+        RingProgressListener* expected = nullptr;
+        if (listener && !m_progressListener.compare_exchange_strong(expected, listener, std::memory_order_acq_rel) && expected != listener) 
+        {
+            throw std::runtime_error("A ring progress listener is already registered.");
+        }
+        if (!listener) m_progressListener.store(nullptr, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetCursorTelemetry
+    RingCursorTelemetry UltrasoundArena::GetCursorTelemetry(size_t cursor) const 
+    {
+        RingCursorTelemetry t{ "", 0, 0, 0.0, {}, {}, 0, 0, 0, 0 };
+        if (cursor >= GetCursorCount()) return t;
+
+        const RingCursor& c = m_cursors[cursor];
+        uint64_t limit = GetUpstreamLimit(c.upstream);
+        t.name = c.name;
+        t.position = c.released.load(std::memory_order_acquire);
+        t.lag = (limit > t.position) ? static_cast<size_t>(limit - t.position) : 0;
+
+        uint64_t processed = t.position - c.origin;
+        if (processed > 0) 
+        {
+            t.avgServiceUs = static_cast<double>(c.busyNs.load(std::memory_order_relaxed)) / processed / 1000.0;
+        }
+        t.queueLatency = c.queueLatency->Summarize();
+        t.serviceLatency = c.serviceLatency->Summarize();
+        t.lostFrames = c.lostFrames.load(std::memory_order_relaxed);
+        t.gapEvents = c.gapEvents.load(std::memory_order_relaxed);
+        t.duplicateFrames = c.duplicateFrames.load(std::memory_order_relaxed);
+        t.lastLossNs = c.lastLossNs.load(std::memory_order_relaxed);
+        return t;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetQueueLatency
+    LatencyPercentiles UltrasoundArena::GetQueueLatency(size_t consumer) const 
+    {
+        if (consumer >= GetCursorCount()) return {};
+        return m_cursors[consumer].queueLatency->Summarize();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetServiceLatency
+    LatencyPercentiles UltrasoundArena::GetServiceLatency(size_t consumer) const 
+    {
+        if (consumer >= GetCursorCount()) return {};
+        return m_cursors[consumer].serviceLatency->Summarize();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetComputeGovernor
+    void UltrasoundArena::SetComputeGovernor(std::function<void(size_t predictedLag, size_t slotCount)> governor) 
+    {
+        std::lock_guard<std::mutex> lock(m_governorMutex);
+        m_computeGovernor = std::move(governor);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetSlowestReleased
+    uint64_t UltrasoundArena::GetSlowestReleased() const 
+    {
+        size_t count = GetCursorCount();
+        uint64_t slowest = m_writeIndex.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) 
+        {
+            if (m_cursors[i].detached.load(std::memory_order_acquire)) continue;
+            slowest = std::min(slowest, m_cursors[i].released.load(std::memory_order_acquire));
+        }
+
+        if (m_sharedControl) 
+        {
+            for (size_t i = 0; i < kMaxSharedConsumers; ++i) 
+            {
+                const SharedConsumerEntry& entry = m_sharedControl->consumers[i];
+                if (entry.active.load(std::memory_order_acquire) != 1) continue;
+                slowest = std::min(slowest, entry.released.load(std::memory_order_acquire));
+            }
+        }
+        return slowest;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // HasGatingConsumers
+    bool UltrasoundArena::HasGatingConsumers() const 
+    {
+        return GetCursorCount() > 0 || m_sharedControl != nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RecoverSharedConsumers
+    void UltrasoundArena::RecoverSharedConsumers() 
+    {
+        // 링이 가득 찬 동안에도 프로세스 조회는 100ms에 한 번만
+        auto now = std::chrono::steady_clock::now();
+        if (now - m_lastRecoveryCheck < std::chrono::milliseconds(100)) return;
+        m_lastRecoveryCheck = now;
+
+        for (size_t i = 0; i < kMaxSharedConsumers; ++i) 
+        {
+            SharedConsumerEntry& entry = m_sharedControl->consumers[i];
+            const uint32_t state = entry.active.load(std::memory_order_acquire);
+
+            // 붙는 중(2)에 멈춘 자리: PID가 아직 기록되지 않았을 수 있으므로 시간 제한으로 판단 (소비자는 2 → 1을 CAS로 전환)
+            if (state == 2) 
+            {
+                if (m_sharedAttachSince[i] == std::chrono::steady_clock::time_point{}) 
+                {
+                    m_sharedAttachSince[i] = now;
+                }
+                else if (now - m_sharedAttachSince[i] >= std::chrono::milliseconds(kSharedAttachTimeoutMs)) 
+                {
+                    uint32_t expected = 2;
+                    if (entry.active.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) 
+                    {
+                        std::cerr << "[Ultrasound] Shared consumer slot " << i << " stalled while attaching. Slot reclaimed." << std::endl;
+                    }
+                    m_sharedAttachSince[i] = {};
+                }
+                continue;
+            }
+            m_sharedAttachSince[i] = {};
+            if (state != 1) continue;
+
+            uint32_t pid = entry.pid.load();
+            if (!IsProcessAlive(pid)) 
+            {
+                // 그사이 소비자가 스스로 자리를 반납했으면 건드리지 않음
+                uint32_t expected = 1;
+                if (entry.active.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) 
+                {
+                    std::cerr << "[Ultrasound] Shared consumer (pid " << pid << ") terminated. Cursor reclaimed." << std::endl;
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetUpstreamLimit
+    uint64_t UltrasoundArena::GetUpstreamLimit(size_t upstream) const 
+    {
+        if (upstream == kProducerCursor) 
+        {
+            return m_commitIndex.load(std::memory_order_acquire);
+        }
+        return m_cursors[upstream].released.load(std::memory_order_acquire);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WritePayload
+    void UltrasoundArena::WritePayload(size_t index, const void* src, size_t length) 
+    {
+        if (length > m_payloadSize) 
+        {
+            throw std::runtime_error("Payload write exceeds slot payload size.");
+        }
+
+        void* dst = GetPayload(index);
+        if (!dst) return;
+
+        // 체크섬은 페이로드 전체를 덮을 때만 복사와 함께 계산 (부분 쓰기는 Commit 시 계산)
+        bool fusedChecksum = m_integrityCheck && length == m_payloadSize;
+        PayloadChecksum checksum = BeginPayloadChecksum();
+        m_copier->Copy(dst, src, length, fusedChecksum ? &checksum : nullptr);
+
+        if (fusedChecksum) 
+        {
+            SetPayloadChecksum(index, checksum);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetStreamingHelpers
+    void UltrasoundArena::SetStreamingHelpers(size_t helperThreads) 
+    {
+        if (m_copier->GetHelperCount() == helperThreads) return;
+        m_copier = std::make_unique<StreamingCopier>(helperThreads, [this](size_t helper) { ApplyThreadPlacement(ThreadRole::Worker, helper); });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetThreadPlacement
+    void UltrasoundArena::SetThreadPlacement(const ThreadPlacement& placement) 
+    {
+        if (!placement.enabled) 
+        {
+            m_placer.reset();
+            return;
+        }
+
+        m_placer = std::make_unique<ThreadPlacer>(placement);
+        std::cout << "[Ultrasound] Thread placement: producer CPU " << m_placer->GetProducerCore() 
+                  << ", first consumer CPU " << m_placer->GetConsumerCore(0);
+        if (m_placer->GetSharedCacheLevel() > 0) 
+        {
+            std::cout << " (shared L" << m_placer->GetSharedCacheLevel() << ")";
+        }
+        std::cout << ", telemetry mask 0x" << std::hex << m_placer->GetTelemetryMask() << std::dec << "." << std::endl;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ApplyThreadPlacement
+    bool UltrasoundArena::ApplyThreadPlacement(ThreadRole role, size_t ordinal) const 
+    {
+        return m_placer && m_placer->Apply(role, ordinal, m_ringNode);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetPayloadChecksum
+    void UltrasoundArena::SetPayloadChecksum(size_t index, const PayloadChecksum& checksum) 
+    {
+        auto* header = static_cast<PacketHeader*>(GetHeader(index));
+        if (!header || m_headerSize < sizeof(PacketHeader)) return;
+
+        header->checksum = checksum.Finalize();
+        header->flags |= kPacketFlagChecksum;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // VerifyPayload
+    bool UltrasoundArena::VerifyPayload(size_t index) 
+    {
+        const auto* header = static_cast<const PacketHeader*>(GetHeader(index));
+        if (!header || m_headerSize < sizeof(PacketHeader) || !(header->flags & kPacketFlagChecksum)) 
+        {
+            return true;
+        }
+
+        PayloadChecksum checksum = BeginPayloadChecksum();
+        checksum.Update(GetPayload(index), m_payloadSize);
+        if (checksum.Finalize() == header->checksum) 
+        {
+            return true;
+        }
+
+        m_integrityFailures.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // GetHeader
     void* UltrasoundArena::GetHeader(size_t index) 
@@ -107,9 +927,92 @@ namespace AdaptiveArena
     {
         std::shared_lock<std::shared_mutex> lock(m_sharedMutex);
         if (index >= m_payloads.size()) return nullptr;
+        if (index < m_externalPayloads.size() && m_externalPayloads[index]) return m_externalPayloads[index];
         return m_payloads[index];
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetSlotScratch
+    std::pmr::memory_resource* UltrasoundArena::GetSlotScratch(size_t index)
+    {
+        SlotState* state = GetSlotState(index);
+        return state ? state->scratch.get() : nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetScratchOverflows
+    uint64_t UltrasoundArena::GetScratchOverflows() const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_sharedMutex);
+        uint64_t overflows = 0;
+        for (const auto& state : m_slotStates) 
+        {
+            if (state->scratch) overflows += state->scratch->GetOverflowCount();
+        }
+        return overflows;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // BindExternalPayload
+    void UltrasoundArena::BindExternalPayload(size_t index, void* payload)
+    {
+        if (m_sharedControl && payload) 
+        {
+            throw std::runtime_error("External payloads cannot be bound on a shared ring.");
+        }
+
+        std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+        if (index >= m_externalPayloads.size()) return;
+
+        if (!m_externalPayloads[index] && payload) m_externalBindings.fetch_add(1, std::memory_order_relaxed);
+        if (m_externalPayloads[index] && !payload) m_externalBindings.fetch_sub(1, std::memory_order_relaxed);
+        m_externalPayloads[index] = payload;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DrainExternalPayloads
+    bool UltrasoundArena::DrainExternalPayloads(std::chrono::milliseconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (m_externalBindings.load(std::memory_order_relaxed) > 0) 
+        {
+            // 1. 발행된 모든 프레임이 커서에서 반납될 때까지 (외부 메모리를 가리키는 포인터가 소비자에게 남지 않도록)
+            const bool released = !HasGatingConsumers() || GetSlowestReleased() >= m_commitIndex.load(std::memory_order_acquire);
+            if (released) 
+            {
+                std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+
+                // 2. 시퀀스를 무효화하여 새 임대를 막은 뒤 남은 임대 확인 (LeaseFrame은 반대 순서로 확인)
+                std::vector<std::pair<size_t, uint64_t>> invalidated;
+                bool leased = false;
+                for (size_t i = 0; i < m_externalPayloads.size() && !leased; ++i) 
+                {
+                    if (!m_externalPayloads[i]) continue;
+                    SlotState& state = *m_slotStates[i];
+                    invalidated.emplace_back(i, state.sequence.exchange(kNoSequence, std::memory_order_seq_cst));
+                    leased = state.leases.load(std::memory_order_seq_cst) > 0;
+                }
+
+                if (!leased) 
+                {
+                    std::fill(m_externalPayloads.begin(), m_externalPayloads.end(), nullptr);
+                    m_externalBindings.store(0, std::memory_order_relaxed);
+                    return true;
+                }
+
+                // 임대가 남아 있으면 되돌리고 반납을 기다림
+                for (const auto& entry : invalidated) 
+                {
+                    m_slotStates[entry.first]->sequence.store(entry.second, std::memory_order_release);
+                }
+            }
+
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // GetPredictedSlotCount
     size_t UltrasoundArena::GetPredictedSlotCount() const 
@@ -121,8 +1024,14 @@ namespace AdaptiveArena
     // AdaptToJitter
     void UltrasoundArena::AdaptToJitter() 
     {
-        size_t lag = GetCurrentLag();
+        AdaptToJitter(GetCurrentLag());
+    }
+
+    void UltrasoundArena::AdaptToJitter(size_t lag) 
+    {
         m_learningEngine.UpdateJitter(lag);
+        const size_t demanded = std::min(m_learningEngine.GetPredictedSlotCount(), m_slotCount.load());
+        if (demanded > m_workloadSlots.load(std::memory_order_relaxed)) m_workloadSlots.store(demanded, std::memory_order_relaxed);
 
         auto now = std::chrono::steady_clock::now();
         
@@ -135,54 +1044,518 @@ namespace AdaptiveArena
             double currentGBs = (static_cast<double>(bytes) / (1024.0 * 1024.0 * 1024.0)) / (elapsed / 1000.0);
             
             // EMA for throughput stability
-            m_avgThroughputGBs = 0.7 * currentGBs + 0.3 * m_avgThroughputGBs;
+            m_avgThroughputGBs.store(0.7 * currentGBs + 0.3 * m_avgThroughputGBs.load(std::memory_order_relaxed), std::memory_order_relaxed);
             m_lastThroughputCheck = now;
         }
 
+        // Compute Governor: 같은 지터 예측으로 작업자 수를 먼저 조절 (1초 간격)
+        if (std::chrono::duration_cast<std::chrono::seconds>(now - m_lastGovernTime).count() >= 1) 
+        {
+            std::lock_guard<std::mutex> lock(m_governorMutex);
+            if (m_computeGovernor) 
+            {
+                m_computeGovernor(m_learningEngine.GetPredictedSlotCount(), m_slotCount.load());
+            }
+            m_lastGovernTime = now;
+        }
+
         // 너무 자주 확장하지 않도록 1초 간격 체크
         if (std::chrono::duration_cast<std::chrono::seconds>(now - m_lastAdaptTime).count() >= 1) 
         {
             size_t predicted = m_learningEngine.GetPredictedSlotCount();
-            if (predicted > m_slotCount) 
+            if (predicted > m_slotCount && !m_sharedControl) 
             {
                 // Strict Resource Limits (Hard Limit)
-                size_t newSize = predicted * (m_headerSize + m_payloadSize);
+                // 매 프레임 호출되므로 거부도 1초 간격으로만 재시도하고, 경고는 한도에 닿을 때마다 한 번만 출력
+                size_t newSize = predicted * (m_headerSize + m_payloadStride + m_scratchStride);
+                m_lastAdaptTime = now;
                 if (newSize > m_hardLimit) 
                 {
-                    std::cerr << "[Ultrasound] Hard Limit Reached! Expansion rejected. Cap at " << m_slotCount << std::endl;
+                    if (!m_expansionLimitLogged) 
+                    {
+                        m_expansionLimitLogged = true;
+                        std::cerr << "[Ultrasound] Hard Limit Reached! Expansion rejected. Cap at " << m_slotCount << std::endl;
+                    }
                     return; 
                 }
 
-                // 실시간 확장: 새로운 슈퍼페이지 할당 및 슬롯 추가
-                // Writer Lock (Exclusive)
-                std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
-                
-                size_t additional = predicted - m_slotCount;
-                for (size_t i = 0; i < additional; ++i) 
+                // 실시간 확장: 새로운 슈퍼페이지 할당 및 슬롯 추가 (확장 횟수는 텔레메트리 ringExpansions로 보고)
+                GrowRing(predicted - m_slotCount);
+                m_expansionLimitLogged = false;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GrowRing
+    size_t UltrasoundArena::GrowRing(size_t additional) 
+    {
+        // Writer Lock (Exclusive)
+        std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+
+        // 확장되는 슬롯은 그동안 학습된 스크래치 크기를 사용 (기존 슬롯보다 작아지지는 않음)
+        m_scratchStride = std::max(m_scratchStride.load(), ResolveScratchStride(0));
+        const size_t scratchBytes = m_scratchStride;
+
+        // Strict Resource Limits (Hard Limit)
+        const size_t oldCount = m_headers.size();
+        const size_t maxSlots = GetMaxSlotCount();
+        additional = std::min(additional, (maxSlots > oldCount) ? maxSlots - oldCount : 0);
+
+        for (size_t i = 0; i < additional; ++i) 
+        {
+            void* pHeader = ::operator new(m_headerSize, std::nothrow); // Allocation Failure Handling
+            void* pPayload = AllocatePinned(m_payloadStride + scratchBytes, m_ringNode);
+
+            if (!pHeader || !pPayload) 
+            {
+                std::cerr << "[Ultrasound] CRITICAL: Allocation Failed during expansion! Stopping." << std::endl;
+                if (pHeader) ::operator delete(pHeader);
+                if (pPayload) FreePinned(pPayload, m_payloadStride);
+                break; // Stop expansion gracefully
+            }
+
+            m_headers.push_back(pHeader);
+            m_payloads.push_back(pPayload);
+            m_externalPayloads.push_back(nullptr);
+            m_slotStates.push_back(MakeSlotState(static_cast<uint8_t*>(pPayload) + m_payloadStride, scratchBytes));
+        }
+        
+        // Update count based on actual successful allocations
+        size_t actualSize = m_headers.size();
+        m_workloadSlots = std::max(m_workloadSlots.load(), actualSize);
+
+        std::vector<size_t> added;
+        for (size_t slot = oldCount; slot < actualSize; ++slot) 
+        {
+            added.push_back(slot);
+        }
+        InsertSlotsAtWritePosition(added);
+        if (!added.empty()) m_ringExpansions.fetch_add(1, std::memory_order_relaxed);
+        return actualSize - oldCount;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetMaxSlotCount
+    size_t UltrasoundArena::GetMaxSlotCount() const 
+    {
+        const size_t scratchBytes = std::max(m_scratchStride.load(), ResolveScratchStride(0));
+        return m_hardLimit / std::max<size_t>(m_headerSize + m_payloadStride + scratchBytes, 1);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // InsertSlotsAtWritePosition
+    void UltrasoundArena::InsertSlotsAtWritePosition(const std::vector<size_t>& slots) 
+    {
+        if (slots.empty() || m_epochs.empty()) return;
+
+        // 새 슬롯을 현재 쓰기 위치 바로 앞에 끼워 넣는 새 Epoch 생성.
+        // 미처리 시퀀스는 기존 슬롯에 그대로 남고, 다음 쓰기부터 새 슬롯을 먼저 사용합니다.
+        const RingEpoch& last = m_epochs.back();
+        uint64_t start = m_writeIndex.load();
+        size_t insertAt = (last.basePosition + static_cast<size_t>(start - last.startSequence)) % last.order.size();
+
+        RingEpoch epoch{ start, insertAt, {} };
+        epoch.order.reserve(last.order.size() + slots.size());
+        epoch.order.insert(epoch.order.end(), last.order.begin(), last.order.begin() + insertAt);
+        epoch.order.insert(epoch.order.end(), slots.begin(), slots.end());
+        epoch.order.insert(epoch.order.end(), last.order.begin() + insertAt, last.order.end());
+        m_epochs.push_back(std::move(epoch));
+
+        m_slotCount.store(m_epochs.back().order.size());
+        TrimEpochs();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TrimEpochs
+    void UltrasoundArena::TrimEpochs() 
+    {
+        // 1. 아직 조회될 수 있는 가장 오래된 시퀀스: 미발행/미소비 프레임
+        uint64_t floor = m_commitIndex.load(std::memory_order_acquire);
+        if (HasGatingConsumers()) floor = std::min(floor, GetSlowestReleased());
+
+        // 2. 슬롯에 남아 있는 프레임 (임대/보존/고정 프레임과 GetRetainedRange가 거슬러 올라가는 프레임)
+        for (const auto& state : m_slotStates) 
+        {
+            const uint64_t sequence = state->sequence.load(std::memory_order_acquire);
+            if (sequence != kNoSequence) floor = std::min(floor, sequence);
+        }
+        if (IsRetentionFrozen()) floor = std::min(floor, m_frozenBegin.load(std::memory_order_acquire));
+
+        // 3. floor를 포함하는 Epoch보다 앞선 것은 버림 (최신 Epoch는 항상 남김)
+        size_t drop = 0;
+        while (drop + 1 < m_epochs.size() && m_epochs[drop + 1].startSequence <= floor) 
+        {
+            ++drop;
+        }
+        m_epochs.erase(m_epochs.begin(), m_epochs.begin() + drop);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ParkPinnedSlots
+    bool UltrasoundArena::ParkPinnedSlots(uint64_t sequence) 
+    {
+        const uint64_t inFlight = HasGatingConsumers() ? sequence - GetSlowestReleased() : 0;
+
+        std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+        if (m_epochs.empty()) return false;
+
+        // 1. 쓰기 위치부터 한 바퀴: 고정/임대 슬롯은 빼고 나머지 순서는 유지
+        const RingEpoch& last = m_epochs.back();
+        const size_t size = last.order.size();
+        const size_t position = (last.basePosition + static_cast<size_t>(sequence - last.startSequence)) % size;
+
+        std::vector<size_t> active;
+        std::vector<size_t> pinned;
+        for (size_t i = 0; i < size; ++i) 
+        {
+            size_t slot = last.order[(position + i) % size];
+            const SlotState& state = *m_slotStates[slot];
+            uint64_t held = state.sequence.load(std::memory_order_acquire);
+            bool isPinned = state.leases.load(std::memory_order_acquire) > 0 || (held != kNoSequence && IsFrozen(held));
+            (isPinned ? pinned : active).push_back(slot);
+        }
+
+        // 2. 미소비 프레임은 활성 슬롯의 끝쪽에 있으므로, 활성 슬롯이 진행 중인 프레임보다 많아야 안전
+        if (pinned.empty() || active.size() <= inFlight) return false;
+
+        m_epochs.push_back(RingEpoch{ sequence, 0, std::move(active) });
+        m_parkedSlots.insert(m_parkedSlots.end(), pinned.begin(), pinned.end());
+        m_parkedCount.store(m_parkedSlots.size(), std::memory_order_relaxed);
+        m_slotCount.store(m_epochs.back().order.size());
+        TrimEpochs();
+
+        std::cout << "[Ultrasound] Hard limit: " << pinned.size() << " pinned slots parked, " 
+                  << m_slotCount.load() << " slots remain in rotation." << std::endl;
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // UnparkSlots
+    void UltrasoundArena::UnparkSlots() 
+    {
+        if (m_parkedCount.load(std::memory_order_relaxed) == 0 || IsRetentionFrozen()) return;
+
+        std::unique_lock<std::shared_mutex> lock(m_sharedMutex);
+        std::vector<size_t> released;
+        auto it = std::remove_if(m_parkedSlots.begin(), m_parkedSlots.end(), [&](size_t slot) 
+        {
+            if (m_slotStates[slot]->leases.load(std::memory_order_acquire) > 0) return false;
+            released.push_back(slot);
+            return true;
+        });
+        m_parkedSlots.erase(it, m_parkedSlots.end());
+        m_parkedCount.store(m_parkedSlots.size(), std::memory_order_relaxed);
+
+        // 오래된 프레임을 담은 슬롯이므로 쓰기 위치에 넣어 가장 먼저 재사용
+        InsertSlotsAtWritePosition(released);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ReclaimSlotForWrite
+    bool UltrasoundArena::ReclaimSlotForWrite(uint64_t sequence) 
+    {
+        UnparkSlots();
+
+        for (int attempt = 0; attempt < 3; ++attempt) 
+        {
+            SlotState* state = GetSlotState(GetSlotForSequence(sequence));
+            if (!state) return true;
+
+            uint64_t previous = state->sequence.load(std::memory_order_acquire);
+            if (previous == kNoSequence) return true;   // 아직 쓰이지 않은 슬롯
+
+            const bool leased = state->leases.load(std::memory_order_acquire) > 0;
+            const bool frozen = IsFrozen(previous);
+            const bool retained = IsRetained(previous, *state, TscClock::NowNs());
+
+            if (leased || frozen || retained) 
+            {
+                // 1. 링 확장: 새 슬롯이 쓰기 위치에 끼워지므로 보존 프레임은 제자리에 남음
+                //    Hard Limit에 이미 닿았으면 Writer Lock을 잡지 않음 (확장 횟수는 텔레메트리 ringExpansions로 보고)
+                const size_t allocated = m_slotCount.load() + m_parkedCount.load(std::memory_order_relaxed);
+                if (attempt == 0 && !m_sharedControl && allocated < GetMaxSlotCount()) 
                 {
-                    void* pHeader = ::operator new(m_headerSize, std::nothrow); // Allocation Failure Handling
-                    void* pPayload = AllocatePinned(m_payloadSize);
+                    if (GrowRing(std::max<size_t>(m_slotCount.load() / 4, 4)) > 0) continue;
+                }
 
-                    if (!pHeader || !pPayload) 
-                    {
-                        std::cerr << "[Ultrasound] CRITICAL: Allocation Failed during expansion! Stopping." << std::endl;
-                        if (pHeader) ::operator delete(pHeader);
-                        if (pPayload) FreePinned(pPayload, m_payloadSize);
-                        break; // Stop expansion gracefully
-                    }
+                // 2. Hard Limit: 고정 슬롯은 회전에서 빼내고 (임대 중인 슬롯도 함께), 짧은 임대는 Back-pressure로 기다림
+                if (leased || frozen) 
+                {
+                    if (frozen && !m_sharedControl && ParkPinnedSlots(sequence)) continue;
+                    return false;
+                }
 
-                    m_headers.push_back(pHeader);
-                    m_payloads.push_back(pPayload);
+                // 3. 보존 창은 가장 오래된 것부터 포기
+                m_retentionEvictions.fetch_add(1, std::memory_order_relaxed);
+                if (!m_retentionLimitLogged) 
+                {
+                    m_retentionLimitLogged = true;
+                    std::cerr << "[Ultrasound] Hard Limit Reached! Retention window shrinks to " << m_slotCount << " slots." << std::endl;
                 }
-                
-                // Update count based on actual successful allocations
-                size_t actualSize = m_headers.size();
-                m_slotCount.store(actualSize);
-                m_lastAdaptTime = now;
+            }
 
-                std::cout << "[Ultrasound] Ring expanded. New total slots: " << actualSize 
-                          << " (Absorbing Jitter)" << std::endl;
+            // 4. 선점: 시퀀스를 무효화한 뒤 임대 수를 다시 확인 (LeaseFrame은 반대 순서로 확인)
+            state->sequence.store(kNoSequence, std::memory_order_seq_cst);
+            if (state->leases.load(std::memory_order_seq_cst) > 0) 
+            {
+                state->sequence.store(previous, std::memory_order_release);
+                return false;
             }
+            return true;
+        }
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetSlotState
+    UltrasoundArena::SlotState* UltrasoundArena::GetSlotState(size_t index) const 
+    {
+        std::shared_lock<std::shared_mutex> lock(m_sharedMutex);
+        return (index < m_slotStates.size()) ? m_slotStates[index].get() : nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MakeSlotState
+    std::unique_ptr<UltrasoundArena::SlotState> UltrasoundArena::MakeSlotState(void* scratch, size_t scratchBytes) 
+    {
+        auto state = std::make_unique<SlotState>();
+        state->scratch = std::make_unique<SlotScratch>(scratch, scratchBytes, this);
+        return state;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ResolveScratchStride
+    size_t UltrasoundArena::ResolveScratchStride(size_t requested) const 
+    {
+        size_t bytes = requested ? requested : m_learningEngine.GetPredictedScratchSize();
+        if (bytes == 0) bytes = kDefaultScratchBytes;
+        return (bytes + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // IsRetained
+    bool UltrasoundArena::IsRetained(uint64_t sequence, const SlotState& state, uint64_t nowNs) const 
+    {
+        const uint64_t frames = m_retentionFrames.load(std::memory_order_relaxed);
+        const uint64_t windowNs = m_retentionWindowNs.load(std::memory_order_relaxed);
+        if (frames == 0 && windowNs == 0) return false;
+
+        const uint64_t committed = m_commitIndex.load(std::memory_order_acquire);
+        if (sequence >= committed) return false;   // 발행되지 않은 프레임은 보존 대상 아님
+
+        if (frames > 0 && committed - sequence > frames) return false;
+        if (windowNs > 0) 
+        {
+            uint64_t commitNs = state.commitNs.load(std::memory_order_relaxed);
+            if (commitNs == 0 || nowNs - commitNs > windowNs) return false;
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // IsFrozen
+    bool UltrasoundArena::IsFrozen(uint64_t sequence) const 
+    {
+        return sequence >= m_frozenBegin.load(std::memory_order_acquire) && sequence < m_frozenEnd.load(std::memory_order_acquire);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetRetention
+    void UltrasoundArena::SetRetention(const RetentionPolicy& policy) 
+    {
+        m_retentionFrames.store(policy.frames, std::memory_order_relaxed);
+        m_retentionWindowNs.store(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(policy.window).count()), 
+                                  std::memory_order_relaxed);
+        m_retentionLimitLogged = false;
+    }
+
+    RetentionPolicy UltrasoundArena::GetRetention() const 
+    {
+        RetentionPolicy policy;
+        policy.frames = m_retentionFrames.load(std::memory_order_relaxed);
+        policy.window = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::nanoseconds(m_retentionWindowNs.load(std::memory_order_relaxed)));
+        return policy;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FreezeRetention
+    void UltrasoundArena::FreezeRetention() 
+    {
+        uint64_t first = 0;
+        uint64_t end = 0;
+        ThawRetention();
+        GetRetainedRange(first, end);
+
+        // 범위를 비운 뒤 다시 설정하여 중간 상태가 이전 범위와 섞이지 않도록 함
+        m_frozenEnd.store(0, std::memory_order_release);
+        m_frozenBegin.store(first, std::memory_order_release);
+        m_frozenEnd.store(end, std::memory_order_release);
+    }
+
+    void UltrasoundArena::ThawRetention() 
+    {
+        m_frozenEnd.store(0, std::memory_order_release);
+        m_frozenBegin.store(0, std::memory_order_release);
+    }
+
+    bool UltrasoundArena::IsRetentionFrozen() const 
+    {
+        return m_frozenBegin.load(std::memory_order_acquire) < m_frozenEnd.load(std::memory_order_acquire);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetRetainedRange
+    void UltrasoundArena::GetRetainedRange(uint64_t& first, uint64_t& end) const 
+    {
+        // 고정 중에는 고정 시점의 창 (이후 발행된 프레임과 이어지지 않을 수 있음)
+        if (IsRetentionFrozen()) 
+        {
+            first = m_frozenBegin.load(std::memory_order_acquire);
+            end = m_frozenEnd.load(std::memory_order_acquire);
+            return;
+        }
+
+        end = m_commitIndex.load(std::memory_order_acquire);
+        first = end;
+
+        // 보존 정책이 없으면 아직 덮어쓰이지 않은 모든 발행 프레임
+        const bool policy = m_retentionFrames.load(std::memory_order_relaxed) > 0 || m_retentionWindowNs.load(std::memory_order_relaxed) > 0;
+        const uint64_t nowNs = TscClock::NowNs();
+        const size_t slots = m_slotCount.load() + m_parkedCount.load(std::memory_order_relaxed);
+
+        for (size_t step = 0; step < slots && first > 0; ++step) 
+        {
+            uint64_t sequence = first - 1;
+            SlotState* state = GetSlotState(GetSlotForSequence(sequence));
+            if (!state || state->sequence.load(std::memory_order_acquire) != sequence) break;
+            if (policy && !IsRetained(sequence, *state, nowNs) && !IsFrozen(sequence)) break;
+            first = sequence;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // LeaseFrame
+    FrameLease UltrasoundArena::LeaseFrame(uint64_t sequence) 
+    {
+        if (sequence >= m_commitIndex.load(std::memory_order_acquire)) return {};
+
+        size_t index = GetSlotForSequence(sequence);
+        SlotState* state = GetSlotState(index);
+        if (!state) return {};
+
+        // 임대 수를 먼저 올린 뒤 시퀀스를 확인 (Producer는 반대 순서: 시퀀스 무효화 → 임대 수 확인)
+        state->leases.fetch_add(1, std::memory_order_seq_cst);
+        if (state->sequence.load(std::memory_order_seq_cst) != sequence) 
+        {
+            state->leases.fetch_sub(1, std::memory_order_release);
+            return {};
+        }
+        return FrameLease(&state->leases, GetHeader(index), GetPayload(index), index, sequence);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FrameLease
+    FrameLease::FrameLease(const FrameLease& other)
+        : m_refCount(other.m_refCount)
+        , m_header(other.m_header)
+        , m_payload(other.m_payload)
+        , m_index(other.m_index)
+        , m_sequence(other.m_sequence)
+    {
+        if (m_refCount) m_refCount->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    FrameLease& FrameLease::operator=(const FrameLease& other)
+    {
+        if (this != &other) 
+        {
+            FrameLease copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    FrameLease::FrameLease(FrameLease&& other) noexcept
+        : m_refCount(other.m_refCount)
+        , m_header(other.m_header)
+        , m_payload(other.m_payload)
+        , m_index(other.m_index)
+        , m_sequence(other.m_sequence)
+    {
+        other.m_refCount = nullptr;
+    }
+
+    FrameLease& FrameLease::operator=(FrameLease&& other) noexcept
+    {
+        if (this != &other) 
+        {
+            Reset();
+            m_refCount = other.m_refCount;
+            m_header = other.m_header;
+            m_payload = other.m_payload;
+            m_index = other.m_index;
+            m_sequence = other.m_sequence;
+            other.m_refCount = nullptr;
+        }
+        return *this;
+    }
+
+    void FrameLease::Reset()
+    {
+        // 읽기가 끝난 뒤에 반납되도록 release
+        if (m_refCount) m_refCount->fetch_sub(1, std::memory_order_release);
+        m_refCount = nullptr;
+        m_header = nullptr;
+        m_payload = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // GetNumaTelemetry
+    NumaTelemetry UltrasoundArena::GetNumaTelemetry() const 
+    {
+        NumaTelemetry telemetry = InternalResource::GetNumaTelemetry();
+        telemetry.remoteFrameReads = m_remoteFrameReads.load(std::memory_order_relaxed);
+        telemetry.remoteFrameBytes = m_remoteFrameBytes.load(std::memory_order_relaxed);
+        return telemetry;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CaptureTelemetry
+    void UltrasoundArena::CaptureTelemetry(TelemetrySnapshot& out) const 
+    {
+        InternalResource::CaptureTelemetry(out);
+        out.cudaActive = IsCudaActive();
+        if (m_slotCount.load() == 0) return;
+
+        // 링 필드는 모두 원자 변수 (Producer/커서를 막지 않음), 스크래치 합계만 자체 공유 잠금
+        out.ringSlots = m_slotCount.load();
+        out.ringLag = GetCurrentLag();
+        out.predictedSlots = GetPredictedSlotCount();
+        out.throughputGBs = GetAverageThroughputGBs();
+        out.droppedFrames = GetDroppedFrames();
+        out.ringExpansions = GetRingExpansions();
+        out.retentionFrozen = IsRetentionFrozen();
+        uint64_t first = 0, end = 0;
+        GetRetainedRange(first, end);
+        out.retainedFrames = end - first;
+        out.scratchBytes = GetScratchSize();
+        out.scratchOverflows = GetScratchOverflows();
+
+        out.stageCount = GetCursorCount();
+        for (size_t i = 0; i < std::min<size_t>(out.stageCount, kMaxTelemetryStages); ++i) 
+        {
+            const RingCursorTelemetry cursor = GetCursorTelemetry(i);
+            StageTelemetry& stage = out.stages[i];
+            const size_t nameLength = std::min(cursor.name.size(), sizeof(stage.name) - 1);
+            std::memcpy(stage.name, cursor.name.data(), nameLength);
+            stage.name[nameLength] = '\0';
+            stage.lag = cursor.lag;
+            stage.avgServiceUs = cursor.avgServiceUs;
+            stage.queueLatency = cursor.queueLatency;
+            stage.lostFrames = cursor.lostFrames;
+            stage.duplicateFrames = cursor.duplicateFrames;
         }
     }
 
@@ -191,7 +1564,7 @@ namespace AdaptiveArena
     void* UltrasoundArena::do_allocate(size_t bytes, size_t alignment) 
     {
         // Ultrasound Mode에서는 링 버퍼 API를 주로 사용하지만, 
-        // 일반적인 PMR 할당 요청이 올 경우 InternalResource의 기본 동작(new)을 수행합니다.
+        // 일반적인 PMR 할당 요청이 올 경우 InternalResource의 NUMA 노드별 Super-Page 풀에서 제공합니다.
         return InternalResource::do_allocate(bytes, alignment);
     }
 
@@ -200,9 +1573,81 @@ namespace AdaptiveArena
         InternalResource::do_deallocate(p, bytes, alignment);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CaptureProfile
+    void UltrasoundArena::CaptureProfile(SessionProfile& profile) const 
+    {
+        // 체크포인트 스레드는 m_sharedMutex 없이 호출하므로 슬롯 벡터 대신 원자적 슬롯 수로 확인
+        if (m_slotCount.load() == 0) return;
+
+        // 이번 워크로드 활성 구간에서 실제로 필요했던 회전 슬롯 수 (지터 EMA는 평상시 Lag으로 금방 내려가므로 사용하지 않고,
+        // 다른 모드에서 늘어난 슬롯 수도 섞지 않음)
+        RingProfile ring{};
+        ring.headerSize = m_headerSize;
+        ring.payloadSize = m_payloadSize;
+        ring.slotCount = static_cast<uint32_t>(std::min(m_workloadSlots.load(), m_slotCount.load()));
+        ring.scratchBytes = static_cast<uint32_t>(std::min<size_t>(m_learningEngine.GetScratchState(), UINT32_MAX));
+        ring.lastSession = profile.sessionCount;
+        profile.StoreRing(ring);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RestoreRingProfile
+    void UltrasoundArena::RestoreRingProfile(size_t headerSize, size_t payloadSize) 
+    {
+        // 같은 형상 → 이 워크로드의 가장 가까운 형상 → 모든 워크로드의 가장 가까운 형상
+        RingProfile found{};
+        bool exact = false;
+        {
+            std::lock_guard<std::mutex> lock(m_libraryMutex);
+            const RingProfile* match = m_profile.FindRing(headerSize, payloadSize);
+            exact = match != nullptr;
+            if (!match) match = m_profile.FindNearestRing(headerSize, payloadSize);
+            if (!match) match = m_library.FindNearestRing(headerSize, payloadSize);
+            if (!match) return;
+            found = *match;
+        }
+        const RingProfile* ring = &found;
+
+        if (ring->scratchBytes > 0) m_learningEngine.SetScratchState(ring->scratchBytes);
+
+        const size_t stride = (payloadSize + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+        const size_t maxSlots = m_hardLimit / std::max<size_t>(headerSize + stride + ResolveScratchStride(0), 1);
+        const size_t slots = std::min<size_t>(ring->slotCount, maxSlots);
+        m_learningEngine.RestoreSlotCount(slots);
+
+        std::cout << "[Ultrasound] Warm start: " << slots << " slots, " << ring->scratchBytes / 1024 << " KB scratch learned for "
+                  << (exact ? "this ring geometry." : "the nearest ring geometry.") << std::endl;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // OnWorkloadActivated
+    void UltrasoundArena::OnWorkloadActivated() 
+    {
+        if (m_headers.empty() || m_sharedControl) return;
+
+        RestoreRingProfile(m_headerSize, m_payloadSize);
+        const size_t predicted = m_learningEngine.GetPredictedSlotCount();
+        m_workloadSlots = std::min(std::max(m_initialSlots, predicted), m_slotCount.load());
+
+        // 새 모드의 첫 프레임이 확장(페이지 폴트 포함)을 기다리지 않도록 미리 확장
+        const size_t oldCount = m_headers.size();
+        if (predicted <= m_slotCount) return;
+
+        const size_t added = GrowRing(predicted - m_slotCount);
+        {
+            std::shared_lock<std::shared_mutex> lock(m_sharedMutex);
+            for (size_t i = oldCount; i < oldCount + added; ++i) 
+            {
+                PrefaultPages(m_payloads[i], m_payloadStride + m_slotStates[i]->scratch->GetCapacity());
+            }
+        }
+        std::cout << "[Ultrasound] Workload switch: ring prefetched to " << m_slotCount.load() << " slots." << std::endl;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Memory Management (Pinned)
-    void* UltrasoundArena::AllocatePinned(size_t size) 
+    void* UltrasoundArena::AllocatePinned(size_t size, int numaNode) 
     {
         if (size == 0) return nullptr;
 
@@ -217,8 +1662,18 @@ namespace AdaptiveArena
             }
         }
 
-        // Windows: VirtualAlloc을 사용하여 Page-Locked (Pinned) 메모리 시뮬레이션
-        return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+        // Windows: VirtualAlloc을 사용하여 Page-Locked (Pinned) 메모리 시뮬레이션 (노드 지정 시 해당 노드 메모리 우선)
+        return NumaTopology::AllocateOnNode(size, numaNode);
+    }
+
+    void UltrasoundArena::PrefaultPages(void* p, size_t size) 
+    {
+        // 페이지마다 한 바이트씩 기록하여 물리 페이지를 지금 (이 스레드의 노드에) 확보
+        auto* bytes = static_cast<volatile uint8_t*>(p);
+        for (size_t offset = 0; offset < size; offset += 4096) 
+        {
+            bytes[offset] = 0;
+        }
     }
 
     void UltrasoundArena::FreePinned(void* p, size_t size) 
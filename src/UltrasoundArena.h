@@ -2,13 +2,26 @@
 
 #include "InternalResource.h"
 #include "CudaWrapper.h" // Added for Hybrid Allocation
+#include "LatencyHistogram.h"
+#include "PayloadIntegrity.h"
+#include "SlotScratch.h"
+#include "StreamingCopy.h"
+#include "ThreadPlacement.h"
 #include <vector>
+#include <array>
+#include <deque>
 #include <atomic>
 #include <chrono>
+#include <string>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <shared_mutex> // Added for MRSW
 
 namespace AdaptiveArena 
 {
+    struct SharedRingControl; // Forward declaration (SharedRing.h)
+
     /**
      * @brief 초음파 RF 데이터의 메타데이터를 담는 헤더 구조체 (SoA의 Header 영역)
      */
@@ -19,6 +32,109 @@ namespace AdaptiveArena
         uint32_t channelCount;
         uint32_t sampleDepth;
         uint32_t flags;
+        uint32_t checksum;       ///< 비밀키로 시드된 페이로드 CRC32C (kPacketFlagChecksum일 때 유효)
+        uint32_t reserved;
+    };
+
+    constexpr uint32_t kPacketFlagChecksum = 1u << 31;    ///< checksum 필드가 현재 페이로드에 대해 계산됨
+    constexpr uint32_t kPacketFlagCorrupted = 1u << 30;   ///< 검증 실패 또는 기록 실패 (녹화 인덱스에 표시)
+
+    /**
+     * @brief  링 위의 소비 단계(Cursor)별 텔레메트리 스냅샷입니다.
+     */
+    struct RingCursorTelemetry 
+    {
+        std::string name;
+        uint64_t position;       ///< 이 커서가 해제(Release)한 누적 프레임 수
+        size_t lag;              ///< 상류(Upstream)가 넘겨준 프레임 중 아직 해제하지 않은 수
+        double avgServiceUs;     ///< Acquire → Release 평균 처리 시간
+        LatencyPercentiles queueLatency;     ///< Commit → Acquire (상류 단계 처리 시간 포함)
+        LatencyPercentiles serviceLatency;   ///< Acquire → Release
+        uint64_t lostFrames;     ///< frameIndex 간격(Gap)으로 확인된 유실 프레임 수
+        uint64_t gapEvents;      ///< 유실이 발생한 횟수
+        uint64_t duplicateFrames;///< 이미 본 frameIndex를 다시 획득한 횟수 (덮어쓰기 후 재순환)
+        uint64_t lastLossNs;     ///< 마지막 유실 시각 (TscClock, 0이면 없음)
+    };
+
+    /**
+     * @brief  커서가 Acquire 시 감지한 프레임 유실 이벤트입니다.
+     */
+    struct FrameLossEvent 
+    {
+        uint64_t timestampNs;    ///< 감지 시각 (TscClock)
+        size_t cursor;
+        uint32_t firstMissing;   ///< 유실된 첫 frameIndex
+        uint32_t count;          ///< 연속 유실 프레임 수
+    };
+
+    /**
+     * @brief  링 초기화 시 페이로드 선할당(Prefault) 옵션입니다.
+     */
+    struct RingPrefaultOptions 
+    {
+        int numaNode = -1;      ///< 주 소비자가 실행될 NUMA 노드 (-1이면 호출 스레드의 노드)
+        size_t threads = 0;     ///< 할당/First-touch 스레드 수 (0이면 노드의 코어 수, 최대 8)
+        size_t scratchBytes = 0;///< 슬롯당 스크래치 크기 (0이면 LearningEngine 학습값, 학습 전이면 kDefaultScratchBytes)
+        std::function<void(size_t completedSlots, size_t totalSlots)> progress;   ///< 호출 스레드에서 주기적으로 호출
+    };
+
+    /**
+     * @brief  Cine 보존 창: 모든 커서가 해제한 뒤에도 Producer가 재사용하지 않을 최근 프레임의 범위입니다.
+     *         두 값을 모두 지정하면 더 좁은 쪽이 적용되며, 둘 다 0이면 보존하지 않습니다.
+     */
+    struct RetentionPolicy 
+    {
+        uint64_t frames = 0;                     ///< 최근 N 프레임 (0이면 제한 없음)
+        std::chrono::milliseconds window{0};     ///< 최근 N 밀리초 (Commit 시각 기준, 0이면 제한 없음)
+    };
+
+    /**
+     * @brief  과거 프레임에 대한 참조 카운트 기반 읽기 임대(RAII)입니다.
+     *         임대가 살아있는 동안 Producer는 해당 슬롯을 재사용하지 않으므로 복사 없이 읽을 수 있습니다.
+     *         복사하면 같은 슬롯에 대한 참조가 하나 늘어나고, 소멸 또는 Reset 시 반납됩니다. 아레나보다 먼저 소멸해야 합니다.
+     */
+    class FrameLease 
+    {
+    public:
+        FrameLease() = default;
+        ~FrameLease() { Reset(); }
+
+        FrameLease(const FrameLease& other);
+        FrameLease& operator=(const FrameLease& other);
+        FrameLease(FrameLease&& other) noexcept;
+        FrameLease& operator=(FrameLease&& other) noexcept;
+
+        void Reset();
+        explicit operator bool() const { return m_refCount != nullptr; }
+
+        uint64_t GetSequence() const { return m_sequence; }
+        size_t GetIndex() const { return m_index; }
+        void* GetHeader() const { return m_header; }
+        void* GetPayload() const { return m_payload; }
+
+    private:
+        friend class UltrasoundArena;
+        FrameLease(std::atomic<uint32_t>* refCount, void* header, void* payload, size_t index, uint64_t sequence)
+            : m_refCount(refCount), m_header(header), m_payload(payload), m_index(index), m_sequence(sequence) {}
+
+        std::atomic<uint32_t>* m_refCount = nullptr;
+        void* m_header = nullptr;
+        void* m_payload = nullptr;
+        size_t m_index = 0;
+        uint64_t m_sequence = 0;
+    };
+
+    /**
+     * @brief  링의 진행(Commit, Release, 커서 분리)을 통보받는 인터페이스입니다.
+     *         Producer와 소비자 스레드의 핫 패스에서 직접 호출되므로 구현은 대기자를 깨우는 정도로 짧아야 합니다.
+     */
+    class RingProgressListener 
+    {
+    public:
+        virtual void OnRingProgress() = 0;
+
+    protected:
+        ~RingProgressListener() = default;
     };
 
     /**
@@ -37,7 +153,8 @@ namespace AdaptiveArena
         UltrasoundArena(const std::string& secretKey, 
                          const std::filesystem::path& logPath, 
                          size_t hardLimit,
-                         bool gpuDirect);
+                         bool gpuDirect,
+                         const std::string& workloadKey = kDefaultWorkloadKey);
         ~UltrasoundArena() override;
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +168,23 @@ namespace AdaptiveArena
          */
         void InitializeRing(size_t headerSize, size_t payloadSize, size_t initialSlots);
 
+        /**
+         * @brief  페이로드를 여러 스레드에서 병렬로 할당하고 모든 페이지를 미리 건드려(First-touch) 페이지 폴트를 시작 시점에 끝냅니다.
+         *         스레드는 지정한 NUMA 노드(미지정 시 Builder 바인딩)에 고정되므로 페이로드가 주 소비자와 같은 노드의 메모리에 배치됩니다.
+         * @throw  std::runtime_error 페이로드 할당 실패 시 발생
+         */
+        void InitializeRing(size_t headerSize, size_t payloadSize, size_t initialSlots, const RingPrefaultOptions& options);
+
+        /**
+         * @brief  링의 헤더, 페이로드, 커서를 이름 있는 공유 메모리 세그먼트에 배치합니다.
+         *         다른 프로세스는 SharedRingConsumer로 복사 없이 프레임을 읽을 수 있습니다.
+         *         공유 링은 형상이 고정되므로 지터에 의한 확장은 수행하지 않습니다.
+         * @param  name  세그먼트 이름 (예: L"Local\\UltrasoundRing")
+         * @throw  std::runtime_error 이미 초기화되었거나, Hard Limit 초과, 세그먼트 생성 실패 시 발생
+         */
+        void InitializeSharedRing(const std::wstring& name, size_t headerSize, size_t payloadSize, size_t slotCount);
+        bool IsSharedRing() const { return m_sharedControl != nullptr; }
+
         /**
          * @brief  다음 쓰기 슬롯의 위치를 반환합니다 (Producer).
          */
@@ -66,6 +200,84 @@ namespace AdaptiveArena
          */
         size_t GetCurrentLag() const;
 
+        /**
+         * @brief  시퀀스 번호가 저장된(또는 저장될) 물리 슬롯 위치를 반환합니다.
+         *         링이 확장되어도 아직 슬롯에 남아 있거나 소비되지 않은 시퀀스의 위치는 변하지 않습니다.
+         *         그보다 오래된 시퀀스는 정리된 Epoch에 속할 수 있으므로 호출자가 SlotState::sequence로 확인합니다.
+         */
+        size_t GetSlotForSequence(uint64_t sequence) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Cursor API (Back-pressured, Zero-Copy Stage Chaining)
+    public:
+        static constexpr size_t kMaxCursors = 16;
+        static constexpr size_t kProducerCursor = static_cast<size_t>(-1);
+
+        /**
+         * @brief  소비 커서를 등록합니다. 커서는 상류 커서가 해제한 슬롯만 읽을 수 있습니다.
+         * @param  name      텔레메트리 표시용 이름
+         * @param  upstream  상류 커서 ID (kProducerCursor이면 Producer의 Commit을 따라감)
+         * @return size_t    커서 ID
+         * @throw  std::runtime_error 커서 한도 초과 또는 잘못된 상류 지정 시 발생
+         */
+        size_t AddCursor(const std::string& name, size_t upstream = kProducerCursor);
+
+        /**
+         * @brief  가장 느린 커서가 슬롯을 반납했을 때만 다음 쓰기 슬롯을 예약합니다 (Back-pressure).
+         * @param  outIndex  예약된 슬롯 위치
+         * @return bool      링이 가득 차 있으면 false
+         */
+        bool TryClaimWrite(size_t& outIndex);
+
+        /**
+         * @brief  예약된 슬롯 중 가장 오래된 슬롯을 커서들에게 발행합니다.
+         *         PacketHeader::timestamp에 발행 시각(TscClock, ns)을 기록하여 커서별 End-to-End 지연 측정의 기준으로 삼습니다.
+         *         PacketHeader::frameIndex에는 단조 증가하는 발행 순번을 기록하여 커서가 유실/중복을 감지할 수 있게 합니다.
+         */
+        void CommitWrite();
+
+        /**
+         * @brief  커서가 읽을 수 있는 다음 슬롯을 획득합니다.
+         * @return bool  상류가 아직 넘겨준 프레임이 없으면 false
+         */
+        bool TryAcquire(size_t cursor, size_t& outIndex);
+        bool TryAcquire(size_t cursor, size_t& outIndex, uint64_t& outSequence);
+
+        /**
+         * @brief  TryAcquire와 같으며, 성공 시 다음 시퀀스 슬롯의 헤더와 페이로드 앞부분을 미리 캐시로 가져옵니다 (Software Prefetch).
+         *         Non-Temporal로 기록된 슬롯은 캐시에 없으므로, 처리하는 동안 다음 프레임의 첫 접근 지연을 숨깁니다.
+         */
+        bool AcquireRead(size_t cursor, size_t& outIndex);
+
+        /**
+         * @brief  커서가 가장 오래 잡고 있던 슬롯을 하류(또는 Producer)에게 반납합니다.
+         */
+        void Release(size_t cursor);
+
+        /**
+         * @brief  더 이상 소비하지 않는 커서를 Back-pressure 계산에서 제외합니다 (녹화 종료, 소비자 이탈 등).
+         */
+        void DetachCursor(size_t cursor);
+
+        size_t GetCursorCount() const { return m_cursorCount.load(std::memory_order_acquire); }
+        uint64_t GetCursorAcquired(size_t cursor) const { return m_cursors[cursor].acquired.load(std::memory_order_acquire); }
+        uint64_t GetCursorUpstreamLimit(size_t cursor) const { return GetUpstreamLimit(m_cursors[cursor].upstream); }
+
+        /**
+         * @brief  지터 Governor가 약 1초마다 호출하는 연산 자원 조절 콜백을 등록합니다.
+         *         슬롯만 늘리는 대신 작업자 수를 늘려 Lag을 흡수할 수 있도록 합니다.
+         * @param  governor  (예측 Lag 슬롯 수, 현재 슬롯 수)를 받는 콜백 (nullptr이면 해제)
+         */
+        void SetComputeGovernor(std::function<void(size_t predictedLag, size_t slotCount)> governor);
+        RingCursorTelemetry GetCursorTelemetry(size_t cursor) const;
+
+        /**
+         * @brief  링 진행 통보 대상을 등록합니다 (하나만 가능, nullptr이면 해제). 폴링 대신 이벤트로 소비자를 재개하는 스케줄러용입니다.
+         *         해제 전에 Producer와 커서의 링 호출이 멈춰 있어야 합니다.
+         * @throw  std::runtime_error 이미 다른 대상이 등록되어 있을 때 발생
+         */
+        void SetProgressListener(RingProgressListener* listener);
+
         /**
          * @brief  Thread-Safe Accessor for Header (Reader Lock)
          */
@@ -76,15 +288,173 @@ namespace AdaptiveArena
          */
         void* GetPayload(size_t index);
 
+        /**
+         * @brief  슬롯이 다음에 재사용될 때까지 외부 메모리(예: 녹화 파일 매핑)를 페이로드로 사용하도록 연결합니다 (Zero-Copy).
+         *         연결된 메모리는 해당 슬롯을 읽는 모든 커서가 Release 할 때까지 유효해야 합니다.
+         * @throw  std::runtime_error 공유 링일 때 발생 (외부 프로세스는 세그먼트의 페이로드만 볼 수 있음)
+         */
+        void BindExternalPayload(size_t index, void* payload);
+
+        /**
+         * @brief  발행된 프레임을 모든 커서가 Release하고 외부 페이로드 슬롯의 임대가 모두 반납될 때까지 기다린 뒤 연결을 해제합니다.
+         *         해제 전에 해당 슬롯의 시퀀스를 무효화하므로 이후 LeaseFrame은 외부 메모리를 내주지 않습니다. Producer가 멈춘 뒤 호출해야 합니다.
+         * @return bool  timeout 안에 비워지지 않으면 false (연결은 유지되므로 호출자는 외부 메모리를 해제하면 안 됨)
+         */
+        bool DrainExternalPayloads(std::chrono::milliseconds timeout);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Slot Scratch (Per-frame Temporaries)
+    public:
+        /**
+         * @brief  슬롯에 딸린 단조 스크래치 리소스를 반환합니다. 페이로드와 같은 할당의 바로 뒤 영역이므로 이미 물리 페이지가 확보되어 있습니다.
+         *         아포다이제이션 창, 중간 I/Q 버퍼 같은 프레임별 임시 객체를 std::pmr 컨테이너로 만들 때 사용하며,
+         *         할당은 포인터 증가만으로 처리되고 슬롯이 재사용될 때 자동으로 비워집니다 (슬롯을 Release 한 뒤에는 사용 금지).
+         * @return std::pmr::memory_resource*  슬롯 위치가 잘못되었으면 nullptr
+         */
+        std::pmr::memory_resource* GetSlotScratch(size_t index);
+
+        /**
+         * @brief  새로 할당되는 슬롯의 스크래치 크기 (페이지 정렬)
+         */
+        size_t GetScratchSize() const { return m_scratchStride.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  스크래치 영역이 부족하여 상류(아레나 PMR 풀)로 넘어간 할당 횟수 (모든 슬롯 합계)
+         */
+        uint64_t GetScratchOverflows() const;
+
+        static constexpr size_t kDefaultScratchBytes = 64 * 1024;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Cine Retention (Zero-Copy Scroll-back)
+    public:
+        /**
+         * @brief  해제된 프레임을 재사용하지 않고 남겨둘 보존 창을 설정합니다 (TryClaimWrite 경로에서 적용).
+         *         보존 중인 슬롯에 도달하면 링을 Hard Limit 안에서 확장하고, 한계에 이르면 가장 오래된 보존 프레임을 재사용합니다.
+         */
+        void SetRetention(const RetentionPolicy& policy);
+        RetentionPolicy GetRetention() const;
+
+        /**
+         * @brief  현재 보존 창의 프레임을 고정합니다 (화면 정지). 고정된 프레임은 Thaw 전까지 재사용되지 않으며,
+         *         Producer는 링을 Hard Limit 안에서 확장하며 계속 진행합니다. 한계에 이르면 Back-pressure가 걸립니다.
+         */
+        void FreezeRetention();
+        void ThawRetention();
+        bool IsRetentionFrozen() const;
+
+        /**
+         * @brief  아직 덮어쓰이지 않은 보존 프레임의 시퀀스 범위 [first, end)를 반환합니다 (고정 중이면 고정된 범위).
+         */
+        void GetRetainedRange(uint64_t& first, uint64_t& end) const;
+
+        /**
+         * @brief  발행된 과거 프레임에 대한 읽기 임대를 얻습니다.
+         * @return FrameLease  프레임이 아직 발행되지 않았거나 이미 재사용되었으면 빈 임대
+         */
+        FrameLease LeaseFrame(uint64_t sequence);
+
+        /**
+         * @brief  Hard Limit 때문에 보존 창 안의 프레임을 재사용한 횟수
+         */
+        uint64_t GetRetentionEvictions() const { return m_retentionEvictions.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief  링이 실제로 확장된 횟수 (지터 흡수 + 보존 창 확보)
+         */
+        uint64_t GetRingExpansions() const { return m_ringExpansions.load(std::memory_order_relaxed); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Thread Placement
+    public:
+        /**
+         * @brief  아레나 스레드 배치 명세를 설정합니다. 파이프라인/작업자/녹화/재생 스레드를 시작하기 전에 호출해야 합니다.
+         */
+        void SetThreadPlacement(const ThreadPlacement& placement);
+
+        /**
+         * @brief  호출 스레드에 역할별 코어 고정과 우선순위를 적용합니다 (배치가 꺼져 있으면 아무것도 하지 않음).
+         *         지터 Governor는 Producer 스레드(AdaptToJitter)에서 실행되므로 Producer 배치를 그대로 따릅니다.
+         * @param  ordinal  Consumer는 단계 번호 (0이 Producer와 캐시를 공유하는 첫 소비자)
+         * @return bool     Affinity가 적용되면 true
+         */
+        bool ApplyThreadPlacement(ThreadRole role, size_t ordinal = 0) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Streaming Copy-in
+    public:
+        /**
+         * @brief  Non-Temporal 저장으로 슬롯 페이로드를 채웁니다 (LLC 오염 없음). 저장 완료는 CommitWrite의 SFENCE가 보장합니다.
+         *         무결성 검사가 켜져 있고 전체 페이로드를 쓰면 체크섬을 복사와 함께 계산합니다.
+         * @throw  std::runtime_error length가 페이로드 크기를 넘을 때 발생
+         */
+        void WritePayload(size_t index, const void* src, size_t length);
+
+        /**
+         * @brief  큰 프레임(1MB 이상)의 WritePayload를 나누어 처리할 보조 스레드 수를 설정합니다 (Producer가 쓰기 중이 아닐 때 호출).
+         */
+        void SetStreamingHelpers(size_t helperThreads);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Payload Integrity (Keyed CRC32C)
+    public:
+        /**
+         * @brief  프레임별 무결성 검사를 켜거나 끕니다. 켜져 있으면 CommitWrite가 체크섬이 없는 슬롯의 페이로드를 계산합니다.
+         */
+        void SetIntegrityCheck(bool enable) { m_integrityCheck = enable; }
+        bool IsIntegrityCheckEnabled() const { return m_integrityCheck; }
+
+        /**
+         * @brief  비밀키로 시드된 체크섬 누산기를 반환합니다. Producer가 슬롯을 채우며 순서대로 Update한 뒤
+         *         SetPayloadChecksum으로 기록하면 Commit 시 페이로드를 다시 읽지 않습니다.
+         */
+        PayloadChecksum BeginPayloadChecksum() const { return PayloadChecksum(m_integritySeed); }
+        void SetPayloadChecksum(size_t index, const PayloadChecksum& checksum);
+
+        /**
+         * @brief  슬롯 페이로드(GetPayloadSize 바이트)를 헤더의 체크섬과 비교합니다 (Lazy 검증).
+         * @return bool  불일치 시 false (체크섬이 기록되지 않은 슬롯은 true)
+         */
+        bool VerifyPayload(size_t index);
+        uint64_t GetIntegrityFailures() const { return m_integrityFailures.load(std::memory_order_relaxed); }
+
+        size_t GetHeaderSize() const { return m_headerSize; }
+        size_t GetPayloadSize() const { return m_payloadSize; }
+
+        /**
+         * @brief  페이지(4KB) 단위로 정렬된 페이로드 할당 크기. 슬롯 포인터와 이 크기는 Direct I/O 정렬 조건을 만족합니다.
+         */
+        size_t GetPayloadStride() const { return m_payloadStride; }
+
+        static constexpr size_t kPayloadAlignment = 4096;
+
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Telemetry Overrides
     public:
-        size_t GetRingBufferSize() const override { return m_slotCount; }
+        size_t GetRingBufferSize() const override { return m_slotCount; }   ///< 회전 중인 슬롯 수 (고정되어 빠진 슬롯 제외)
         size_t GetRingBufferOccupancy() const override { return GetCurrentLag(); }
         size_t GetPredictedSlotCount() const override;
 
-        double GetAverageThroughputGBs() const override { return m_avgThroughputGBs; }
+        double GetAverageThroughputGBs() const override { return m_avgThroughputGBs.load(std::memory_order_relaxed); }
         bool IsPoolWarmedUp() const override { return m_slotCount >= 4; }
+
+        size_t GetConsumerCount() const override { return GetCursorCount(); }
+        uint64_t GetDroppedFrames() const override { return m_overwrittenFrames.load(std::memory_order_relaxed); }
+        NumaTelemetry GetNumaTelemetry() const override;
+        int GetRingNumaNode() const { return m_ringNode; }
+
+        /**
+         * @brief  최근 프레임 유실 이벤트 (최대 kMaxLossEvents개, 오래된 순)
+         */
+        std::vector<FrameLossEvent> GetRecentLossEvents() const;
+        static constexpr size_t kMaxLossEvents = 64;
+        LatencyPercentiles GetQueueLatency(size_t consumer) const override;
+        LatencyPercentiles GetServiceLatency(size_t consumer) const override;
+
+        /**
+         * @brief  할당기 필드(기본 클래스)에 링/커서 필드를 더해 한 장의 스냅샷으로 수집합니다 (샘플러 스레드에서 호출).
+         */
+        void CaptureTelemetry(TelemetrySnapshot& out) const override;
         
         // CUDA Status
         bool IsCudaActive() const { return m_cudaFuncs.has_value(); }
@@ -95,39 +465,224 @@ namespace AdaptiveArena
         void* do_allocate(size_t bytes, size_t alignment) override;
         void do_deallocate(void* p, size_t bytes, size_t alignment) override;
 
+        /**
+         * @brief  현재 링 형상의 슬롯 수와 스크래치 학습값을 프로필에 기록합니다.
+         */
+        void CaptureProfile(SessionProfile& profile) const override;
+
+        /**
+         * @brief  새 워크로드의 링 학습값을 적용하고, 권장 슬롯 수가 현재보다 크면 첫 프레임 전에 링을 미리 확장하고 Prefault 합니다.
+         *         슬롯은 줄이지 않습니다 (다른 모드에서 늘어난 슬롯은 그대로 회전).
+         */
+        void OnWorkloadActivated() override;
+
     private:
+        /**
+         * @brief  프로필에 같은 형상의 링이 있으면 학습된 슬롯 수(Hard Limit 이내)와 스크래치 크기를 LearningEngine에 복원합니다.
+         *         없으면 이 워크로드의 다른 형상, 그다음 전체 라이브러리에서 가장 가까운 형상의 값을 사용합니다.
+         */
+        void RestoreRingProfile(size_t headerSize, size_t payloadSize);
+
         /**
          * @brief  버퍼 지격을 모니터링하고 필요시 링 버퍼를 확장합니다.
          */
         void AdaptToJitter();
+        void AdaptToJitter(size_t lag);
+
+        /**
+         * @brief  슬롯을 additional개 추가하는 새 Epoch를 현재 쓰기 위치에 만듭니다 (Hard Limit까지만).
+         * @return size_t  실제로 추가된 슬롯 수
+         */
+        size_t GrowRing(size_t additional);
+
+        /**
+         * @brief  슬롯들을 현재 쓰기 위치에 끼워 넣는 새 Epoch를 만듭니다 (Writer Lock 보유 상태에서 호출).
+         */
+        void InsertSlotsAtWritePosition(const std::vector<size_t>& slots);
+
+        /**
+         * @brief  더 이상 조회되지 않는 오래된 Epoch를 버립니다 (Writer Lock 보유 상태에서 호출).
+         *         기준은 가장 느린 커서의 해제 위치와 슬롯에 남아 있는 가장 오래된 시퀀스 (임대/보존/고정 포함) 중 작은 값입니다.
+         */
+        void TrimEpochs();
+
+        /**
+         * @brief  Hard Limit 안에서 할당할 수 있는 최대 슬롯 수 (회전 중 + 회전에서 빠진 슬롯 포함)
+         */
+        size_t GetMaxSlotCount() const;
+
+        /**
+         * @brief  Hard Limit에서 고정 슬롯(과 그 순간 임대 중인 슬롯)을 회전에서 빼내어 나머지 슬롯으로 Producer가 계속 진행하게 합니다.
+         *         빠진 슬롯의 과거 시퀀스는 이전 Epoch로 그대로 조회됩니다.
+         * @return bool  활성 슬롯이 남지 않거나 미소비 프레임을 덮어쓰게 되면 false
+         */
+        bool ParkPinnedSlots(uint64_t sequence);
+        void UnparkSlots();
+
+        /**
+         * @brief  다음 쓰기 시퀀스의 슬롯이 보존/고정/임대 중인지 확인하고, 비어 있으면 임대자보다 먼저 선점합니다.
+         * @return bool  재사용할 수 없으면 false (Back-pressure)
+         */
+        bool ReclaimSlotForWrite(uint64_t sequence);
+
+        struct SlotState;
+        SlotState* GetSlotState(size_t index) const;
+
+        /**
+         * @brief  슬롯 상태를 만들고 스크래치 리소스를 scratch 영역에 연결합니다.
+         */
+        std::unique_ptr<SlotState> MakeSlotState(void* scratch, size_t scratchBytes);
+
+        /**
+         * @brief  새 슬롯에 붙일 스크래치 크기를 정합니다 (요청값 → 학습값 → 기본값, 페이지 정렬).
+         */
+        size_t ResolveScratchStride(size_t requested) const;
+        bool IsRetained(uint64_t sequence, const SlotState& state, uint64_t nowNs) const;
+        bool IsFrozen(uint64_t sequence) const;
+
+        /**
+         * @brief  프로세스가 종료된 공유 링 소비자의 커서와, 붙는 도중 멈춘 자리를 회수합니다 (Back-pressure 해제, 100ms 간격).
+         */
+        void RecoverSharedConsumers();
+        bool HasGatingConsumers() const;
+
+        /**
+         * @brief  커서 중 가장 뒤처진 해제 위치를 반환합니다 (Producer 재사용 한계).
+         */
+        uint64_t GetSlowestReleased() const;
+
+        /**
+         * @brief  Acquire한 프레임의 frameIndex를 직전 프레임과 비교하여 유실(Gap)/중복을 집계합니다.
+         */
+        void CheckFrameSequence(size_t cursor, uint32_t frameIndex, uint64_t nowNs);
+        uint64_t GetUpstreamLimit(size_t upstream) const;
 
         /**
          * @brief  Pinned Memory (Page-Locked) 할당을 수행합니다.
          */
-        void* AllocatePinned(size_t size);
+        void* AllocatePinned(size_t size, int numaNode = -1);
+        static void PrefaultPages(void* p, size_t size);
         void FreePinned(void* p, size_t size);
 
     private:
         bool m_gpuDirect;
+        int m_ringNode;     // 페이로드가 배치된 NUMA 노드 (확장 시에도 유지)
         
         // SoA Pools
         std::vector<void*> m_headers;   // CPU-side cached headers
         std::vector<void*> m_payloads;  // GPU-side pinned payloads (Super-pages)
+        std::vector<void*> m_externalPayloads;       // 슬롯별 외부 페이로드 (nullptr이면 자체 메모리)
+        std::atomic<size_t> m_externalBindings;
         
         size_t m_headerSize;
         size_t m_payloadSize;
+        size_t m_payloadStride;  // 페이지 정렬된 실제 슬롯 간격
+        std::atomic<size_t> m_scratchStride;     // 새 슬롯의 스크래치 크기 (페이로드 할당 뒤에 이어 붙임)
+        std::vector<void*> m_sharedScratch;      // 공유 링: 스크래치는 세그먼트 밖 프로세스 로컬 메모리
         
         std::atomic<size_t> m_slotCount;
+        size_t m_initialSlots;                   // InitializeRing에 요청된 최소 슬롯 수
+        std::atomic<size_t> m_workloadSlots;     // 현재 워크로드 활성 구간에 필요했던 슬롯 수 (프로필 기록용)
         std::atomic<size_t> m_writeIndex;
         std::atomic<size_t> m_readIndex;
+        std::atomic<uint64_t> m_commitIndex;
+
+        // Expansion-safe Sequence → Slot Mapping
+        // 확장 시점마다 Epoch를 추가하여, 확장 이전에 발행된 시퀀스는 기존 배치를 그대로 따릅니다.
+        struct RingEpoch 
+        {
+            uint64_t startSequence;
+            size_t basePosition;
+            std::vector<size_t> order;   // 논리 위치 → 물리 슬롯
+        };
+        std::vector<RingEpoch> m_epochs;
+
+        // Shared-Memory Ring (프로세스 외부 소비자)
+        HANDLE m_sharedMapping;
+        SharedRingControl* m_sharedControl;
+        std::vector<HANDLE> m_sharedEvents;
+        std::chrono::steady_clock::time_point m_lastRecoveryCheck;
+        std::vector<std::chrono::steady_clock::time_point> m_sharedAttachSince;   // 소비자 자리별 붙는 중(2) 상태를 처음 본 시각
+
+        // Stage Cursors
+        struct RingCursor 
+        {
+            std::string name;
+            size_t upstream = kProducerCursor;
+            uint64_t origin = 0;
+            std::atomic<uint64_t> acquired{0};
+            std::atomic<uint64_t> released{0};
+            std::atomic<uint64_t> busyNs{0};
+            std::atomic<bool> detached{false};
+            std::unique_ptr<LatencyHistogram> queueLatency;     // Commit → Acquire
+            std::unique_ptr<LatencyHistogram> serviceLatency;   // Acquire → Release
+
+            // Frame-loss Detection (Acquire는 커서당 한 스레드씩만 수행)
+            std::atomic<uint32_t> lastFrameIndex{0};
+            std::atomic<uint64_t> lostFrames{0};
+            std::atomic<uint64_t> gapEvents{0};
+            std::atomic<uint64_t> duplicateFrames{0};
+            std::atomic<uint64_t> lastLossNs{0};
+        };
+        std::array<RingCursor, kMaxCursors> m_cursors;
+        std::atomic<size_t> m_cursorCount;
+
+        // Frame Loss
+        std::atomic<uint64_t> m_overwrittenFrames;   // 해제되지 않은 슬롯을 Producer가 덮어쓴 횟수
+        mutable std::mutex m_lossMutex;
+        std::deque<FrameLossEvent> m_lossEvents;
+
+        // Cross-node Reads (다중 노드 시스템에서만 집계)
+        std::atomic<uint64_t> m_remoteFrameReads;
+        std::atomic<uint64_t> m_remoteFrameBytes;
+
+        // Cine Retention
+        // 슬롯별 현재 시퀀스/발행 시각/임대 수/스크래치 (확장 시 뒤에 추가, 주소는 고정)
+        struct SlotState 
+        {
+            std::atomic<uint64_t> sequence{kNoSequence};
+            std::atomic<uint64_t> commitNs{0};
+            std::atomic<uint32_t> leases{0};
+            std::array<std::atomic<uint64_t>, kMaxCursors> acquireNs{};   // 커서별 이 슬롯의 프레임을 Acquire한 시각 (Release 시 처리 시간 기준)
+            std::unique_ptr<SlotScratch> scratch;
+        };
+        static constexpr uint64_t kNoSequence = ~uint64_t(0);
+        std::vector<std::unique_ptr<SlotState>> m_slotStates;
+        std::vector<size_t> m_parkedSlots;       // 회전에서 빠진 고정/임대 슬롯 (Producer 스레드 + Writer Lock)
+        std::atomic<size_t> m_parkedCount;
+
+        std::atomic<uint64_t> m_retentionFrames;
+        std::atomic<uint64_t> m_retentionWindowNs;
+        std::atomic<uint64_t> m_frozenBegin;     // 고정 범위 [begin, end), 비어 있으면 고정 아님
+        std::atomic<uint64_t> m_frozenEnd;
+        std::atomic<uint64_t> m_retentionEvictions;
+        std::atomic<uint64_t> m_ringExpansions;
+        bool m_retentionLimitLogged;
+        bool m_expansionLimitLogged;             // AdaptToJitter의 Hard Limit 경고를 이미 출력함
+
+        // Thread Placement (SetThreadPlacement 이후 읽기 전용)
+        std::unique_ptr<ThreadPlacer> m_placer;
+
+        // Streaming Copy-in
+        std::unique_ptr<StreamingCopier> m_copier;
+        static constexpr size_t kPrefetchLines = 16;   // AcquireRead가 미리 가져올 페이로드 캐시 라인 수
+
+        // Payload Integrity
+        bool m_integrityCheck;
+        uint32_t m_integritySeed;
+        std::atomic<uint64_t> m_integrityFailures;
 
         // Monitoring
         std::atomic<size_t> m_totalBytesProcessed;
-        double m_avgThroughputGBs;
+        std::atomic<double> m_avgThroughputGBs;   // Producer만 갱신 (relaxed)
         std::chrono::steady_clock::time_point m_lastThroughputCheck;
 
         // Monitoring thread or point-in-time check
         std::chrono::steady_clock::time_point m_lastAdaptTime;
+        std::chrono::steady_clock::time_point m_lastGovernTime;
+        std::function<void(size_t, size_t)> m_computeGovernor;
+        std::mutex m_governorMutex;
+        std::atomic<RingProgressListener*> m_progressListener;
         
         // Dynamic CUDA Support
         std::optional<CudaFunctions> m_cudaFuncs;
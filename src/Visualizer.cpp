@@ -1,5 +1,6 @@
 #include "Visualizer.h"
-#include "UltrasoundArena.h" // Added for dynamic_cast
+#include <algorithm>
+#include <cfloat>
 #include <stdexcept>
 
 namespace AdaptiveArena 
@@ -40,7 +41,8 @@ namespace AdaptiveArena
         ImGui_ImplGlfw_InitForOpenGL(m_window, true);
         ImGui_ImplOpenGL3_Init("#version 130");
 
-        m_usageHistory.reserve(MAX_HISTORY);
+        m_points.reserve(MAX_HISTORY);
+        m_plot.reserve(MAX_HISTORY);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,13 +80,20 @@ namespace AdaptiveArena
     {
         if (!arena) return;
 
+        // 한 장의 스냅샷 (샘플러가 꺼져 있으면 직접 수집, 이때는 시계열 그래프가 비어 있음)
+        TelemetrySnapshot t = arena->GetTelemetry();
+        if (t.sequence == 0) 
+        {
+            arena->CaptureTelemetry(t);
+        }
+
         ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
         ImGui::SetNextWindowSize(ImVec2(520, 600), ImGuiCond_FirstUseEver);
 
         if (ImGui::Begin("🏟️ Adaptive Arena Dashboard")) 
         {
             // 0. Mode Indicator
-            size_t totalSlots = arena->GetRingBufferSize();
+            size_t totalSlots = static_cast<size_t>(t.ringSlots);
             bool isUltrasound = (totalSlots > 0);
             
             ImGui::TextColored(isUltrasound ? ImVec4(0.2f, 0.8f, 1.0f, 1.0f) : ImVec4(1.0f, 0.8f, 0.2f, 1.0f), 
@@ -92,9 +101,7 @@ namespace AdaptiveArena
 
             if (isUltrasound) 
             {
-                // check if CUDA is active by casting to UltrasoundArena
-                auto* usArena = dynamic_cast<UltrasoundArena*>(arena);
-                if (usArena && usArena->IsCudaActive()) 
+                if (t.cudaActive) 
                 {
                     ImGui::SameLine();
                     ImGui::TextColored(ImVec4(0.2f, 1.0f, 0.2f, 1.0f), " [CUDA ENABLED]");
@@ -111,16 +118,35 @@ namespace AdaptiveArena
             // 1. Statistics Summary
             ImGui::Text("System Status:");
             
-            float currentMB = arena->GetCurrentUsage() / (1024.0f * 1024.0f);
-            float peakMB = arena->GetPeakUsage() / (1024.0f * 1024.0f);
-            float predictedMB = arena->GetPredictedSize() / (1024.0f * 1024.0f);
+            float currentMB = t.currentUsage / (1024.0f * 1024.0f);
+            float peakMB = t.peakUsage / (1024.0f * 1024.0f);
+            float predictedMB = t.predictedBytes / (1024.0f * 1024.0f);
 
             ImGui::Columns(2, "StatsColumns");
+            ImGui::Text("Workload:"); ImGui::NextColumn(); ImGui::Text("%s", t.workloadKey); ImGui::NextColumn();
             ImGui::Text("Current Usage:"); ImGui::NextColumn(); ImGui::Text("%.2f MB", currentMB); ImGui::NextColumn();
             ImGui::Text("Session Peak:"); ImGui::NextColumn(); ImGui::Text("%.2f MB", peakMB); ImGui::NextColumn();
             if (!isUltrasound) {
                 ImGui::Text("EMA Prediction:"); ImGui::NextColumn(); ImGui::Text("%.2f MB", predictedMB); ImGui::NextColumn();
             }
+
+            const NumaTelemetry& numa = t.numa;
+            ImGui::Text("NUMA Nodes:"); ImGui::NextColumn(); ImGui::Text("%zu", numa.nodeCount); ImGui::NextColumn();
+            if (numa.nodeCount > 1) 
+            {
+                ImGui::Text("Cross-Node Allocs:"); ImGui::NextColumn();
+                ImGui::Text("%llu / %llu (%.2f MB)", static_cast<unsigned long long>(numa.remoteAllocations), 
+                            static_cast<unsigned long long>(numa.localAllocations + numa.remoteAllocations), 
+                            numa.remoteBytes / (1024.0 * 1024.0));
+                ImGui::NextColumn();
+                if (isUltrasound) 
+                {
+                    ImGui::Text("Cross-Node Reads:"); ImGui::NextColumn();
+                    ImGui::TextColored(numa.remoteFrameReads > 0 ? ImVec4(1,1,0.2f,1) : ImVec4(1,1,1,1), "%llu (%.2f MB)", 
+                                       static_cast<unsigned long long>(numa.remoteFrameReads), numa.remoteFrameBytes / (1024.0 * 1024.0));
+                    ImGui::NextColumn();
+                }
+            }
             ImGui::Columns(1);
 
             if (isUltrasound) 
@@ -129,25 +155,53 @@ namespace AdaptiveArena
                 ImGui::Text("Ring Buffer (Jitter Control):");
                 ImGui::Separator();
                 
-                size_t occupancy = arena->GetRingBufferOccupancy();
-                size_t predictedSlots = arena->GetPredictedSlotCount();
-                double throughput = arena->GetAverageThroughputGBs();
+                size_t occupancy = static_cast<size_t>(t.ringLag);
 
                 ImGui::Columns(2, "RingColumns");
-                ImGui::Text("Total Slots:"); ImGui::NextColumn(); ImGui::Text("%zu", totalSlots); ImGui::NextColumn();
+                ImGui::Text("Total Slots:"); ImGui::NextColumn(); ImGui::Text("%zu (%llu expansions)", totalSlots, static_cast<unsigned long long>(t.ringExpansions)); ImGui::NextColumn();
                 ImGui::Text("Super-Pages:"); ImGui::NextColumn(); ImGui::Text("%zu", totalSlots); ImGui::NextColumn();
                 ImGui::Text("Current Lag:"); ImGui::NextColumn(); 
                 ImGui::TextColored(occupancy > totalSlots * 0.8 ? ImVec4(1,0,0,1) : ImVec4(1,1,1,1), "%zu", occupancy); 
                 ImGui::NextColumn();
-                ImGui::Text("Throughput:"); ImGui::NextColumn(); ImGui::Text("%.2f GB/s", throughput); ImGui::NextColumn();
+                ImGui::Text("Throughput:"); ImGui::NextColumn(); ImGui::Text("%.2f GB/s", t.throughputGBs); ImGui::NextColumn();
+                ImGui::Text("Dropped Frames:"); ImGui::NextColumn(); 
+                ImGui::TextColored(t.droppedFrames > 0 ? ImVec4(1,0,0,1) : ImVec4(1,1,1,1), "%llu", static_cast<unsigned long long>(t.droppedFrames)); 
+                ImGui::NextColumn();
+                ImGui::Text("Cine Retained:"); ImGui::NextColumn();
+                ImGui::Text("%llu frames%s", static_cast<unsigned long long>(t.retainedFrames), t.retentionFrozen ? " (FROZEN)" : "");
+                ImGui::NextColumn();
+                ImGui::Text("Slot Scratch:"); ImGui::NextColumn();
+                ImGui::TextColored(t.scratchOverflows > 0 ? ImVec4(1,1,0,1) : ImVec4(1,1,1,1), "%llu KB (%llu overflows)", 
+                                   static_cast<unsigned long long>(t.scratchBytes / 1024), static_cast<unsigned long long>(t.scratchOverflows));
+                ImGui::NextColumn();
                 ImGui::Columns(1);
                 
-                // Jitter Graph
-                static std::vector<float> jitterHistory;
-                if (jitterHistory.size() > 100) jitterHistory.erase(jitterHistory.begin());
-                jitterHistory.push_back(static_cast<float>(occupancy));
-                
-                ImGui::PlotLines("##JitterGraph", jitterHistory.data(), (int)jitterHistory.size(), 0, "Processing Lag (Frames)", 0.0f, static_cast<float>(totalSlots), ImVec2(0, 80));
+                // Jitter Graph (구간 최대 Lag)
+                PlotSeries(*arena, TelemetrySeries::RingLag, t.timestampNs, "##JitterGraph", "Processing Lag (Frames, max)", true, 1.0f, static_cast<float>(totalSlots), 80.0f);
+                PlotSeries(*arena, TelemetrySeries::QueueLatencyP99Us, t.timestampNs, "##QueueP99Graph", "E2E P99 (us, max)", true, 1.0f, 0.0f, 60.0f);
+
+                // Pipeline Stages (Cursor별 Lag / 처리 시간 / Commit → Acquire 꼬리 지연)
+                size_t stageCount = std::min<size_t>(static_cast<size_t>(t.stageCount), kMaxTelemetryStages);
+                if (stageCount > 0) 
+                {
+                    ImGui::Spacing();
+                    ImGui::Text("Pipeline Stages:");
+                    ImGui::Columns(6, "StageColumns");
+                    ImGui::Text("Stage"); ImGui::NextColumn(); ImGui::Text("Lag"); ImGui::NextColumn(); ImGui::Text("Avg Service"); ImGui::NextColumn();
+                    ImGui::Text("E2E P50/P99"); ImGui::NextColumn(); ImGui::Text("P99.9/Max"); ImGui::NextColumn(); ImGui::Text("Lost/Dup"); ImGui::NextColumn();
+                    for (size_t i = 0; i < stageCount; ++i) 
+                    {
+                        const StageTelemetry& stage = t.stages[i];
+                        ImGui::Text("%s", stage.name); ImGui::NextColumn();
+                        ImGui::TextColored(stage.lag > totalSlots * 0.8 ? ImVec4(1,0,0,1) : ImVec4(1,1,1,1), "%llu", static_cast<unsigned long long>(stage.lag)); ImGui::NextColumn();
+                        ImGui::Text("%.1f us", stage.avgServiceUs); ImGui::NextColumn();
+                        ImGui::Text("%.0f / %.0f us", stage.queueLatency.p50Us, stage.queueLatency.p99Us); ImGui::NextColumn();
+                        ImGui::Text("%.0f / %.0f us", stage.queueLatency.p999Us, stage.queueLatency.maxUs); ImGui::NextColumn();
+                        ImGui::TextColored(stage.lostFrames > 0 ? ImVec4(1,0,0,1) : ImVec4(1,1,1,1), "%llu / %llu",
+                                           static_cast<unsigned long long>(stage.lostFrames), static_cast<unsigned long long>(stage.duplicateFrames)); ImGui::NextColumn();
+                    }
+                    ImGui::Columns(1);
+                }
             }
 
             // 2. Performance Benchmarks
@@ -155,27 +209,41 @@ namespace AdaptiveArena
             ImGui::Text("⚡ Performance Benchmarks:");
             ImGui::Separator();
             
-            double latencyNS = arena->GetLastAllocationLatencyNS();
-            ImGui::Text("Last Allocation Latency: %.1f ns", latencyNS);
-            
-            static std::vector<float> latencyHistory;
-            if (latencyHistory.size() > 100) latencyHistory.erase(latencyHistory.begin());
-            latencyHistory.push_back(static_cast<float>(latencyNS));
-
-            ImGui::PlotLines("##LatencyGraph", latencyHistory.data(), (int)latencyHistory.size(), 0, "Latency (ns)", 0.0f, 2000.0f, ImVec2(0, 80));
+            ImGui::Text("Last Allocation Latency: %.1f ns", t.lastAllocationLatencyNs);
+            PlotSeries(*arena, TelemetrySeries::AllocationLatencyNs, t.timestampNs, "##LatencyGraph", "Latency (ns, max)", true, 1.0f, 2000.0f, 80.0f);
 
-            // 3. Real-time Graph
+            // 3. Telemetry Graph (시간 창 선택: 오래된 구간은 1초/10초/1분 해상도로)
             ImGui::Spacing();
-            ImGui::Text("Memory Telemetry (Real-time):");
-            
-            // 히스토리 업데이트
-            if (m_usageHistory.size() >= MAX_HISTORY) 
+            ImGui::Text("Memory Telemetry:");
+            ImGui::SameLine();
+            static const char* const kWindowLabels[] = { "1 min", "10 min", "1 hour", "6 hours", "24 hours" };
+            ImGui::Combo("##HistoryWindow", &m_windowIndex, kWindowLabels, IM_ARRAYSIZE(kWindowLabels));
+            PlotSeries(*arena, TelemetrySeries::UsageBytes, t.timestampNs, "##UsageGraph", "Usage (MB, mean)", false, 1.0f / (1024.0f * 1024.0f), peakMB * 1.2f + 1.0f, 120.0f);
+
+            // 4. Allocation Sites (샘플링 프로파일러가 켜져 있을 때: 추정 누적 바이트 상위 위치)
+            m_sites.clear();
+            if (arena->GetAllocationSites(m_sites, 8) > 0) 
             {
-                m_usageHistory.erase(m_usageHistory.begin());
+                ImGui::Spacing();
+                ImGui::Text("Allocation Sites (sampled):");
+                ImGui::Separator();
+                ImGui::Columns(4, "SiteColumns");
+                ImGui::Text("Stack / Caller"); ImGui::NextColumn(); ImGui::Text("Total"); ImGui::NextColumn(); 
+                ImGui::Text("Live / @Peak"); ImGui::NextColumn(); ImGui::Text("Samples / Avg"); ImGui::NextColumn();
+                for (const AllocationSite& site : m_sites) 
+                {
+                    ImGui::Text("%08X 0x%llx", site.stackHash, static_cast<unsigned long long>(site.frameCount > 1 ? site.frames[1] : 0)); ImGui::NextColumn();
+                    ImGui::Text("%.1f MB", site.totalBytes / (1024.0 * 1024.0)); ImGui::NextColumn();
+                    ImGui::Text("%.1f / %.1f MB", site.liveBytes / (1024.0 * 1024.0), site.liveAtPeakBytes / (1024.0 * 1024.0)); ImGui::NextColumn();
+                    ImGui::Text("%llu / %llu B", static_cast<unsigned long long>(site.samples), 
+                                static_cast<unsigned long long>(site.samples ? site.sampledBytes / site.samples : 0)); ImGui::NextColumn();
+                }
+                ImGui::Columns(1);
+                if (ImGui::Button("Dump Allocation Profile", ImVec2(-1, 0))) 
+                {
+                    arena->DumpAllocationProfile("./allocation_profile.txt");
+                }
             }
-            m_usageHistory.push_back(currentMB);
-
-            ImGui::PlotLines("##UsageGraph", m_usageHistory.data(), (int)m_usageHistory.size(), 0, "Usage (MB)", 0.0f, peakMB * 1.2f + 1.0f, ImVec2(0, 120));
 
             // 3. Actions
             ImGui::Spacing();
@@ -194,6 +262,29 @@ namespace AdaptiveArena
         ImGui::End();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PlotSeries
+    void Visualizer::PlotSeries(const Resource& arena, TelemetrySeries series, uint64_t nowNs, const char* id, const char* overlay, 
+                                bool useMax, float scale, float maxValue, float height) 
+    {
+        static constexpr uint64_t kWindowSeconds[] = { 60, 600, 3600, 6 * 3600, 24 * 3600 };
+        const uint64_t windowNs = kWindowSeconds[m_windowIndex] * 1000000000ull;
+
+        m_points.clear();
+        m_plot.clear();
+        if (nowNs > 0) 
+        {
+            arena.QueryTelemetrySeries(series, nowNs > windowNs ? nowNs - windowNs : 0, nowNs, MAX_HISTORY, m_points);
+        }
+        for (const SeriesPoint& point : m_points) 
+        {
+            m_plot.push_back(static_cast<float>((useMax ? point.max : point.mean) * scale));
+        }
+
+        // maxValue가 0이면 자동 범위
+        ImGui::PlotLines(id, m_plot.data(), (int)m_plot.size(), 0, overlay, 0.0f, maxValue > 0.0f ? maxValue : FLT_MAX, ImVec2(0, height));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // EndFrame
     void Visualizer::EndFrame() 
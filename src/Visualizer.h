@@ -36,7 +36,8 @@ namespace AdaptiveArena
         void StartFrame();
 
         /**
-         * @brief  Arena 리소스의 상태를 UI로 렌더링합니다.
+         * @brief  Arena 리소스의 상태를 UI로 렌더링합니다. 값은 샘플러가 게시한 TelemetrySnapshot 한 장에서 읽으므로
+         *         렌더링은 아레나 잠금을 잡지 않고, 그래프는 선택한 시간 창(1분 ~ 24시간)을 다중 해상도 시계열에서 조회합니다.
          */
         void RenderDashboard(Resource* arena);
 
@@ -45,10 +46,20 @@ namespace AdaptiveArena
          */
         void EndFrame();
 
+    private:
+        /**
+         * @brief  선택한 시간 창의 시계열을 조회하여 그립니다 (useMax면 구간 최대값: 거친 해상도에서도 스파이크가 보임).
+         */
+        void PlotSeries(const Resource& arena, TelemetrySeries series, uint64_t nowNs, const char* id, const char* overlay, 
+                        bool useMax, float scale, float maxValue, float height);
+
     private:
         GLFWwindow* m_window;
-        std::vector<float> m_usageHistory;
-        const size_t MAX_HISTORY = 200;
+        int m_windowIndex = 0;                  // 그래프 시간 창 (kWindowSeconds 인덱스)
+        std::vector<SeriesPoint> m_points;      // 조회 버퍼 (매 프레임 재사용)
+        std::vector<float> m_plot;
+        std::vector<AllocationSite> m_sites;
+        const size_t MAX_HISTORY = 200;         // 그래프 하나의 최대 점 수
     };
 
 } // namespace AdaptiveArena
@@ -0,0 +1,283 @@
+#define NOMINMAX
+#include "WorkStealingExecutor.h"
+#include <algorithm>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructor
+    WorkStealingExecutor::WorkStealingExecutor(UltrasoundArena& arena,
+                                               const std::string& name,
+                                               TaskFunc func,
+                                               size_t maxWorkers,
+                                               size_t upstream)
+        : m_arena(arena)
+        , m_func(std::move(func))
+        , m_cursor(arena.AddCursor(name, upstream))
+        , m_activeWorkers(std::max<size_t>(1, maxWorkers))
+        , m_running(false)
+        , m_stopRequested(false)
+        , m_governorAttached(false)
+        , m_claimedEnd(0)
+        , m_done(kReorderWindow)
+        , m_nextCommit(0)
+        , m_steals(0)
+    {
+        for (size_t i = 0; i < std::max<size_t>(1, maxWorkers); ++i)
+        {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+
+        for (auto& flag : m_done)
+        {
+            flag.store(0, std::memory_order_relaxed);
+        }
+
+        // 커서가 합류한 위치부터 순서대로 Commit
+        uint64_t origin = m_arena.GetCursorAcquired(m_cursor);
+        m_claimedEnd = origin;
+        m_nextCommit = origin;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Destructor
+    WorkStealingExecutor::~WorkStealingExecutor()
+    {
+        if (m_governorAttached)
+        {
+            m_arena.SetComputeGovernor(nullptr);
+        }
+        Stop();
+
+        // 소멸 후에도 커서가 남아 Producer를 막지 않도록 분리
+        m_arena.DetachCursor(m_cursor);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Start
+    void WorkStealingExecutor::Start()
+    {
+        if (m_running.exchange(true)) return;
+
+        m_stopRequested = false;
+        for (size_t i = 0; i < m_workers.size(); ++i)
+        {
+            m_workers[i]->thread = std::thread(&WorkStealingExecutor::WorkerLoop, this, i);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stop
+    void WorkStealingExecutor::Stop()
+    {
+        if (!m_running.exchange(false)) return;
+
+        m_stopRequested = true;
+        for (auto& worker : m_workers)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SetWorkerCount
+    void WorkStealingExecutor::SetWorkerCount(size_t count)
+    {
+        m_activeWorkers.store(std::clamp<size_t>(count, 1, m_workers.size()), std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // AttachToGovernor
+    void WorkStealingExecutor::AttachToGovernor()
+    {
+        m_governorAttached = true;
+        m_arena.SetComputeGovernor([this](size_t predictedLag, size_t slotCount)
+        {
+            size_t active = GetWorkerCount();
+            if (predictedLag * 4 >= slotCount * 3)
+            {
+                SetWorkerCount(active + 1);
+            }
+            else if (predictedLag * 4 <= slotCount && active > 1)
+            {
+                SetWorkerCount(active - 1);
+            }
+        });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WorkerLoop
+    void WorkStealingExecutor::WorkerLoop(size_t self)
+    {
+        m_arena.ApplyThreadPlacement(ThreadRole::Worker, self);
+        size_t idleSpins = 0;
+
+        while (true)
+        {
+            Task task{};
+            bool found = PopLocal(self, task) || StealHalf(self, task);
+            if (!found && self < GetWorkerCount())
+            {
+                found = ClaimBatch(self, task);
+            }
+
+            if (found)
+            {
+                idleSpins = 0;
+                m_func(task.index, m_arena.GetHeader(task.index), m_arena.GetPayload(task.index));
+                Complete(task.sequence);
+                continue;
+            }
+
+            // 정지 요청 시: 발행된 프레임을 모두 가져가 Commit까지 끝났을 때만 종료
+            if (m_stopRequested)
+            {
+                bool drained = m_arena.GetCursorAcquired(m_cursor) >= m_arena.GetCursorUpstreamLimit(m_cursor);
+                if (drained && m_nextCommit.load() >= m_claimedEnd.load()) break;
+
+                // 비활성 작업자도 정지 시에는 남은 프레임 처리를 돕는다
+                if (ClaimBatch(self, task))
+                {
+                    m_func(task.index, m_arena.GetHeader(task.index), m_arena.GetPayload(task.index));
+                    Complete(task.sequence);
+                    continue;
+                }
+            }
+
+            if (++idleSpins < 64)
+            {
+                continue;
+            }
+            else if (idleSpins < 1024)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PopLocal
+    bool WorkStealingExecutor::PopLocal(size_t self, Task& out)
+    {
+        Worker& worker = *m_workers[self];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.tasks.empty()) return false;
+
+        // 가장 오래된 시퀀스부터 처리하여 Reorder 대기를 최소화
+        out = worker.tasks.front();
+        worker.tasks.pop_front();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // StealHalf
+    bool WorkStealingExecutor::StealHalf(size_t self, Task& out)
+    {
+        const size_t count = m_workers.size();
+        std::deque<Task> stolen;
+
+        for (size_t step = 1; step < count && stolen.empty(); ++step)
+        {
+            Worker& victim = *m_workers[(self + step) % count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) continue;
+
+            // 피해자의 뒤쪽(가장 최신) 절반을 가져옴
+            size_t take = (victim.tasks.size() + 1) / 2;
+            auto first = victim.tasks.end() - static_cast<std::ptrdiff_t>(take);
+            stolen.assign(first, victim.tasks.end());
+            victim.tasks.erase(first, victim.tasks.end());
+        }
+
+        if (stolen.empty()) return false;
+
+        m_steals.fetch_add(1, std::memory_order_relaxed);
+        out = stolen.front();
+        stolen.pop_front();
+
+        if (!stolen.empty())
+        {
+            Worker& worker = *m_workers[self];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.tasks.insert(worker.tasks.end(), stolen.begin(), stolen.end());
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ClaimBatch
+    bool WorkStealingExecutor::ClaimBatch(size_t self, Task& out)
+    {
+        std::unique_lock<std::mutex> claimLock(m_claimMutex, std::try_to_lock);
+        if (!claimLock.owns_lock()) return false;
+
+        uint64_t acquired = m_arena.GetCursorAcquired(m_cursor);
+        uint64_t limit = m_arena.GetCursorUpstreamLimit(m_cursor);
+        if (acquired >= limit) return false;
+
+        uint64_t inFlight = m_claimedEnd.load() - m_nextCommit.load();
+        if (inFlight >= kReorderWindow) return false;
+
+        // 한 번에 가용 프레임을 활성 작업자 수로 나눈 만큼 가져가고, 나머지는 다른 작업자가 훔쳐가도록 둔다
+        uint64_t available = limit - acquired;
+        size_t batch = static_cast<size_t>(std::max<uint64_t>(1, available / GetWorkerCount()));
+        batch = std::min<size_t>(batch, kReorderWindow - static_cast<size_t>(inFlight));
+
+        std::deque<Task> claimed;
+        for (size_t i = 0; i < batch; ++i)
+        {
+            Task task{};
+            if (!m_arena.TryAcquire(m_cursor, task.index, task.sequence)) break;
+            claimed.push_back(task);
+        }
+        if (claimed.empty()) return false;
+
+        m_claimedEnd.store(claimed.back().sequence + 1);
+        claimLock.unlock();
+
+        out = claimed.front();
+        claimed.pop_front();
+
+        if (!claimed.empty())
+        {
+            Worker& worker = *m_workers[self];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.tasks.insert(worker.tasks.end(), claimed.begin(), claimed.end());
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Complete
+    void WorkStealingExecutor::Complete(uint64_t sequence)
+    {
+        const uint64_t mask = kReorderWindow - 1;
+        m_done[sequence & mask].store(1);
+
+        // Reorder/Commit: 연속으로 완료된 시퀀스만 순서대로 하류에 Release.
+        // Commit 중인 스레드가 있으면 그 스레드가 이어서 처리하고, 놓친 완료는 해제 직후 재확인으로 회수한다.
+        while (true)
+        {
+            if (m_commitLock.test_and_set()) return;
+
+            uint64_t next = m_nextCommit.load();
+            while (m_done[next & mask].load())
+            {
+                m_done[next & mask].store(0);
+                m_arena.Release(m_cursor);
+                m_nextCommit.store(++next);
+            }
+
+            m_commitLock.clear();
+            if (!m_done[next & mask].load()) return;
+        }
+    }
+
+} // namespace AdaptiveArena
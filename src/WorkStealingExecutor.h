@@ -0,0 +1,123 @@
+#pragma once
+
+#include "UltrasoundArena.h"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AdaptiveArena
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief  N개의 작업자가 링 슬롯을 동시에 처리하되, 하류에는 frameIndex 순서대로 슬롯을 넘겨주는 Work-Stealing 실행기입니다.
+     *         작업자마다 Deque를 가지며, 유휴 작업자는 다른 작업자의 Deque에서 절반을 훔쳐옵니다 (Steal-Half).
+     *         완료 순서와 무관하게 Reorder/Commit 단계가 커서를 시퀀스 순서로만 Release 합니다.
+     */
+    class WorkStealingExecutor
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Types
+    public:
+        using TaskFunc = std::function<void(size_t index, void* header, void* payload)>;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor and Destructor
+    public:
+        /**
+         * @param  arena       대상 링
+         * @param  name        커서/텔레메트리 이름
+         * @param  func        슬롯 처리 함수 (여러 작업자 스레드에서 동시에 호출됨)
+         * @param  maxWorkers  생성할 최대 작업자 수
+         * @param  upstream    상류 커서 ID (기본: Producer)
+         */
+        WorkStealingExecutor(UltrasoundArena& arena,
+                             const std::string& name,
+                             TaskFunc func,
+                             size_t maxWorkers,
+                             size_t upstream = UltrasoundArena::kProducerCursor);
+        ~WorkStealingExecutor();
+
+        WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+        WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Public Methods
+    public:
+        void Start();
+
+        /**
+         * @brief  이미 발행된 프레임까지 처리/Commit 한 뒤 모든 작업자를 정지합니다.
+         */
+        void Stop();
+
+        /**
+         * @brief  새 슬롯을 가져오는 활성 작업자 수를 조절합니다 (1 ~ maxWorkers).
+         *         비활성 작업자도 자신의 Deque에 남은 작업은 끝까지 처리합니다.
+         */
+        void SetWorkerCount(size_t count);
+        size_t GetWorkerCount() const { return m_activeWorkers.load(std::memory_order_relaxed); }
+        size_t GetMaxWorkers() const { return m_workers.size(); }
+
+        /**
+         * @brief  UltrasoundArena의 지터 Governor에 연결하여 Lag에 따라 작업자 수를 자동 조절합니다.
+         *         예측 Lag이 링의 3/4를 넘으면 작업자를 늘리고, 1/4 아래로 내려가면 줄입니다.
+         */
+        void AttachToGovernor();
+
+        /**
+         * @brief  하류 단계가 상류로 지정할 커서 ID (순서가 보장된 Release 위치)
+         */
+        size_t GetCursor() const { return m_cursor; }
+        uint64_t GetStealCount() const { return m_steals.load(std::memory_order_relaxed); }
+
+    private:
+        struct Task
+        {
+            uint64_t sequence;
+            size_t index;
+        };
+
+        struct Worker
+        {
+            std::thread thread;
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void WorkerLoop(size_t self);
+        bool PopLocal(size_t self, Task& out);
+        bool StealHalf(size_t self, Task& out);
+        bool ClaimBatch(size_t self, Task& out);
+        void Complete(uint64_t sequence);
+
+    private:
+        // Reorder Window: 동시에 진행 중인 시퀀스의 최대 수 (2의 거듭제곱)
+        static constexpr size_t kReorderWindow = 1024;
+
+        UltrasoundArena& m_arena;
+        TaskFunc m_func;
+        size_t m_cursor;
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::atomic<size_t> m_activeWorkers;
+        std::atomic<bool> m_running;
+        std::atomic<bool> m_stopRequested;
+        bool m_governorAttached;
+
+        // Claim (커서 Acquire는 단일 소비자 API이므로 직렬화)
+        std::mutex m_claimMutex;
+        std::atomic<uint64_t> m_claimedEnd;
+
+        // Reorder / Commit
+        std::vector<std::atomic<uint8_t>> m_done;
+        std::atomic<uint64_t> m_nextCommit;
+        std::atomic_flag m_commitLock = ATOMIC_FLAG_INIT;
+
+        std::atomic<uint64_t> m_steals;
+    };
+
+} // namespace AdaptiveArena
@@ -0,0 +1,127 @@
+#define NOMINMAX
+#include "AdaptiveArena.h"
+#include "../src/UltrasoundArena.h"
+#include "../src/SessionReplay.h"
+#include "../src/TelemetryExporter.h"
+#include <windows.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+    std::atomic<bool> g_running{ true };
+
+    BOOL WINAPI OnConsoleSignal(DWORD)
+    {
+        g_running.store(false);
+        return TRUE;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief  GUI/GPU 없이 초음파 모드 아레나를 실행하고 지표를 Prometheus 엔드포인트와 JSON-lines 파일로 내보내는 헤드리스 호스트입니다.
+ *         사용법: arena_headless [--port N] [--jsonl path] [--rate hz] [recording]
+ *         녹화 파일을 주면 원래 속도로 반복 재생하고, 없으면 30fps 합성 프레임을 생성합니다. Ctrl+C로 종료합니다.
+ */
+int main(int argc, char* argv[])
+{
+    AdaptiveArena::ExporterOptions exporterOptions;
+    double telemetryRate = 10.0;
+    std::string recording;
+
+    for (int i = 1; i < argc; ++i) 
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--port") == 0 && hasValue) exporterOptions.port = static_cast<uint16_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--jsonl") == 0 && hasValue) exporterOptions.jsonLinesPath = argv[++i];
+        else if (std::strcmp(argv[i], "--rate") == 0 && hasValue) telemetryRate = std::atof(argv[++i]);
+        else recording = argv[i];
+    }
+
+    try 
+    {
+        // 1. Arena Initialization (Ultrasound Mode, GPU 없이)
+        auto arena = AdaptiveArena::Builder()
+                        .SetKey("UltrasoundRF_Key")
+                        .SetPath("./ultrasound_session.bin")
+                        .SetMode(AdaptiveArena::ArenaMode::UltrasoundRF)
+                        .SetGpuDirect(false)
+                        .SetTelemetryRate(telemetryRate)
+                        .Build();
+
+        auto* ultrasound = dynamic_cast<AdaptiveArena::UltrasoundArena*>(arena.get());
+        ultrasound->InitializeRing(512, 1024 * 1024 * 4, 8);
+        const size_t consumer = ultrasound->AddCursor("process");
+
+        // 2. Exporter (텔레메트리 역할: 아레나 코어와 분리, 배치 명세가 꺼져 있으면 무시)
+        AdaptiveArena::TelemetryExporter exporter(*arena, exporterOptions);
+        exporter.Start();
+        SetConsoleCtrlHandler(OnConsoleSignal, TRUE);
+
+        // 3. Producer: 녹화 재생 또는 30fps 합성 프레임
+        std::unique_ptr<AdaptiveArena::SessionReplay> replay;
+        std::thread producer;
+        if (!recording.empty()) 
+        {
+            AdaptiveArena::ReplayOptions options;
+            options.pace = AdaptiveArena::ReplayPace::Original;
+            options.loops = 0;
+
+            replay = std::make_unique<AdaptiveArena::SessionReplay>(*ultrasound, recording);
+            replay->Start(options);
+        }
+        else 
+        {
+            producer = std::thread([&]() 
+            {
+                ultrasound->ApplyThreadPlacement(AdaptiveArena::ThreadRole::Producer);
+                auto next = std::chrono::steady_clock::now();
+                while (g_running.load()) 
+                {
+                    size_t index;
+                    if (ultrasound->TryClaimWrite(index)) 
+                    {
+                        std::memset(ultrasound->GetPayload(index), 0, 4096);
+                        ultrasound->CommitWrite();
+                    }
+                    next += std::chrono::microseconds(33333);
+                    std::this_thread::sleep_until(next);
+                }
+            });
+        }
+
+        // 4. Consumer (메인 스레드)
+        ultrasound->ApplyThreadPlacement(AdaptiveArena::ThreadRole::Consumer);
+        while (g_running.load()) 
+        {
+            size_t index;
+            if (ultrasound->TryAcquire(consumer, index)) 
+            {
+                ultrasound->Release(consumer);
+            }
+            else 
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        if (replay) replay->Stop();
+        if (producer.joinable()) producer.join();
+        ultrasound->DetachCursor(consumer);
+        exporter.Stop();
+        std::cout << "[Internal] Headless host stopped (" << exporter.GetScrapeCount() << " scrapes, " 
+                  << exporter.GetLinesWritten() << " JSON lines)." << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Fatal Error: " << e.what() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -14,6 +14,7 @@
 #include "AdaptiveArena.h"
 #include "Visualizer.h"
 #include "../src/UltrasoundArena.h" // For InitializeRing specialized API
+#include "../src/SessionReplay.h"
 #include <iostream>
 #include <vector>
 #include <thread>
@@ -22,8 +23,9 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /**
  * @brief  초음파 RF 데이터 처리 모드(Zero-Copy & Jitter-Adaptive) 시뮬레이션입니다.
+ *         인자로 녹화 파일 경로를 넘기면 버튼 대신 녹화된 세션을 원래 속도로 반복 재생합니다.
  */
-int main()
+int main(int argc, char* argv[])
 {
     try 
     {
@@ -41,6 +43,20 @@ int main()
         {
             // 헤더 512B, 페이로드 4MB (예시), 초기 슬롯 8개
             ultrasound->InitializeRing(512, 1024 * 1024 * 4, 8);
+
+            // GUI 스레드는 아레나 코어와 분리 (배치 명세가 꺼져 있으면 무시됨)
+            ultrasound->ApplyThreadPlacement(AdaptiveArena::ThreadRole::Telemetry);
+        }
+
+        std::unique_ptr<AdaptiveArena::SessionReplay> replay;
+        if (ultrasound && argc > 1) 
+        {
+            AdaptiveArena::ReplayOptions options;
+            options.pace = AdaptiveArena::ReplayPace::Original;
+            options.loops = 0;
+
+            replay = std::make_unique<AdaptiveArena::SessionReplay>(*ultrasound, argv[1]);
+            replay->Start(options);
         }
 
         // 2. Visualizer Initialization
@@ -0,0 +1,482 @@
+#define NOMINMAX
+#include "AdaptiveArena.h"
+#include "../src/LatencyHistogram.h"
+#include <malloc.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Configuration
+    // 스레드마다 미해제 블록 창(window)을 유지하며 "창의 한 칸 해제 → 새 크기로 할당"을 반복합니다.
+    // 크기와 칸 순서는 미리 뽑아 두므로 측정 구간에는 할당기 호출과 시계 읽기만 들어갑니다.
+
+    constexpr size_t kTableSize = 4096;                        // 미리 뽑은 크기/칸 순서 (2의 거듭제곱)
+    constexpr size_t kLiveBytesPerThread = 4 * 1024 * 1024;    // 스레드당 미해제 바이트 목표 (창 크기 결정)
+    constexpr size_t kMinWindow = 8;
+    constexpr size_t kMaxWindow = 1024;
+
+    struct SizeDistribution
+    {
+        const char* name;
+        const char* description;
+    };
+
+    const SizeDistribution kDistributions[] =
+    {
+        { "small",  "uniform 8 B - 256 B" },
+        { "medium", "log-uniform 256 B - 64 KB" },
+        { "large",  "log-uniform 64 KB - 4 MB" },
+        { "mixed",  "80% small, 15% medium, 5% large" },
+    };
+
+    const char* const kResources[] = { "arena", "unsync_pool", "sync_pool", "new_delete", "malloc" };
+
+    struct BenchConfig
+    {
+        std::string distribution;
+        size_t alignment;
+        size_t threads;
+        std::string resource;
+    };
+
+    struct BenchResult
+    {
+        BenchConfig config;
+        size_t window = 0;
+        uint64_t pairs = 0;                      // 반복 합계 (해제 + 할당 한 쌍)
+        double medianOpsPerSec = 0.0;            // 호출 수 기준 (할당과 해제를 각각 1회로)
+        double bestOpsPerSec = 0.0;
+        AdaptiveArena::LatencyPercentiles allocate;
+        AdaptiveArena::LatencyPercentiles deallocate;
+        uint64_t failures = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MallocResource
+    // 시스템 malloc 기준선 (기본 정렬을 넘으면 _aligned_malloc)
+    class MallocResource : public std::pmr::memory_resource
+    {
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            void* p = (alignment <= alignof(std::max_align_t)) ? std::malloc(bytes) : _aligned_malloc(bytes, alignment);
+            if (!p) throw std::bad_alloc();
+            return p;
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            (void)bytes;
+            if (alignment <= alignof(std::max_align_t)) std::free(p);
+            else _aligned_free(p);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // DrawSize
+    size_t DrawSize(const std::string& distribution, std::mt19937_64& rng)
+    {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        auto logUniform = [&](double lo, double hi) { return static_cast<size_t>(std::exp(std::log(lo) + unit(rng) * (std::log(hi) - std::log(lo)))); };
+
+        if (distribution == "small") return std::uniform_int_distribution<size_t>(8, 256)(rng);
+        if (distribution == "medium") return logUniform(256.0, 64.0 * 1024);
+        if (distribution == "large") return logUniform(64.0 * 1024, 4.0 * 1024 * 1024);
+
+        const double pick = unit(rng);
+        if (pick < 0.80) return DrawSize("small", rng);
+        if (pick < 0.95) return DrawSize("medium", rng);
+        return DrawSize("large", rng);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MeasureTimerOverhead
+    double MeasureTimerOverhead()
+    {
+        constexpr int kSamples = 100000;
+        uint64_t total = 0;
+        for (int i = 0; i < kSamples; ++i)
+        {
+            const uint64_t start = AdaptiveArena::TscClock::NowNs();
+            total += AdaptiveArena::TscClock::NowNs() - start;
+        }
+        return static_cast<double>(total) / kSamples;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunOnce
+    // 한 번의 측정: 스레드별로 창을 채운 뒤(측정 밖) 동시에 출발하여 opsPerThread 쌍을 수행합니다.
+    double RunOnce(const BenchConfig& config, const std::vector<std::pmr::memory_resource*>& resources, size_t opsPerThread, size_t window,
+                   const std::vector<std::vector<uint32_t>>& sizeTables, const std::vector<std::vector<uint16_t>>& slotTables,
+                   AdaptiveArena::LatencyHistogram& allocateTotal, AdaptiveArena::LatencyHistogram& deallocateTotal, std::atomic<uint64_t>& failures)
+    {
+        std::atomic<size_t> ready{ 0 };
+        std::atomic<size_t> finished{ 0 };
+        std::atomic<bool> go{ false };
+        std::vector<std::unique_ptr<AdaptiveArena::LatencyHistogram>> allocateHist(config.threads);
+        std::vector<std::unique_ptr<AdaptiveArena::LatencyHistogram>> deallocateHist(config.threads);
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < config.threads; ++t)
+        {
+            allocateHist[t] = std::make_unique<AdaptiveArena::LatencyHistogram>();
+            deallocateHist[t] = std::make_unique<AdaptiveArena::LatencyHistogram>();
+            workers.emplace_back([&, t]()
+            {
+                std::pmr::memory_resource& resource = *resources[t];
+                const std::vector<uint32_t>& sizes = sizeTables[t];
+                const std::vector<uint16_t>& order = slotTables[t];
+                AdaptiveArena::LatencyHistogram& allocateLatency = *allocateHist[t];
+                AdaptiveArena::LatencyHistogram& deallocateLatency = *deallocateHist[t];
+
+                struct Block { void* ptr; size_t size; };
+                std::vector<Block> live(window, Block{ nullptr, 0 });
+                for (size_t i = 0; i < window; ++i)
+                {
+                    const size_t size = sizes[i & (kTableSize - 1)];
+                    try
+                    {
+                        live[i] = { resource.allocate(size, config.alignment), size };
+                    }
+                    catch (const std::bad_alloc&)
+                    {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                for (size_t op = 0; op < opsPerThread; ++op)
+                {
+                    Block& block = live[order[op & (kTableSize - 1)]];
+                    if (block.ptr)
+                    {
+                        const uint64_t start = AdaptiveArena::TscClock::NowNs();
+                        resource.deallocate(block.ptr, block.size, config.alignment);
+                        deallocateLatency.Record(AdaptiveArena::TscClock::NowNs() - start);
+                        block.ptr = nullptr;
+                    }
+
+                    const size_t size = sizes[(op + window) & (kTableSize - 1)];
+                    try
+                    {
+                        const uint64_t start = AdaptiveArena::TscClock::NowNs();
+                        void* p = resource.allocate(size, config.alignment);
+                        allocateLatency.Record(AdaptiveArena::TscClock::NowNs() - start);
+
+                        // 첫 바이트를 써서 실제로 쓰이는 블록처럼 (측정 밖)
+                        *static_cast<volatile char*>(p) = static_cast<char>(op);
+                        block = { p, size };
+                    }
+                    catch (const std::bad_alloc&)
+                    {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                finished.fetch_add(1, std::memory_order_release);
+
+                for (Block& block : live)
+                {
+                    if (block.ptr) resource.deallocate(block.ptr, block.size, config.alignment);
+                }
+            });
+        }
+
+        while (ready.load() < config.threads) std::this_thread::yield();
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+
+        // 마지막 스레드가 측정 구간을 끝낸 시점까지 (창 정리는 제외)
+        while (finished.load(std::memory_order_acquire) < config.threads) std::this_thread::yield();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        for (auto& worker : workers) worker.join();
+
+        for (size_t t = 0; t < config.threads; ++t)
+        {
+            allocateTotal.Merge(*allocateHist[t]);
+            deallocateTotal.Merge(*deallocateHist[t]);
+        }
+        return seconds;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunConfig
+    BenchResult RunConfig(const BenchConfig& config, size_t opsPerThread, int repeat)
+    {
+        BenchResult result;
+        result.config = config;
+
+        // 크기/칸 순서 표 (스레드별 시드, 모든 리소스가 같은 표를 사용)
+        std::vector<std::vector<uint32_t>> sizeTables(config.threads, std::vector<uint32_t>(kTableSize));
+        double meanSize = 0.0;
+        for (size_t t = 0; t < config.threads; ++t)
+        {
+            std::mt19937_64 rng(0x5EED0000 + t);
+            for (auto& size : sizeTables[t])
+            {
+                size = static_cast<uint32_t>(DrawSize(config.distribution, rng));
+                meanSize += size;
+            }
+        }
+        meanSize /= static_cast<double>(config.threads * kTableSize);
+        result.window = std::clamp(static_cast<size_t>(kLiveBytesPerThread / std::max(1.0, meanSize)), kMinWindow, kMaxWindow);
+
+        std::vector<std::vector<uint16_t>> slotTables(config.threads, std::vector<uint16_t>(kTableSize));
+        for (size_t t = 0; t < config.threads; ++t)
+        {
+            std::mt19937_64 rng(0x51070000 + t);
+            std::uniform_int_distribution<size_t> pick(0, result.window - 1);
+            for (auto& slot : slotTables[t]) slot = static_cast<uint16_t>(pick(rng));
+        }
+
+        AdaptiveArena::LatencyHistogram allocateTotal;
+        AdaptiveArena::LatencyHistogram deallocateTotal;
+        std::atomic<uint64_t> failures{ 0 };
+        std::vector<double> opsPerSec;
+
+        for (int rep = 0; rep < repeat; ++rep)
+        {
+            // 매 반복마다 새 리소스 (이전 구성의 캐시/학습 상태를 물려받지 않도록)
+            std::unique_ptr<AdaptiveArena::Resource> arena;
+            std::vector<std::unique_ptr<std::pmr::unsynchronized_pool_resource>> pools;
+            std::unique_ptr<std::pmr::synchronized_pool_resource> sharedPool;
+            MallocResource mallocResource;
+            std::vector<std::pmr::memory_resource*> resources(config.threads);
+
+            if (config.resource == "arena")
+            {
+                arena = AdaptiveArena::Builder()
+                            .SetKey("ArenaBench_Key")
+                            .SetPath(std::filesystem::temp_directory_path() / "arena_bench_profile.bin")
+                            .SetMode(AdaptiveArena::ArenaMode::Generic)
+                            .SetTelemetryRate(0.0)
+                            .SetCheckpointInterval(std::chrono::milliseconds(0))
+                            .Build();
+                std::fill(resources.begin(), resources.end(), arena.get());
+            }
+            else if (config.resource == "unsync_pool")
+            {
+                // 스레드 안전하지 않으므로 스레드마다 하나 (이 벤치마크에는 스레드 간 해제가 없음)
+                for (size_t t = 0; t < config.threads; ++t)
+                {
+                    pools.push_back(std::make_unique<std::pmr::unsynchronized_pool_resource>());
+                    resources[t] = pools.back().get();
+                }
+            }
+            else if (config.resource == "sync_pool")
+            {
+                sharedPool = std::make_unique<std::pmr::synchronized_pool_resource>();
+                std::fill(resources.begin(), resources.end(), sharedPool.get());
+            }
+            else if (config.resource == "new_delete")
+            {
+                std::fill(resources.begin(), resources.end(), std::pmr::new_delete_resource());
+            }
+            else
+            {
+                std::fill(resources.begin(), resources.end(), &mallocResource);
+            }
+
+            const double seconds = RunOnce(config, resources, opsPerThread, result.window, sizeTables, slotTables, allocateTotal, deallocateTotal, failures);
+            opsPerSec.push_back(seconds > 0.0 ? 2.0 * static_cast<double>(opsPerThread * config.threads) / seconds : 0.0);
+            result.pairs += opsPerThread * config.threads;
+        }
+
+        std::sort(opsPerSec.begin(), opsPerSec.end());
+        result.medianOpsPerSec = opsPerSec[opsPerSec.size() / 2];
+        result.bestOpsPerSec = opsPerSec.back();
+        result.allocate = allocateTotal.Summarize();
+        result.deallocate = deallocateTotal.Summarize();
+        result.failures = failures.load();
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Command Line
+    std::vector<std::string> SplitList(const std::string& text)
+    {
+        std::vector<std::string> items;
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty()) items.push_back(item);
+        }
+        return items;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriteJson
+    void WriteLatencyJson(std::ostream& out, const AdaptiveArena::LatencyPercentiles& latency)
+    {
+        out << "{\"samples\":" << latency.samples
+            << ",\"p50Ns\":" << latency.p50Us * 1000.0 << ",\"p99Ns\":" << latency.p99Us * 1000.0 << ",\"p999Ns\":" << latency.p999Us * 1000.0
+            << ",\"maxNs\":" << latency.maxUs * 1000.0 << ",\"meanNs\":" << latency.meanUs * 1000.0 << "}";
+    }
+
+    void WriteJson(std::ostream& out, const std::vector<BenchResult>& results, size_t opsPerThread, int repeat, double timerOverheadNs)
+    {
+        out << std::fixed << std::setprecision(1);
+        out << "{\"benchmark\":\"arena_bench\",\"version\":1"
+            << ",\"hardwareThreads\":" << std::thread::hardware_concurrency()
+            << ",\"opsPerThread\":" << opsPerThread << ",\"repeat\":" << repeat
+            << ",\"timerOverheadNs\":" << timerOverheadNs
+            << ",\"results\":[";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchResult& r = results[i];
+            out << (i ? "," : "") << "\n  {\"resource\":\"" << r.config.resource << "\",\"distribution\":\"" << r.config.distribution
+                << "\",\"alignment\":" << r.config.alignment << ",\"threads\":" << r.config.threads << ",\"window\":" << r.window
+                << ",\"pairs\":" << r.pairs << ",\"opsPerSec\":" << r.medianOpsPerSec << ",\"bestOpsPerSec\":" << r.bestOpsPerSec
+                << ",\"failures\":" << r.failures << ",\"allocate\":";
+            WriteLatencyJson(out, r.allocate);
+            out << ",\"deallocate\":";
+            WriteLatencyJson(out, r.deallocate);
+            out << "}";
+        }
+        out << "\n]}\n";
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief  do_allocate/do_deallocate 마이크로벤치마크입니다. 크기 분포 x 정렬 x 스레드 수 x 리소스의 모든 조합을 측정하여
+ *         호출 처리량(중앙값/최고)과 할당/해제 지연 백분위(시계 오버헤드 포함, JSON에 별도 기록)를 표와 JSON으로 출력합니다.
+ *         사용법: arena_bench [--sizes small,medium,large,mixed] [--align 16,64,4096] [--threads 1,2,4,8,16,32,64]
+ *                            [--resources arena,unsync_pool,sync_pool,new_delete,malloc] [--ops N] [--repeat N] [--json path]
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> distributions = { "small", "medium", "large", "mixed" };
+    std::vector<std::string> resources(std::begin(kResources), std::end(kResources));
+    std::vector<size_t> alignments = { 16, 64, 4096 };
+    std::vector<size_t> threadCounts = { 1, 2, 4, 8, 16, 32, 64 };
+    size_t opsPerThread = 200000;
+    int repeat = 3;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--sizes") == 0 && hasValue) distributions = SplitList(argv[++i]);
+        else if (std::strcmp(argv[i], "--resources") == 0 && hasValue) resources = SplitList(argv[++i]);
+        else if (std::strcmp(argv[i], "--align") == 0 && hasValue)
+        {
+            alignments.clear();
+            for (const auto& item : SplitList(argv[++i])) alignments.push_back(std::strtoull(item.c_str(), nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+        {
+            threadCounts.clear();
+            for (const auto& item : SplitList(argv[++i])) threadCounts.push_back(std::clamp<size_t>(std::strtoull(item.c_str(), nullptr, 10), 1, 64));
+        }
+        else if (std::strcmp(argv[i], "--ops") == 0 && hasValue) opsPerThread = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--repeat") == 0 && hasValue) repeat = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--json") == 0 && hasValue) jsonPath = argv[++i];
+        else
+        {
+            std::cerr << "Unknown argument: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    for (const auto& distribution : distributions)
+    {
+        if (std::none_of(std::begin(kDistributions), std::end(kDistributions), [&](const SizeDistribution& d) { return distribution == d.name; }))
+        {
+            std::cerr << "Unknown size distribution: " << distribution << std::endl;
+            return 1;
+        }
+    }
+    for (const auto& resource : resources)
+    {
+        if (std::none_of(std::begin(kResources), std::end(kResources), [&](const char* name) { return resource == name; }))
+        {
+            std::cerr << "Unknown resource: " << resource << std::endl;
+            return 1;
+        }
+    }
+    for (size_t alignment : alignments)
+    {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        {
+            std::cerr << "Alignment must be a power of two: " << alignment << std::endl;
+            return 1;
+        }
+    }
+
+    for (const auto& distribution : distributions)
+    {
+        const auto* d = std::find_if(std::begin(kDistributions), std::end(kDistributions), [&](const SizeDistribution& item) { return distribution == item.name; });
+        std::cout << "Sizes '" << d->name << "': " << d->description << "\n";
+    }
+
+    const double timerOverheadNs = MeasureTimerOverhead();
+    std::cout << "Timer overhead: " << std::fixed << std::setprecision(1) << timerOverheadNs << " ns (included in latencies)\n";
+    std::cout << std::left << std::setw(8) << "sizes" << std::right << std::setw(7) << "align" << std::setw(6) << "thr" << "  "
+              << std::left << std::setw(13) << "resource" << std::right << std::setw(11) << "Mops/s"
+              << std::setw(10) << "alloc p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(10) << "free p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9" << "  (ns)\n";
+
+    std::vector<BenchResult> results;
+    try
+    {
+        for (const auto& distribution : distributions)
+        {
+            for (size_t alignment : alignments)
+            {
+                for (size_t threads : threadCounts)
+                {
+                    for (const auto& resource : resources)
+                    {
+                        const BenchResult r = RunConfig({ distribution, alignment, threads, resource }, opsPerThread, repeat);
+                        std::cout << std::left << std::setw(8) << distribution << std::right << std::setw(7) << alignment << std::setw(6) << threads << "  "
+                                  << std::left << std::setw(13) << resource << std::right << std::setprecision(2) << std::setw(11) << r.medianOpsPerSec / 1e6
+                                  << std::setprecision(0)
+                                  << std::setw(10) << r.allocate.p50Us * 1000.0 << std::setw(10) << r.allocate.p99Us * 1000.0 << std::setw(10) << r.allocate.p999Us * 1000.0
+                                  << std::setw(10) << r.deallocate.p50Us * 1000.0 << std::setw(10) << r.deallocate.p99Us * 1000.0 << std::setw(10) << r.deallocate.p999Us * 1000.0
+                                  << (r.failures ? "  (allocation failures)" : "") << "\n";
+                        results.push_back(r);
+                    }
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (!jsonPath.empty())
+    {
+        std::ofstream file(jsonPath, std::ios::trunc);
+        if (!file)
+        {
+            std::cerr << "Failed to write " << jsonPath << std::endl;
+            return 1;
+        }
+        WriteJson(file, results, opsPerThread, repeat, timerOverheadNs);
+        std::cout << "JSON written to " << jsonPath << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,229 @@
+#define NOMINMAX
+#include "../src/UltrasoundArena.h"
+#include "../src/WorkStealingExecutor.h"
+#include "test_support.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr size_t kFrameCount = 2000;
+    constexpr size_t kRingSlots = 32;
+    constexpr size_t kPayloadSize = 4096;
+    constexpr size_t kWorkers = 4;
+    constexpr size_t kHardLimit = 256ull * 1024 * 1024;
+
+    // 페이로드 앞부분: Producer가 쓴 시퀀스와 작업자가 처리 완료로 남기는 표식
+    struct FrameWords
+    {
+        uint64_t sequence;
+        uint64_t processed;
+    };
+
+    constexpr uint64_t ProcessedMark(uint64_t sequence) { return sequence * 7 + 1; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunInOrderCommit
+    // 처리 시간이 들쭉날쭉한 작업자 N개가 프레임을 순서와 무관하게 끝내도, 하류 커서는 시퀀스 순서대로
+    // 이미 처리된 프레임만 받아야 합니다. 실행 중 작업자 수를 바꾸고, 마지막에는 Stop이 남은 프레임을 모두 Commit 해야 합니다.
+    void RunInOrderCommit(const std::filesystem::path& dir)
+    {
+        std::cout << "In-order commit (" << kWorkers << " workers, " << kFrameCount << " frames)\n";
+
+        UltrasoundArena arena("executor_key", dir / "executor_profile.bin", kHardLimit, false);
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kRingSlots);
+
+        std::unique_ptr<std::atomic<bool>[]> processed(new std::atomic<bool>[kFrameCount]);
+        for (size_t i = 0; i < kFrameCount; ++i)
+        {
+            processed[i].store(false);
+        }
+
+        std::atomic<size_t> running{0};
+        std::atomic<size_t> maxRunning{0};
+        std::atomic<uint64_t> lastCompleted{0};
+        std::atomic<size_t> outOfOrder{0};
+
+        WorkStealingExecutor executor(arena, "Workers", [&](size_t, void*, void* payload)
+        {
+            auto* words = static_cast<FrameWords*>(payload);
+            const uint64_t sequence = words->sequence;
+
+            size_t now = running.fetch_add(1) + 1;
+            size_t seen = maxRunning.load();
+            while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) {}
+
+            // 8프레임마다 한 번 느린 프레임: 뒤 시퀀스가 먼저 끝나도록 유도
+            if (sequence % 8 == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+
+            words->processed = ProcessedMark(sequence);
+            processed[sequence].store(true, std::memory_order_release);
+
+            if (lastCompleted.exchange(sequence) > sequence) outOfOrder.fetch_add(1);
+            running.fetch_sub(1);
+        }, kWorkers);
+
+        // 실행기의 Release 위치를 따라가는 하류 단계
+        const size_t downstream = arena.AddCursor("Commit", executor.GetCursor());
+        executor.Start();
+
+        std::thread producer([&]()
+        {
+            for (uint64_t i = 0; i < kFrameCount; ++i)
+            {
+                size_t slot = 0;
+                while (!arena.TryClaimWrite(slot))
+                {
+                    std::this_thread::yield();
+                }
+
+                FrameWords words{ i, 0 };
+                std::memcpy(arena.GetPayload(slot), &words, sizeof(words));
+                arena.CommitWrite();
+
+                // 중간에 작업자 수 조절: 비활성 작업자의 남은 작업도 순서대로 Commit 되어야 함
+                if (i == kFrameCount / 3) executor.SetWorkerCount(1);
+                if (i == kFrameCount * 2 / 3) executor.SetWorkerCount(kWorkers);
+            }
+        });
+
+        size_t sequenceErrors = 0;
+        size_t unprocessed = 0;
+        uint64_t received = 0;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+
+        std::thread consumer([&]()
+        {
+            while (received < kFrameCount && std::chrono::steady_clock::now() < deadline)
+            {
+                size_t slot = 0;
+                if (!arena.AcquireRead(downstream, slot))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                const auto* words = static_cast<const FrameWords*>(arena.GetPayload(slot));
+                if (words->sequence != received) ++sequenceErrors;
+                if (!processed[received].load(std::memory_order_acquire) || words->processed != ProcessedMark(received)) ++unprocessed;
+
+                arena.Release(downstream);
+                ++received;
+            }
+        });
+
+        producer.join();
+        executor.Stop();
+        consumer.join();
+
+        Check(received == kFrameCount, "downstream receives every frame after Stop drains the executor");
+        Check(sequenceErrors == 0, "downstream sees frames in sequence order");
+        Check(unprocessed == 0, "no frame is released downstream before its task completed");
+        Check(maxRunning.load() > 1, "tasks ran concurrently (max " + std::to_string(maxRunning.load()) + ")");
+        Check(outOfOrder.load() > 0, "tasks completed out of order (" + std::to_string(outOfOrder.load()) + " inversions)");
+        std::cout << "  (steals: " << executor.GetStealCount() << ")\n";
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunStopDrain
+    // Start 전에 발행되어 쌓인 프레임은 Start 직후 Stop 해도 모두 처리되고 Commit 되어야 합니다.
+    void RunStopDrain(const std::filesystem::path& dir)
+    {
+        std::cout << "Stop drains published frames\n";
+
+        UltrasoundArena arena("executor_key", dir / "executor_drain_profile.bin", kHardLimit, false);
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kRingSlots);
+
+        std::atomic<size_t> tasks{0};
+        WorkStealingExecutor executor(arena, "Workers", [&](size_t, void*, void*)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            tasks.fetch_add(1);
+        }, kWorkers);
+
+        const size_t published = kRingSlots;
+        for (size_t i = 0; i < published; ++i)
+        {
+            size_t slot = 0;
+            if (!arena.TryClaimWrite(slot)) break;
+            arena.CommitWrite();
+        }
+
+        executor.Start();
+        executor.Stop();
+
+        Check(tasks.load() == published, "every published frame ran before Stop returned");
+        Check(arena.GetCursorAcquired(executor.GetCursor()) == published, "executor cursor consumed every published frame");
+
+        size_t slot = 0;
+        Check(arena.TryClaimWrite(slot), "released slots are writable again");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunDestroyDetaches
+    // 실행기가 소비하지 못한 프레임이 링을 채운 채 소멸해도, 그 커서가 Producer를 계속 막으면 안 됩니다.
+    void RunDestroyDetaches(const std::filesystem::path& dir)
+    {
+        std::cout << "Destroyed executor releases its gate\n";
+
+        UltrasoundArena arena("executor_key", dir / "executor_detach_profile.bin", kHardLimit, false);
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kRingSlots);
+
+        {
+            WorkStealingExecutor executor(arena, "Workers", [](size_t, void*, void*) {}, kWorkers);
+
+            size_t published = 0;
+            size_t slot = 0;
+            while (published < kRingSlots * 2 && arena.TryClaimWrite(slot))
+            {
+                arena.CommitWrite();
+                ++published;
+            }
+            Check(!arena.TryClaimWrite(slot), "an idle executor cursor gates the producer while it exists");
+        }
+
+        size_t claimed = 0;
+        for (size_t i = 0; i < kRingSlots * 2; ++i)
+        {
+            size_t slot = 0;
+            if (!arena.TryClaimWrite(slot)) break;
+            arena.CommitWrite();
+            ++claimed;
+        }
+        Check(claimed == kRingSlots * 2, "producer is no longer gated after the executor is destroyed");
+    }
+}
+
+int main()
+{
+    PrintTitle("Work-Stealing Executor Test");
+
+    const TempDirectory temp("adaptive_arena_executor_test");
+    const std::filesystem::path& dir = temp.Path();
+
+    try
+    {
+        RunInOrderCommit(dir);
+        RunStopDrain(dir);
+        RunDestroyDetaches(dir);
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
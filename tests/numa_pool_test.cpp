@@ -0,0 +1,294 @@
+#define NOMINMAX
+#include "../src/NumaPool.h"
+#include "test_support.h"
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr size_t kKB = 1024;
+    constexpr size_t kMB = 1024 * 1024;
+    constexpr size_t kSuperPageShift = 22;   // NumaPool의 Super-Page 크기 (4MB)
+
+    struct Block
+    {
+        void* ptr;
+        size_t bytes;
+        size_t alignment;
+        uint8_t tag;
+    };
+
+    bool IsAligned(const void* p, size_t alignment) { return (reinterpret_cast<uintptr_t>(p) & (alignment - 1)) == 0; }
+
+    bool HoldsTag(const Block& block)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(block.ptr);
+        for (size_t i = 0; i < block.bytes; ++i)
+        {
+            if (bytes[i] != block.tag) return false;
+        }
+        return true;
+    }
+
+    // 블록마다 다른 값으로 채운 뒤, 모두 채운 다음에도 각자의 값이 남아 있으면 서로 겹치지 않은 것
+    bool NoOverlap(const std::vector<Block>& blocks)
+    {
+        for (const Block& block : blocks)
+        {
+            std::memset(block.ptr, block.tag, block.bytes);
+        }
+        for (const Block& block : blocks)
+        {
+            if (!HoldsTag(block)) return false;
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunSizeClasses
+    // 크기 등급 경계 전후와 대형 요청까지, 모든 블록은 요청한 정렬을 지키고 서로 겹치지 않아야 합니다.
+    void RunSizeClasses()
+    {
+        std::cout << "Size classes, alignment and overlap\n";
+
+        NumaPool pool;
+        const size_t sizes[] = { 1, 24, 64, 65, 100, 1000, 4096, 5000, 64 * kKB, 1 * kMB, 1 * kMB + 1, 3 * kMB };
+        const size_t alignments[] = { 8, 64, 4096 };
+
+        std::vector<Block> blocks;
+        bool allocated = true;
+        bool aligned = true;
+        for (size_t bytes : sizes)
+        {
+            for (size_t alignment : alignments)
+            {
+                for (int copy = 0; copy < 3; ++copy)
+                {
+                    void* p = pool.Allocate(bytes, alignment, -1);
+                    if (!p)
+                    {
+                        allocated = false;
+                        continue;
+                    }
+                    aligned = aligned && IsAligned(p, alignment);
+                    blocks.push_back({ p, bytes, alignment, static_cast<uint8_t>(blocks.size() * 37 + 1) });
+                }
+            }
+        }
+
+        Check(allocated, "every request is served");
+        Check(aligned, "every block honours its alignment");
+        Check(NoOverlap(blocks), std::to_string(blocks.size()) + " live blocks do not overlap");
+
+        for (const Block& block : blocks)
+        {
+            pool.Deallocate(block.ptr, block.bytes, block.alignment);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunFreeListReuse
+    // 해제한 블록은 같은 크기 등급의 다음 요청에 다시 나가야 합니다 (크기가 달라도 등급이 같으면 재사용).
+    void RunFreeListReuse()
+    {
+        std::cout << "Free list reuse\n";
+
+        NumaPool pool;
+        void* first = pool.Allocate(256, 16, -1);
+        pool.Deallocate(first, 256, 16);
+
+        void* again = pool.Allocate(256, 16, -1);
+        Check(again == first, "a freed block is handed out again");
+        pool.Deallocate(again, 256, 16);
+
+        void* sameClass = pool.Allocate(200, 8, -1);
+        Check(sameClass == first, "a smaller request in the same class reuses it");
+
+        void* otherClass = pool.Allocate(512, 8, -1);
+        Check(otherClass != first, "a live block is never handed out twice");
+
+        pool.Deallocate(sameClass, 200, 8);
+        pool.Deallocate(otherClass, 512, 8);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunOverAligned
+    // 4KB를 넘는 정렬은 Super-Page 대신 대형 영역으로 처리되며, OS 할당 단위보다 큰 정렬도 지켜야 합니다.
+    void RunOverAligned()
+    {
+        std::cout << "Alignment above 4KB\n";
+
+        NumaPool pool;
+        const size_t alignments[] = { 8 * kKB, 64 * kKB, 2 * kMB };
+
+        std::vector<Block> blocks;
+        for (size_t alignment : alignments)
+        {
+            bool aligned = true;
+            for (int copy = 0; copy < 4; ++copy)
+            {
+                void* p = pool.Allocate(1000, alignment, -1);
+                aligned = aligned && p && IsAligned(p, alignment);
+                if (p) blocks.push_back({ p, 1000, alignment, static_cast<uint8_t>(blocks.size() + 1) });
+            }
+            Check(aligned, std::to_string(alignment) + "-byte alignment is honoured");
+        }
+        Check(NoOverlap(blocks), "over-aligned blocks do not overlap");
+
+        for (const Block& block : blocks)
+        {
+            pool.Deallocate(block.ptr, block.bytes, block.alignment);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunCrossThreadFree
+    // 다른 스레드가 해제한 블록은 소유 노드의 Free List로 돌아가, 새 페이지를 자르지 않고 다시 나가야 합니다.
+    void RunCrossThreadFree()
+    {
+        std::cout << "Cross-thread free\n";
+
+        constexpr size_t kBlocks = 1000;
+        NumaPool pool;
+
+        std::vector<void*> blocks(kBlocks);
+        std::thread owner([&]()
+        {
+            for (size_t i = 0; i < kBlocks; ++i)
+            {
+                blocks[i] = pool.Allocate(128, 16, -1);
+            }
+        });
+        owner.join();
+
+        std::thread releaser([&]()
+        {
+            for (void* p : blocks)
+            {
+                pool.Deallocate(p, 128, 16);
+            }
+        });
+        releaser.join();
+
+        const std::set<void*> freed(blocks.begin(), blocks.end());
+        size_t reused = 0;
+        for (size_t i = 0; i < kBlocks; ++i)
+        {
+            blocks[i] = pool.Allocate(128, 16, -1);
+            if (freed.count(blocks[i])) ++reused;
+        }
+        Check(freed.size() == kBlocks, "blocks from the owning thread are distinct");
+        Check(reused == kBlocks, "every block freed by another thread is reused (" + std::to_string(reused) + ")");
+
+        for (void* p : blocks)
+        {
+            pool.Deallocate(p, 128, 16);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunNodeCounters
+    // 범위 밖 노드는 노드 0으로 처리되고, 모든 할당은 로컬 또는 원격 중 하나로 집계되어야 합니다.
+    void RunNodeCounters()
+    {
+        NumaPool pool;
+        std::cout << "Node counters (" << pool.GetNodeCount() << " nodes)\n";
+
+        const int outOfRange = static_cast<int>(pool.GetNodeCount()) + 3;
+
+        std::vector<void*> blocks;
+        for (int node : { -1, 0, outOfRange })
+        {
+            void* p = pool.Allocate(4096, 64, node);
+            Check(p != nullptr, "allocation on node " + std::to_string(node) + " is served");
+            blocks.push_back(p);
+        }
+
+        Check(pool.GetLocalAllocations() + pool.GetRemoteAllocations() == blocks.size(), "every allocation is counted once");
+        if (pool.GetNodeCount() == 1)
+        {
+            Check(pool.GetRemoteAllocations() == 0 && pool.GetRemoteBytes() == 0, "a single-node system has no remote allocations");
+        }
+
+        for (void* p : blocks)
+        {
+            pool.Deallocate(p, 4096, 64);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunPageRecycling
+    // 블록이 모두 돌아온 Super-Page는 다른 크기 등급으로 다시 잘려 쓰이며, 그 뒤에도 옛 등급의 Free List가
+    // 그 페이지의 블록을 내주면 안 됩니다.
+    void RunPageRecycling()
+    {
+        std::cout << "Empty super-pages are recycled across classes\n";
+
+        constexpr size_t kSmall = 64 * kKB;
+        constexpr size_t kPages = 5;
+        const size_t perPage = (size_t(1) << kSuperPageShift) / kSmall;
+
+        NumaPool pool;
+        std::vector<void*> small;
+        std::set<uintptr_t> pages;
+        for (size_t i = 0; i < perPage * kPages; ++i)
+        {
+            void* p = pool.Allocate(kSmall, 64, -1);
+            small.push_back(p);
+            pages.insert(reinterpret_cast<uintptr_t>(p) >> kSuperPageShift);
+        }
+        Check(pages.size() == kPages, "64KB blocks fill " + std::to_string(pages.size()) + " super-pages");
+
+        for (void* p : small)
+        {
+            pool.Deallocate(p, kSmall, 64);
+        }
+
+        // 다른 등급이 빈 페이지를 다시 잘라 씀
+        std::vector<Block> blocks;
+        void* large = pool.Allocate(1 * kMB, 64, -1);
+        Check(large && pages.count(reinterpret_cast<uintptr_t>(large) >> kSuperPageShift), "a 1MB block is carved from an emptied super-page");
+        blocks.push_back({ large, 1 * kMB, 64, 0xA5 });
+
+        // 옛 등급을 다시 할당해도 새 등급 블록과 겹치지 않아야 함
+        for (size_t i = 0; i < perPage * 2; ++i)
+        {
+            void* p = pool.Allocate(kSmall, 64, -1);
+            blocks.push_back({ p, kSmall, 64, static_cast<uint8_t>(i + 1) });
+        }
+        Check(NoOverlap(blocks), "stale free-list entries never alias the recycled page");
+
+        for (const Block& block : blocks)
+        {
+            pool.Deallocate(block.ptr, block.bytes, block.alignment);
+        }
+    }
+}
+
+int main()
+{
+    PrintTitle("NUMA Pool Test");
+
+    try
+    {
+        RunSizeClasses();
+        RunFreeListReuse();
+        RunOverAligned();
+        RunCrossThreadFree();
+        RunNodeCounters();
+        RunPageRecycling();
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
@@ -0,0 +1,294 @@
+#define NOMINMAX
+#include "../src/PersistenceManager.h"
+#include "../src/PayloadIntegrity.h"
+#include "test_support.h"
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    std::vector<uint8_t> ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void WriteFile(const std::filesystem::path& path, const void* data, size_t length)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(length));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MakeProfile
+    // 필드마다 시드에서 파생된 서로 다른 값을 채운 프로필 (왕복 후 바이트 단위 비교용)
+    SessionProfile MakeProfile(uint32_t seed)
+    {
+        SessionProfile profile;
+        profile.predictedBytes = 0x100000ull * seed + 7;
+        profile.sessionCount = seed + 1;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            RingProfile ring{};
+            ring.headerSize = 32;
+            ring.payloadSize = (1024ull << i) * seed;
+            ring.slotCount = 8 + i + seed;
+            ring.scratchBytes = 4096 * (i + 1);
+            ring.lastSession = seed;
+            profile.StoreRing(ring);
+        }
+        profile.jitter = JitterQuantiles{ seed, seed * 2, seed * 3, seed * 4, 1000ull + seed };
+        for (size_t i = 0; i < kSizeClassCount; ++i)
+        {
+            profile.sizeClassCounts[i] = seed * 1000 + i;
+        }
+        return profile;
+    }
+
+    bool SameProfile(const SessionProfile* a, const SessionProfile& b)
+    {
+        return a && std::memcmp(a, &b, sizeof(SessionProfile)) == 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestRoundTrip
+    void TestRoundTrip(const std::filesystem::path& dir)
+    {
+        std::cout << "Round trip\n";
+        const std::filesystem::path path = dir / "roundtrip.bin";
+
+        ProfileLibrary library;
+        library.Store("volume3d", MakeProfile(3));
+        library.Store("bmode", MakeProfile(1));
+        library.Store("color", MakeProfile(2));
+        library.Touch("color");
+        library.Touch("bmode");
+
+        Check(PersistenceManager::Save(path, library), "Save succeeds");
+
+        std::filesystem::path temp = path;
+        temp += ".tmp";
+        Check(!std::filesystem::exists(temp), "no temporary file is left after the atomic replace");
+
+        ProfileLibrary loaded;
+        Check(PersistenceManager::Load(path, loaded), "Load succeeds");
+        Check(loaded.GetCount() == 3, "all three workload keys are restored");
+        Check(SameProfile(loaded.Find("bmode"), MakeProfile(1)), "bmode profile is bit-exact");
+        Check(SameProfile(loaded.Find("color"), MakeProfile(2)), "color profile is bit-exact");
+        Check(SameProfile(loaded.Find("volume3d"), MakeProfile(3)), "volume3d profile is bit-exact");
+        Check(loaded.Find("doppler") == nullptr, "unknown key is not found");
+
+        // 저장 전 LRU 상태가 유지되어야 함: 한 번도 활성화되지 않은 volume3d가 먼저 교체됨
+        for (size_t i = loaded.GetCount(); i < kMaxWorkloadProfiles; ++i)
+        {
+            loaded.Store("filler" + std::to_string(i), MakeProfile(static_cast<uint32_t>(10 + i)));
+        }
+        loaded.Store("doppler", MakeProfile(9));
+        Check(loaded.GetCount() == kMaxWorkloadProfiles, "library stays at kMaxWorkloadProfiles when full");
+        Check(loaded.Find("volume3d") == nullptr && loaded.Find("doppler") != nullptr, "least recently used key is evicted");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestFileFormat
+    void TestFileFormat(const std::filesystem::path& dir)
+    {
+        std::cout << "File format\n";
+        const std::filesystem::path path = dir / "format.bin";
+
+        ProfileLibrary library;
+        library.Store("color", MakeProfile(2));
+        library.Store("bmode", MakeProfile(1));
+        library.Touch("bmode");
+        PersistenceManager::Save(path, library);
+
+        const std::vector<uint8_t> bytes = ReadFile(path);
+        const size_t expected = sizeof(ProfileFileHeader) + 2 * sizeof(ProfileIndexEntry) + 2 * sizeof(SessionProfile);
+        Check(bytes.size() == expected, "file is [header][index x 2][profile x 2]");
+        if (bytes.size() != expected) return;
+
+        ProfileFileHeader header{};
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        Check(header.magic == kProfileMagic, "header magic is AAPF");
+        Check(header.version == kProfileVersion, "header version is current");
+        Check(header.profileBytes == sizeof(SessionProfile), "header records sizeof(SessionProfile)");
+        Check(header.entryCount == 2, "header entry count");
+        Check(header.useClock == 1, "header carries the LRU clock");
+
+        const uint8_t* body = bytes.data() + sizeof(header);
+        const uint32_t crc = ~Crc32c::Extend(0xFFFFFFFFu, body, bytes.size() - sizeof(header));
+        Check(header.checksum == crc, "checksum is CRC32C over index and profiles");
+
+        ProfileIndexEntry index[2];
+        std::memcpy(index, body, sizeof(index));
+        Check(std::string(index[0].key) == "bmode" && std::string(index[1].key) == "color", "index is sorted by key");
+        Check(index[0].lastUsed == 1 && index[1].lastUsed == 0, "index records lastUsed per key");
+
+        SessionProfile second;
+        std::memcpy(&second, body + sizeof(index) + sizeof(SessionProfile), sizeof(second));
+        Check(SameProfile(&second, MakeProfile(2)), "i-th profile follows the i-th index entry");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestCorruption
+    // 손상된 파일은 거부되고 호출자의 라이브러리는 그대로 남아야 합니다.
+    void TestCorruption(const std::filesystem::path& dir)
+    {
+        std::cout << "Corruption handling\n";
+        const std::filesystem::path good = dir / "good.bin";
+        const std::filesystem::path bad = dir / "bad.bin";
+
+        ProfileLibrary library;
+        library.Store("bmode", MakeProfile(1));
+        library.Store("color", MakeProfile(2));
+        PersistenceManager::Save(good, library);
+        const std::vector<uint8_t> original = ReadFile(good);
+
+        const size_t indexOffset = sizeof(ProfileFileHeader);
+        const size_t profileOffset = indexOffset + 2 * sizeof(ProfileIndexEntry);
+
+        struct Mutation
+        {
+            const char* name;
+            std::function<void(std::vector<uint8_t>&)> apply;
+        };
+
+        auto patch32 = [](std::vector<uint8_t>& bytes, size_t offset, uint32_t value)
+        {
+            std::memcpy(bytes.data() + offset, &value, sizeof(value));
+        };
+
+        const Mutation mutations[] = {
+            { "truncated by one byte",        [](std::vector<uint8_t>& b) { b.pop_back(); } },
+            { "truncated to the header",      [](std::vector<uint8_t>& b) { b.resize(sizeof(ProfileFileHeader)); } },
+            { "truncated inside the header",  [](std::vector<uint8_t>& b) { b.resize(12); } },
+            { "bit flip in the index",        [=](std::vector<uint8_t>& b) { b[indexOffset + 1] ^= 0x01; } },
+            { "bit flip in a profile",        [=](std::vector<uint8_t>& b) { b[profileOffset + sizeof(SessionProfile) + 100] ^= 0x10; } },
+            { "bit flip in the checksum",     [](std::vector<uint8_t>& b) { b[offsetof(ProfileFileHeader, checksum)] ^= 0x80; } },
+            { "unknown magic",                [=](std::vector<uint8_t>& b) { patch32(b, offsetof(ProfileFileHeader, magic), 0x12345678); } },
+            { "future version",               [=](std::vector<uint8_t>& b) { patch32(b, offsetof(ProfileFileHeader, version), kProfileVersion + 1); } },
+            { "version zero",                 [=](std::vector<uint8_t>& b) { patch32(b, offsetof(ProfileFileHeader, version), 0); } },
+            { "profile layout mismatch",      [=](std::vector<uint8_t>& b) { patch32(b, offsetof(ProfileFileHeader, profileBytes), sizeof(SessionProfile) - 8); } },
+            { "entry count beyond the limit", [=](std::vector<uint8_t>& b) { patch32(b, offsetof(ProfileFileHeader, entryCount), kMaxWorkloadProfiles + 1); } },
+            { "entry count beyond the file",  [=](std::vector<uint8_t>& b) { patch32(b, offsetof(ProfileFileHeader, entryCount), 3); } },
+            { "empty file",                   [](std::vector<uint8_t>& b) { b.clear(); } },
+        };
+
+        for (const Mutation& mutation : mutations)
+        {
+            std::vector<uint8_t> bytes = original;
+            mutation.apply(bytes);
+            WriteFile(bad, bytes.data(), bytes.size());
+
+            ProfileLibrary target;
+            target.Store("sentinel", MakeProfile(7));
+            const bool loaded = PersistenceManager::Load(bad, target);
+            Check(!loaded && target.GetCount() == 1 && SameProfile(target.Find("sentinel"), MakeProfile(7)),
+                  std::string("rejected and left untouched: ") + mutation.name);
+        }
+
+        ProfileLibrary target;
+        Check(!PersistenceManager::Load(dir / "missing.bin", target), "missing file is rejected");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestLegacyMigration
+    void TestLegacyMigration(const std::filesystem::path& dir)
+    {
+        std::cout << "Legacy migration\n";
+
+        // 1. 최초 형식: 예측 크기(size_t) 하나
+        const std::filesystem::path raw = dir / "legacy_raw.bin";
+        const uint64_t predicted = 384ull * 1024 * 1024;
+        WriteFile(raw, &predicted, sizeof(predicted));
+
+        ProfileLibrary fromRaw;
+        Check(PersistenceManager::Load(raw, fromRaw), "predicted-size-only file is accepted");
+        const SessionProfile* rawProfile = fromRaw.Find(kDefaultWorkloadKey);
+        Check(fromRaw.GetCount() == 1 && rawProfile && rawProfile->predictedBytes == predicted,
+              "predicted size migrates to the default key");
+        Check(rawProfile && rawProfile->ringCount == 0 && rawProfile->sessionCount == 0, "other fields start empty");
+
+        // 2. 버전 1: [magic, version, profileBytes, checksum] + 단일 SessionProfile
+        const SessionProfile profile = MakeProfile(5);
+        const uint32_t header[4] = { kProfileMagic, 1, static_cast<uint32_t>(sizeof(SessionProfile)),
+                                     ~Crc32c::Extend(0xFFFFFFFFu, &profile, sizeof(profile)) };
+        std::vector<uint8_t> v1(sizeof(header) + sizeof(profile));
+        std::memcpy(v1.data(), header, sizeof(header));
+        std::memcpy(v1.data() + sizeof(header), &profile, sizeof(profile));
+
+        const std::filesystem::path legacy = dir / "legacy_v1.bin";
+        WriteFile(legacy, v1.data(), v1.size());
+
+        ProfileLibrary fromV1;
+        Check(PersistenceManager::Load(legacy, fromV1), "version 1 file is accepted");
+        Check(fromV1.GetCount() == 1 && SameProfile(fromV1.Find(kDefaultWorkloadKey), profile),
+              "version 1 profile migrates bit-exact to the default key");
+
+        // 3. 변환된 라이브러리는 현재 형식으로 다시 저장됨
+        Check(PersistenceManager::Save(legacy, fromV1), "migrated library saves");
+        const std::vector<uint8_t> rewritten = ReadFile(legacy);
+        ProfileFileHeader rewrittenHeader{};
+        if (rewritten.size() >= sizeof(rewrittenHeader)) std::memcpy(&rewrittenHeader, rewritten.data(), sizeof(rewrittenHeader));
+        Check(rewrittenHeader.version == kProfileVersion && rewrittenHeader.entryCount == 1, "re-saved file uses the current version");
+
+        ProfileLibrary reloaded;
+        Check(PersistenceManager::Load(legacy, reloaded) && SameProfile(reloaded.Find(kDefaultWorkloadKey), profile),
+              "re-saved file round-trips");
+
+        // 4. 손상된 버전 1 파일은 거부
+        std::vector<uint8_t> flipped = v1;
+        flipped[sizeof(header) + 40] ^= 0x04;
+        WriteFile(legacy, flipped.data(), flipped.size());
+        ProfileLibrary rejected;
+        Check(!PersistenceManager::Load(legacy, rejected) && rejected.GetCount() == 0, "version 1 checksum mismatch is rejected");
+
+        std::vector<uint8_t> truncated(v1.begin(), v1.end() - 1);
+        WriteFile(legacy, truncated.data(), truncated.size());
+        Check(!PersistenceManager::Load(legacy, rejected) && rejected.GetCount() == 0, "truncated version 1 file is rejected");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestKeys
+    void TestKeys()
+    {
+        std::cout << "Workload keys\n";
+
+        ProfileLibrary library;
+        library.Store("", MakeProfile(1));
+        library.Store(std::string(kMaxWorkloadKeyLength + 1, 'k'), MakeProfile(2));
+        library.Store(std::string("nul\0key", 7), MakeProfile(3));
+        Check(library.GetCount() == 0, "empty, over-long and NUL-containing keys are ignored");
+
+        const std::string longest(kMaxWorkloadKeyLength, 'k');
+        library.Store(longest, MakeProfile(4));
+        Check(SameProfile(library.Find(longest), MakeProfile(4)), "key of kMaxWorkloadKeyLength is stored");
+
+        library.Store(longest, MakeProfile(5));
+        Check(library.GetCount() == 1 && SameProfile(library.Find(longest), MakeProfile(5)), "storing an existing key replaces it");
+    }
+}
+
+int main()
+{
+    PrintTitle("Profile Library Persistence Test");
+
+    const TempDirectory temp("adaptive_arena_persistence_test");
+    const std::filesystem::path& dir = temp.Path();
+
+    TestRoundTrip(dir);
+    TestFileFormat(dir);
+    TestCorruption(dir);
+    TestLegacyMigration(dir);
+    TestKeys();
+
+    return Summarize();
+}
@@ -0,0 +1,255 @@
+#define NOMINMAX
+#include "../src/UltrasoundArena.h"
+#include "../src/SessionRecorder.h"
+#include "../src/SessionReplay.h"
+#include "test_support.h"
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    // 4KB 경계에 맞지 않는 페이로드: 녹화 파일의 프레임 간격(payloadStride)과 유효 크기가 달라지는 경우를 포함
+    constexpr size_t kPayloadSize = 3 * 4096 + 100;
+    constexpr size_t kFrameCount = 64;
+    constexpr size_t kRingSlots = 16;
+    constexpr size_t kHardLimit = 256ull * 1024 * 1024;
+
+    // 프레임마다 다른 결정적 바이트 패턴 (xorshift)
+    void FillFrame(uint8_t* data, size_t length, uint64_t frame)
+    {
+        uint64_t state = 0x9E3779B97F4A7C15ull * (frame + 1);
+        for (size_t i = 0; i < length; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            data[i] = static_cast<uint8_t>(state);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Record
+    // 링에 kFrameCount 프레임을 발행하며 동시에 녹화한 뒤 Stop으로 파일을 확정합니다.
+    void Record(const std::filesystem::path& dir, const std::filesystem::path& file)
+    {
+        std::cout << "Record\n";
+
+        UltrasoundArena arena("record_replay_key", dir / "record_profile.bin", kHardLimit, false);
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kRingSlots);
+
+        SessionRecorder recorder(arena, file);
+        recorder.Start();
+
+        std::vector<uint8_t> frame(kPayloadSize);
+        for (uint64_t i = 0; i < kFrameCount; ++i)
+        {
+            size_t slot = 0;
+            while (!arena.TryClaimWrite(slot))
+            {
+                std::this_thread::yield();
+            }
+
+            FillFrame(frame.data(), frame.size(), i);
+            arena.WritePayload(slot, frame.data(), frame.size());
+
+            auto* header = static_cast<PacketHeader*>(arena.GetHeader(slot));
+            header->channelCount = 128 + static_cast<uint32_t>(i % 64);
+            header->sampleDepth = static_cast<uint32_t>(i);
+            arena.CommitWrite();
+        }
+
+        recorder.Stop();
+        Check(recorder.GetRecordedFrames() == kFrameCount, "every committed frame is recorded before Stop returns");
+        Check(recorder.GetCorruptFrames() == 0, "no frame is flagged corrupted");
+        std::cout << "  (direct I/O: " << (recorder.IsDirectIO() ? "yes" : "no, buffered fallback") << ")\n";
+
+        const uintmax_t size = std::filesystem::file_size(file);
+        Check(size % kRecordAlignment == 0, "record file is a whole number of 4KB blocks");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Replay
+    // 녹화 파일을 새 링에 재생하여 프레임 순서, 페이로드, 헤더 필드가 녹화 시점과 같은지 확인합니다.
+    void Replay(const std::filesystem::path& dir, const std::filesystem::path& file, bool zeroCopy, size_t loops)
+    {
+        std::cout << "Replay (" << (zeroCopy ? "zero-copy" : "copy") << ", loops " << loops << ")\n";
+
+        UltrasoundArena arena("record_replay_key", dir / "replay_profile.bin", kHardLimit, false);
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kRingSlots);
+        const size_t cursor = arena.AddCursor("Verify");
+
+        SessionReplay replay(arena, file);
+        Check(replay.GetFrameCount() == kFrameCount, "index holds every recorded frame");
+
+        ReplayOptions options;
+        options.pace = ReplayPace::AsFastAsPossible;
+        options.zeroCopy = zeroCopy;
+        options.loops = loops;
+        replay.Start(options);
+
+        std::vector<uint8_t> expected(kPayloadSize);
+        size_t payloadMismatches = 0;
+        size_t headerMismatches = 0;
+        uint64_t received = 0;
+        const uint64_t total = kFrameCount * loops;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+        while (received < total && std::chrono::steady_clock::now() < deadline)
+        {
+            size_t slot = 0;
+            if (!arena.AcquireRead(cursor, slot))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            const uint64_t frame = received % kFrameCount;
+            FillFrame(expected.data(), expected.size(), frame);
+            if (std::memcmp(arena.GetPayload(slot), expected.data(), expected.size()) != 0) ++payloadMismatches;
+
+            const auto* header = static_cast<const PacketHeader*>(arena.GetHeader(slot));
+            if (header->channelCount != 128 + frame % 64 || header->sampleDepth != frame) ++headerMismatches;
+
+            arena.Release(cursor);
+            ++received;
+        }
+
+        replay.Wait();
+        Check(received == total, "all " + std::to_string(total) + " frames arrive");
+        Check(payloadMismatches == 0, "payloads are bit-exact and in recorded order");
+        Check(headerMismatches == 0, "header fields are restored from the index");
+        Check(replay.IsFinished() && replay.GetReplayedFrames() == total, "replay reports completion");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Rejection
+    // 손상되거나 확정되지 않은 녹화는 매핑 접근 전에 생성자에서 거부되어야 합니다.
+    void Rejection(const std::filesystem::path& dir, const std::filesystem::path& file)
+    {
+        std::cout << "Rejection\n";
+
+        std::vector<uint8_t> original;
+        {
+            std::ifstream in(file, std::ios::binary);
+            original.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        RecordFileHeader header{};
+        std::memcpy(&header, original.data(), sizeof(header));
+
+        UltrasoundArena arena("record_replay_key", dir / "reject_profile.bin", kHardLimit, false);
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kRingSlots);
+
+        const std::filesystem::path bad = dir / "bad.rec";
+        auto rejects = [&](const std::string& what, const std::function<void(std::vector<uint8_t>&)>& mutate)
+        {
+            std::vector<uint8_t> bytes = original;
+            mutate(bytes);
+            {
+                std::ofstream out(bad, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            }
+
+            bool threw = false;
+            try
+            {
+                SessionReplay replay(arena, bad);
+            }
+            catch (const std::runtime_error&)
+            {
+                threw = true;
+            }
+            Check(threw, "rejected: " + what);
+        };
+
+        auto patch64 = [](std::vector<uint8_t>& bytes, size_t offset, uint64_t value)
+        {
+            std::memcpy(bytes.data() + offset, &value, sizeof(value));
+        };
+
+        rejects("file shorter than the header", [](std::vector<uint8_t>& b) { b.resize(sizeof(RecordFileHeader) - 1); });
+        rejects("unknown magic", [](std::vector<uint8_t>& b) { b[0] ^= 0xFF; });
+        rejects("recording that was never closed (no index)",
+                [&](std::vector<uint8_t>& b) { patch64(b, offsetof(RecordFileHeader, indexOffset), 0); });
+        rejects("index cut off by truncation", [&](std::vector<uint8_t>& b) { b.resize(static_cast<size_t>(header.indexOffset) + 8); });
+        rejects("frame count larger than the index",
+                [&](std::vector<uint8_t>& b) { patch64(b, offsetof(RecordFileHeader, frameCount), header.frameCount + 4096); });
+        rejects("payload larger than its stride",
+                [&](std::vector<uint8_t>& b) { patch64(b, offsetof(RecordFileHeader, payloadSize), header.payloadStride + 1); });
+        rejects("index entry pointing past the end of the file", [&](std::vector<uint8_t>& b)
+        {
+            patch64(b, static_cast<size_t>(header.indexOffset) + 5 * sizeof(RecordIndexEntry), b.size());
+        });
+        rejects("index entry pointing into the file header", [&](std::vector<uint8_t>& b)
+        {
+            patch64(b, static_cast<size_t>(header.indexOffset), 0);
+        });
+        rejects("index entries out of order", [&](std::vector<uint8_t>& b)
+        {
+            const size_t entry5 = static_cast<size_t>(header.indexOffset) + 5 * sizeof(RecordIndexEntry);
+            const size_t entry6 = entry5 + sizeof(RecordIndexEntry);
+            uint64_t offset5 = 0;
+            uint64_t offset6 = 0;
+            std::memcpy(&offset5, b.data() + entry5, sizeof(offset5));
+            std::memcpy(&offset6, b.data() + entry6, sizeof(offset6));
+            patch64(b, entry5, offset6);
+            patch64(b, entry6, offset5);
+        });
+        rejects("duplicate index offsets", [&](std::vector<uint8_t>& b)
+        {
+            const size_t entry5 = static_cast<size_t>(header.indexOffset) + 5 * sizeof(RecordIndexEntry);
+            uint64_t offset5 = 0;
+            std::memcpy(&offset5, b.data() + entry5, sizeof(offset5));
+            patch64(b, entry5 + sizeof(RecordIndexEntry), offset5);
+        });
+
+        // 녹화 프레임보다 작은 링에는 재생할 수 없음
+        UltrasoundArena small("record_replay_key", dir / "small_profile.bin", kHardLimit, false);
+        small.InitializeRing(sizeof(PacketHeader), 4096, kRingSlots);
+        bool threw = false;
+        try
+        {
+            SessionReplay replay(small, file);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        Check(threw, "rejected: ring payload smaller than the recorded frame");
+    }
+}
+
+int main()
+{
+    PrintTitle("Session Record / Replay Round Trip Test");
+
+    const TempDirectory temp("adaptive_arena_record_replay_test");
+    const std::filesystem::path& dir = temp.Path();
+    const std::filesystem::path file = dir / "session.rec";
+
+    try
+    {
+        Record(dir, file);
+        Replay(dir, file, false, 1);
+        Replay(dir, file, true, 1);
+        Replay(dir, file, false, 2);
+        Rejection(dir, file);
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
@@ -0,0 +1,275 @@
+#define NOMINMAX
+#include "../src/UltrasoundArena.h"
+#include "test_support.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr size_t kPayloadSize = 4096;
+    constexpr size_t kScratchBytes = UltrasoundArena::kDefaultScratchBytes;
+    constexpr size_t kInitialSlots = 8;
+
+    // 슬롯 maxSlots개까지만 담기는 Hard Limit (헤더 + 페이로드 + 스크래치)
+    constexpr size_t HardLimitFor(size_t maxSlots) { return maxSlots * (sizeof(PacketHeader) + kPayloadSize + kScratchBytes); }
+
+    uint8_t PatternByte(uint64_t sequence) { return static_cast<uint8_t>(sequence * 31 + 7); }
+
+    // 링과 프레임을 바로 해제하는 소비자 하나
+    struct Ring
+    {
+        UltrasoundArena arena;
+        size_t viewer;
+
+        Ring(const std::filesystem::path& file, size_t maxSlots)
+            : arena("retention_key", file, HardLimitFor(maxSlots), false)
+        {
+            RingPrefaultOptions options;
+            options.scratchBytes = kScratchBytes;
+            arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kInitialSlots, options);
+            viewer = arena.AddCursor("Viewer");
+        }
+
+        // 한 프레임을 발행하고 소비자가 곧바로 해제합니다. 슬롯을 얻지 못하면 false.
+        bool Publish(uint64_t sequence)
+        {
+            size_t slot = 0;
+            if (!arena.TryClaimWrite(slot)) return false;
+
+            std::memset(arena.GetPayload(slot), PatternByte(sequence), kPayloadSize);
+            static_cast<PacketHeader*>(arena.GetHeader(slot))->sampleDepth = static_cast<uint32_t>(sequence);
+            arena.CommitWrite();
+
+            size_t read = 0;
+            if (arena.AcquireRead(viewer, read)) arena.Release(viewer);
+            return true;
+        }
+    };
+
+    bool Holds(const FrameLease& lease, uint64_t sequence)
+    {
+        if (!lease || lease.GetSequence() != sequence) return false;
+        if (static_cast<const PacketHeader*>(lease.GetHeader())->sampleDepth != sequence) return false;
+
+        const auto* payload = static_cast<const uint8_t*>(lease.GetPayload());
+        for (size_t i = 0; i < kPayloadSize; ++i)
+        {
+            if (payload[i] != PatternByte(sequence)) return false;
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunRetentionWindow
+    // 보존 창보다 링이 작으면 Hard Limit 안에서 링을 넓혀 최근 N 프레임을 덮어쓰지 않고 남겨야 합니다.
+    void RunRetentionWindow(const std::filesystem::path& dir)
+    {
+        std::cout << "Retention window (16 frames, ring of 8, limit 64)\n";
+
+        Ring ring(dir / "window_profile.bin", 64);
+        RetentionPolicy policy;
+        policy.frames = 16;
+        ring.arena.SetRetention(policy);
+
+        size_t published = 0;
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            if (ring.Publish(i)) ++published;
+        }
+
+        uint64_t first = 0;
+        uint64_t end = 0;
+        ring.arena.GetRetainedRange(first, end);
+
+        Check(published == 100, "producer never stalls while the ring can grow");
+        Check(end == 100 && end - first >= 16, "retained range covers the last 16 frames");
+        Check(Holds(ring.arena.LeaseFrame(end - 16), end - 16), "oldest frame in the window is still intact");
+        Check(ring.arena.GetRingExpansions() > 0, "ring expanded to hold the window");
+        Check(ring.arena.GetRetentionEvictions() == 0, "nothing evicted below the hard limit");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunLeaseProtects
+    // 임대 중인 과거 프레임은 보존 정책이 없어도 덮어쓰이면 안 됩니다. 링은 Hard Limit까지 넓어지고,
+    // 그 뒤에는 임대가 반납될 때까지 Producer가 Back-pressure를 받습니다.
+    void RunLeaseProtects(const std::filesystem::path& dir)
+    {
+        std::cout << "Lease keeps a frame alive\n";
+
+        Ring ring(dir / "lease_profile.bin", 32);
+        for (uint64_t i = 0; i < kInitialSlots; ++i)
+        {
+            ring.Publish(i);
+        }
+
+        FrameLease lease = ring.arena.LeaseFrame(3);
+        Check(Holds(lease, 3), "lease on a published frame sees its contents");
+        Check(!ring.arena.LeaseFrame(kInitialSlots), "lease on an unpublished frame is empty");
+
+        FrameLease copy = lease;
+        size_t published = 0;
+        for (uint64_t i = kInitialSlots; i < kInitialSlots + 200; ++i)
+        {
+            if (ring.Publish(i)) ++published;
+        }
+        Check(published > 32 - kInitialSlots, "ring grows around the leased slot (" + std::to_string(published) + " frames)");
+        Check(published < 200, "producer is held back at the hard limit rather than overwrite the lease");
+        Check(Holds(lease, 3) && Holds(copy, 3), "leased frame is still intact");
+
+        lease.Reset();
+        Check(!ring.Publish(kInitialSlots + published), "a remaining copy of the lease still holds the slot");
+        copy.Reset();
+        Check(ring.Publish(kInitialSlots + published), "returning every lease releases the producer");
+        for (uint64_t i = kInitialSlots + published + 1; i < kInitialSlots + published + 100; ++i)
+        {
+            ring.Publish(i);
+        }
+        Check(!ring.arena.LeaseFrame(3), "frame is reused once every lease is returned");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunHardLimitEviction
+    // Hard Limit에 닿으면 보존 창은 가장 오래된 프레임부터 포기하고, Producer는 멈추지 않아야 합니다.
+    void RunHardLimitEviction(const std::filesystem::path& dir)
+    {
+        std::cout << "Retention beyond the hard limit (1000 frames, limit 16)\n";
+
+        Ring ring(dir / "evict_profile.bin", 16);
+        RetentionPolicy policy;
+        policy.frames = 1000;
+        ring.arena.SetRetention(policy);
+
+        size_t published = 0;
+        for (uint64_t i = 0; i < 200; ++i)
+        {
+            if (ring.Publish(i)) ++published;
+        }
+
+        uint64_t first = 0;
+        uint64_t end = 0;
+        ring.arena.GetRetainedRange(first, end);
+
+        Check(published == 200, "producer never stalls at the hard limit");
+        Check(ring.arena.GetRetentionEvictions() > 0, "evictions are counted");
+        Check(ring.arena.GetRingBufferSize() <= 16, "ring stays within the hard limit (" + std::to_string(ring.arena.GetRingBufferSize()) + " slots)");
+        Check(end == 200 && end - first <= 16, "retained range shrinks to the ring");
+        Check(Holds(ring.arena.LeaseFrame(end - 1), end - 1), "newest frame is intact");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunFreeze
+    // 고정된 프레임은 Thaw 전까지 재사용되지 않아야 합니다. Hard Limit에 닿으면 고정 슬롯을 회전에서 빼내고
+    // Producer는 나머지 슬롯으로 계속 진행합니다.
+    void RunFreeze(const std::filesystem::path& dir)
+    {
+        std::cout << "Freeze and thaw (8 frames, limit 16)\n";
+
+        Ring ring(dir / "freeze_profile.bin", 16);
+        RetentionPolicy policy;
+        policy.frames = 8;
+        ring.arena.SetRetention(policy);
+
+        uint64_t next = 0;
+        for (; next < 20; ++next)
+        {
+            ring.Publish(next);
+        }
+
+        ring.arena.FreezeRetention();
+        uint64_t first = 0;
+        uint64_t end = 0;
+        ring.arena.GetRetainedRange(first, end);
+        Check(ring.arena.IsRetentionFrozen() && end == 20 && end - first >= 8, "freeze captures the retained window");
+
+        size_t published = 0;
+        for (size_t i = 0; i < 200; ++i, ++next)
+        {
+            if (ring.Publish(next)) ++published;
+        }
+        Check(published == 200, "producer keeps going past the hard limit with frozen slots parked");
+        Check(ring.arena.GetRingBufferSize() < 16, "frozen slots leave the rotation (" + std::to_string(ring.arena.GetRingBufferSize()) + " slots rotating)");
+
+        bool intact = true;
+        for (uint64_t sequence = first; sequence < end; ++sequence)
+        {
+            intact = intact && Holds(ring.arena.LeaseFrame(sequence), sequence);
+        }
+        Check(intact, "every frozen frame is still intact");
+
+        ring.arena.ThawRetention();
+        for (size_t i = 0; i < 50; ++i, ++next)
+        {
+            ring.Publish(next);
+        }
+        Check(!ring.arena.LeaseFrame(first), "thawed frames are reused");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunExpansionLimitLog
+    // 소비자가 멈춘 채 Hard Limit에 닿은 링은 매 시도마다 확장을 요청하지만, 거부 경고는 한 번만 출력되어야 합니다.
+    void RunExpansionLimitLog(const std::filesystem::path& dir)
+    {
+        std::cout << "Hard limit warning is logged once\n";
+
+        UltrasoundArena arena("retention_key", dir / "limit_profile.bin", HardLimitFor(kInitialSlots), false);
+        RingPrefaultOptions options;
+        options.scratchBytes = kScratchBytes;
+        arena.InitializeRing(sizeof(PacketHeader), kPayloadSize, kInitialSlots, options);
+        arena.AddCursor("Stalled");
+
+        std::ostringstream captured;
+        std::streambuf* original = std::cerr.rdbuf(captured.rdbuf());
+
+        size_t rejected = 0;
+        const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(2500);
+        while (std::chrono::steady_clock::now() < until)
+        {
+            size_t slot = 0;
+            if (arena.TryClaimWrite(slot)) arena.CommitWrite();
+            else ++rejected;
+        }
+
+        std::cerr.rdbuf(original);
+
+        const std::string log = captured.str();
+        size_t warnings = 0;
+        for (size_t at = log.find("Expansion rejected"); at != std::string::npos; at = log.find("Expansion rejected", at + 1))
+        {
+            ++warnings;
+        }
+
+        Check(rejected > 0, "full ring rejects claims");
+        Check(arena.GetRingBufferSize() == kInitialSlots, "ring does not grow past the hard limit");
+        Check(warnings == 1, "rejection warning printed once (" + std::to_string(warnings) + " times)");
+    }
+}
+
+int main()
+{
+    PrintTitle("Cine Retention / Frame Lease Test");
+
+    const TempDirectory temp("adaptive_arena_retention_test");
+    const std::filesystem::path& dir = temp.Path();
+
+    try
+    {
+        RunRetentionWindow(dir);
+        RunLeaseProtects(dir);
+        RunHardLimitEviction(dir);
+        RunFreeze(dir);
+        RunExpansionLimitLog(dir);
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
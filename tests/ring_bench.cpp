@@ -0,0 +1,622 @@
+#define NOMINMAX
+#include "AdaptiveArena.h"
+#include "../src/UltrasoundArena.h"
+#include "../src/LatencyHistogram.h"
+#include <immintrin.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Service Time Models
+    // 소비자 처리 시간은 sleep이 아니라 바쁜 작업(Busy-work)으로 소비합니다. 모델은 소비자마다 복제되어 각자 상태(RNG, Markov 상태)를 가집니다.
+
+    class ServiceTimeModel
+    {
+    public:
+        virtual ~ServiceTimeModel() = default;
+        virtual uint64_t NextServiceNs() = 0;
+        virtual std::unique_ptr<ServiceTimeModel> Clone(uint64_t seed) const = 0;
+    };
+
+    struct JitterParams
+    {
+        std::string model = "lognormal";
+        double serviceUs = 100.0;   // 평균(uniform/none) 또는 중앙값(lognormal), bursty는 정상 상태 값
+        double spread = 0.5;        // uniform: [S(1-spread), S(1+spread)]
+        double sigma = 0.5;         // lognormal: ln(서비스 시간)의 표준편차
+        double burstFactor = 10.0;  // bursty: 버스트 상태의 서비스 시간 배수
+        double burstEnter = 0.01;   // bursty: 프레임마다 정상 → 버스트 전이 확률
+        double burstExit = 0.1;     // bursty: 프레임마다 버스트 → 정상 전이 확률
+    };
+
+    class ConstantModel : public ServiceTimeModel
+    {
+    public:
+        explicit ConstantModel(double serviceNs) : m_serviceNs(static_cast<uint64_t>(serviceNs)) {}
+        uint64_t NextServiceNs() override { return m_serviceNs; }
+        std::unique_ptr<ServiceTimeModel> Clone(uint64_t) const override { return std::make_unique<ConstantModel>(*this); }
+
+    private:
+        uint64_t m_serviceNs;
+    };
+
+    class UniformModel : public ServiceTimeModel
+    {
+    public:
+        UniformModel(double serviceNs, double spread, uint64_t seed)
+            : m_rng(seed), m_dist(serviceNs * std::max(0.0, 1.0 - spread), serviceNs * (1.0 + spread)) {}
+        uint64_t NextServiceNs() override { return static_cast<uint64_t>(m_dist(m_rng)); }
+
+        std::unique_ptr<ServiceTimeModel> Clone(uint64_t seed) const override
+        {
+            auto clone = std::make_unique<UniformModel>(*this);
+            clone->m_rng.seed(seed);
+            return clone;
+        }
+
+    private:
+        std::mt19937_64 m_rng;
+        std::uniform_real_distribution<double> m_dist;
+    };
+
+    class LogNormalModel : public ServiceTimeModel
+    {
+    public:
+        LogNormalModel(double medianNs, double sigma, uint64_t seed) : m_rng(seed), m_dist(std::log(medianNs), sigma) {}
+        uint64_t NextServiceNs() override { return static_cast<uint64_t>(m_dist(m_rng)); }
+        std::unique_ptr<ServiceTimeModel> Clone(uint64_t seed) const override { return std::make_unique<LogNormalModel>(std::exp(m_dist.m()), m_dist.s(), seed); }
+
+    private:
+        std::mt19937_64 m_rng;
+        std::lognormal_distribution<double> m_dist;
+    };
+
+    class BurstyModel : public ServiceTimeModel
+    {
+    public:
+        BurstyModel(double serviceNs, double burstFactor, double enter, double exit, uint64_t seed)
+            : m_serviceNs(serviceNs), m_burstFactor(burstFactor), m_enter(enter), m_exit(exit), m_rng(seed) {}
+
+        uint64_t NextServiceNs() override
+        {
+            // 2상태 Markov 체인: 버스트는 평균 1/exit 프레임 동안 지속
+            const double u = m_unit(m_rng);
+            m_inBurst = m_inBurst ? (u >= m_exit) : (u < m_enter);
+            return static_cast<uint64_t>(m_inBurst ? m_serviceNs * m_burstFactor : m_serviceNs);
+        }
+
+        std::unique_ptr<ServiceTimeModel> Clone(uint64_t seed) const override
+        {
+            return std::make_unique<BurstyModel>(m_serviceNs, m_burstFactor, m_enter, m_exit, seed);
+        }
+
+    private:
+        double m_serviceNs;
+        double m_burstFactor;
+        double m_enter;
+        double m_exit;
+        bool m_inBurst = false;
+        std::mt19937_64 m_rng;
+        std::uniform_real_distribution<double> m_unit{ 0.0, 1.0 };
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MakeModel
+    std::unique_ptr<ServiceTimeModel> MakeModel(const JitterParams& params)
+    {
+        const double serviceNs = params.serviceUs * 1000.0;
+        if (params.model == "none") return std::make_unique<ConstantModel>(serviceNs);
+        if (params.model == "uniform") return std::make_unique<UniformModel>(serviceNs, params.spread, 1);
+        if (params.model == "lognormal") return std::make_unique<LogNormalModel>(serviceNs, params.sigma, 1);
+        if (params.model == "bursty") return std::make_unique<BurstyModel>(serviceNs, params.burstFactor, params.burstEnter, params.burstExit, 1);
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // BusyWork
+    // 페이로드를 캐시 라인 단위로 읽은 뒤(touch) 남은 시간을 회전 대기로 채웁니다.
+    void BusyWork(uint64_t serviceNs, const void* payload, size_t payloadSize, bool touch)
+    {
+        const uint64_t start = AdaptiveArena::TscClock::NowNs();
+        if (touch)
+        {
+            const volatile uint64_t* words = static_cast<const volatile uint64_t*>(payload);
+            uint64_t sum = 0;
+            for (size_t i = 0; i < payloadSize / sizeof(uint64_t); i += 8) sum += words[i];
+            (void)sum;
+        }
+        while (AdaptiveArena::TscClock::NowNs() - start < serviceNs) _mm_pause();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Options / Result
+
+    struct BenchOptions
+    {
+        size_t frames = 20000;
+        double fps = 0.0;               // 0이면 최대 속도 (Back-pressure까지 밀어붙임)
+        size_t payloadSize = 4 * 1024 * 1024;
+        size_t initialSlots = 8;
+        size_t consumers = 1;
+        bool touch = false;             // Producer가 페이로드 전체를 쓰고 소비자가 전체를 읽음
+        bool warm = false;              // 아레나 프로필을 실행 사이에 유지 (기본: 매번 콜드 스타트)
+        std::string workload;           // 장비(SKU)별 워크로드 키 (비어 있으면 기본)
+        std::filesystem::path profilePath = std::filesystem::temp_directory_path() / "ring_bench_profile.bin";
+        JitterParams jitter;
+    };
+
+    struct RingResult
+    {
+        std::string name;
+        uint64_t frames = 0;            // 발행된 프레임
+        double seconds = 0.0;
+        double framesPerSec = 0.0;
+        double gbPerSec = 0.0;
+        size_t lagP50 = 0;
+        size_t lagP99 = 0;
+        size_t lagMax = 0;
+        size_t initialSlots = 0;
+        size_t finalSlots = 0;
+        uint64_t expansions = 0;        // GetRingExpansions (실제 확장 횟수)
+        uint64_t drops = 0;             // 페이싱 시각에 빈 슬롯이 없어 버린 프레임 + 덮어쓴 프레임
+        uint64_t stalls = 0;            // 최대 속도에서 슬롯을 기다린 재시도 횟수
+        AdaptiveArena::LatencyPercentiles latency;   // Commit → Release
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // LagRecorder
+    // 발행 시점의 미해제 프레임 수 분포 (정수 칸, 마지막 칸은 그 이상)
+    class LagRecorder
+    {
+    public:
+        void Record(size_t lag) { m_bins[std::min(lag, m_bins.size() - 1)]++; }
+
+        size_t Quantile(double q) const
+        {
+            uint64_t total = 0;
+            for (uint64_t count : m_bins) total += count;
+            if (total == 0) return 0;
+
+            const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < m_bins.size(); ++i)
+            {
+                seen += m_bins[i];
+                if (seen >= rank) return i;
+            }
+            return m_bins.size() - 1;
+        }
+
+        size_t Max() const
+        {
+            for (size_t i = m_bins.size(); i > 0; --i)
+            {
+                if (m_bins[i - 1]) return i - 1;
+            }
+            return 0;
+        }
+
+    private:
+        std::vector<uint64_t> m_bins = std::vector<uint64_t>(4097, 0);
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Finish
+    void Finish(RingResult& result, const BenchOptions& options, double seconds, const LagRecorder& lag, const AdaptiveArena::LatencyHistogram& latency)
+    {
+        result.seconds = seconds;
+        result.framesPerSec = seconds > 0.0 ? static_cast<double>(result.frames) / seconds : 0.0;
+        result.gbPerSec = result.framesPerSec * static_cast<double>(options.payloadSize) / (1024.0 * 1024.0 * 1024.0);
+        result.lagP50 = lag.Quantile(0.50);
+        result.lagP99 = lag.Quantile(0.99);
+        result.lagMax = lag.Max();
+        result.latency = latency.Summarize();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunArena
+    RingResult RunArena(const BenchOptions& options, const ServiceTimeModel& model)
+    {
+        RingResult result;
+        result.name = "ultrasound_arena";
+
+        if (!options.warm) std::filesystem::remove(options.profilePath);
+
+        AdaptiveArena::Builder builder;
+        builder.SetKey("RingBench_Key")
+               .SetPath(options.profilePath)
+               .SetMode(AdaptiveArena::ArenaMode::UltrasoundRF)
+               .SetGpuDirect(false)
+               .SetTelemetryRate(0.0)
+               .SetCheckpointInterval(std::chrono::milliseconds(0));
+        if (!options.workload.empty()) builder.SetWorkloadKey(options.workload);
+        auto arena = builder.Build();
+
+        auto* ring = dynamic_cast<AdaptiveArena::UltrasoundArena*>(arena.get());
+        ring->InitializeRing(512, options.payloadSize, options.initialSlots);
+        result.initialSlots = ring->GetRingBufferSize();
+
+        std::vector<size_t> cursors;
+        for (size_t c = 0; c < options.consumers; ++c) cursors.push_back(ring->AddCursor("bench" + std::to_string(c)));
+
+        AdaptiveArena::LatencyHistogram latency;
+        std::atomic<uint64_t> committed{ 0 };
+        std::atomic<bool> producerDone{ false };
+        std::atomic<bool> go{ false };
+
+        std::vector<std::thread> consumers;
+        for (size_t c = 0; c < options.consumers; ++c)
+        {
+            consumers.emplace_back([&, c]()
+            {
+                std::unique_ptr<ServiceTimeModel> service = model.Clone(0xC0DE + c);
+                uint64_t consumed = 0;
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                while (true)
+                {
+                    size_t index;
+                    if (ring->TryAcquire(cursors[c], index))
+                    {
+                        const uint64_t commitNs = static_cast<const AdaptiveArena::PacketHeader*>(ring->GetHeader(index))->timestamp;
+                        BusyWork(service->NextServiceNs(), ring->GetPayload(index), options.payloadSize, options.touch);
+                        ring->Release(cursors[c]);
+                        latency.Record(AdaptiveArena::TscClock::NowNs() - commitNs);
+                        consumed++;
+                    }
+                    else if (producerDone.load(std::memory_order_acquire) && consumed >= committed.load(std::memory_order_acquire))
+                    {
+                        break;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        LagRecorder lag;
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+
+        // Producer (이 스레드): 페이싱 모드는 마감 시각까지 회전 대기 후 한 번만 시도하고, 실패하면 그 프레임을 버림
+        const uint64_t periodNs = options.fps > 0.0 ? static_cast<uint64_t>(1e9 / options.fps) : 0;
+        uint64_t deadline = AdaptiveArena::TscClock::NowNs();
+        for (size_t f = 0; f < options.frames; ++f)
+        {
+            size_t index = 0;
+            if (periodNs)
+            {
+                deadline += periodNs;
+                while (AdaptiveArena::TscClock::NowNs() < deadline) std::this_thread::yield();
+                if (!ring->TryClaimWrite(index))
+                {
+                    result.drops++;
+                    continue;
+                }
+            }
+            else
+            {
+                while (!ring->TryClaimWrite(index))
+                {
+                    result.stalls++;
+                    std::this_thread::yield();
+                }
+            }
+
+            void* payload = ring->GetPayload(index);
+            if (options.touch) std::memset(payload, static_cast<int>(f), options.payloadSize);
+            else *static_cast<uint64_t*>(payload) = f;
+            ring->CommitWrite();
+            committed.fetch_add(1, std::memory_order_release);
+
+            lag.Record(ring->GetCurrentLag());
+        }
+        producerDone.store(true, std::memory_order_release);
+        for (auto& consumer : consumers) consumer.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (size_t cursor : cursors) ring->DetachCursor(cursor);
+        result.frames = committed.load();
+        result.finalSlots = ring->GetRingBufferSize();
+        result.expansions = ring->GetRingExpansions();
+        result.drops += ring->GetDroppedFrames();
+        Finish(result, options, seconds, lag, latency);
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunMutexQueue
+    // 기준선: 같은 슬롯 수의 고정 프레임 풀 + 소비자별 std::queue(mutex + condition_variable). 확장 없음.
+    RingResult RunMutexQueue(const BenchOptions& options, const ServiceTimeModel& model)
+    {
+        struct Frame
+        {
+            uint64_t commitNs = 0;
+            std::atomic<size_t> refs{ 0 };
+            std::unique_ptr<char[]> payload;
+        };
+
+        struct ConsumerQueue
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::queue<Frame*> frames;
+        };
+
+        RingResult result;
+        result.name = "mutex_queue";
+        result.initialSlots = result.finalSlots = options.initialSlots;
+
+        std::vector<std::unique_ptr<Frame>> pool;
+        std::vector<Frame*> freeList;
+        std::mutex freeMutex;
+        for (size_t i = 0; i < options.initialSlots; ++i)
+        {
+            pool.push_back(std::make_unique<Frame>());
+            pool.back()->payload.reset(new char[options.payloadSize]);
+            std::memset(pool.back()->payload.get(), 0, options.payloadSize);
+            freeList.push_back(pool.back().get());
+        }
+
+        std::vector<std::unique_ptr<ConsumerQueue>> queues;
+        for (size_t c = 0; c < options.consumers; ++c) queues.push_back(std::make_unique<ConsumerQueue>());
+
+        AdaptiveArena::LatencyHistogram latency;
+        std::atomic<bool> producerDone{ false };
+        std::atomic<bool> go{ false };
+
+        std::vector<std::thread> consumers;
+        for (size_t c = 0; c < options.consumers; ++c)
+        {
+            consumers.emplace_back([&, c]()
+            {
+                std::unique_ptr<ServiceTimeModel> service = model.Clone(0xC0DE + c);
+                ConsumerQueue& queue = *queues[c];
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                while (true)
+                {
+                    Frame* frame = nullptr;
+                    {
+                        std::unique_lock<std::mutex> lock(queue.mutex);
+                        queue.cv.wait(lock, [&]() { return !queue.frames.empty() || producerDone.load(std::memory_order_acquire); });
+                        if (queue.frames.empty()) break;
+                        frame = queue.frames.front();
+                        queue.frames.pop();
+                    }
+
+                    BusyWork(service->NextServiceNs(), frame->payload.get(), options.payloadSize, options.touch);
+                    const uint64_t commitNs = frame->commitNs;
+                    if (frame->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        std::lock_guard<std::mutex> lock(freeMutex);
+                        freeList.push_back(frame);
+                    }
+                    latency.Record(AdaptiveArena::TscClock::NowNs() - commitNs);
+                }
+            });
+        }
+
+        LagRecorder lag;
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+
+        const uint64_t periodNs = options.fps > 0.0 ? static_cast<uint64_t>(1e9 / options.fps) : 0;
+        uint64_t deadline = AdaptiveArena::TscClock::NowNs();
+        for (size_t f = 0; f < options.frames; ++f)
+        {
+            if (periodNs)
+            {
+                deadline += periodNs;
+                while (AdaptiveArena::TscClock::NowNs() < deadline) std::this_thread::yield();
+            }
+
+            Frame* frame = nullptr;
+            size_t inFlight = 0;
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(freeMutex);
+                    if (!freeList.empty())
+                    {
+                        frame = freeList.back();
+                        freeList.pop_back();
+                    }
+                    inFlight = options.initialSlots - freeList.size();
+                }
+                if (frame || periodNs) break;
+                result.stalls++;
+                std::this_thread::yield();
+            }
+            if (!frame)
+            {
+                result.drops++;
+                continue;
+            }
+
+            if (options.touch) std::memset(frame->payload.get(), static_cast<int>(f), options.payloadSize);
+            else *reinterpret_cast<uint64_t*>(frame->payload.get()) = f;
+            frame->refs.store(options.consumers, std::memory_order_relaxed);
+            frame->commitNs = AdaptiveArena::TscClock::NowNs();
+            for (auto& queue : queues)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(queue->mutex);
+                    queue->frames.push(frame);
+                }
+                queue->cv.notify_one();
+            }
+            result.frames++;
+            lag.Record(inFlight);
+        }
+
+        producerDone.store(true, std::memory_order_release);
+        for (auto& queue : queues)
+        {
+            // 대기 중인 소비자가 종료 조건을 다시 보도록 (잠금 안에서 통보하여 깨움 유실 방지)
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->cv.notify_all();
+        }
+        for (auto& consumer : consumers) consumer.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        Finish(result, options, seconds, lag, latency);
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WriteJson
+    void WriteJson(std::ostream& out, const BenchOptions& options, const std::vector<RingResult>& results)
+    {
+        out << std::fixed << std::setprecision(2);
+        out << "{\"benchmark\":\"ring_bench\",\"version\":1"
+            << ",\"frames\":" << options.frames << ",\"fps\":" << options.fps << ",\"payloadBytes\":" << options.payloadSize
+            << ",\"initialSlots\":" << options.initialSlots << ",\"consumers\":" << options.consumers
+            << ",\"touch\":" << (options.touch ? "true" : "false") << ",\"warm\":" << (options.warm ? "true" : "false")
+            << ",\"workload\":\"" << options.workload << "\""
+            << ",\"jitter\":{\"model\":\"" << options.jitter.model << "\",\"serviceUs\":" << options.jitter.serviceUs
+            << ",\"spread\":" << options.jitter.spread << ",\"sigma\":" << options.jitter.sigma << ",\"burstFactor\":" << options.jitter.burstFactor
+            << ",\"burstEnter\":" << options.jitter.burstEnter << ",\"burstExit\":" << options.jitter.burstExit << "}"
+            << ",\"results\":[";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const RingResult& r = results[i];
+            out << (i ? "," : "") << "\n  {\"impl\":\"" << r.name << "\",\"frames\":" << r.frames << ",\"seconds\":" << r.seconds
+                << ",\"framesPerSec\":" << r.framesPerSec << ",\"gbPerSec\":" << r.gbPerSec
+                << ",\"lag\":{\"p50\":" << r.lagP50 << ",\"p99\":" << r.lagP99 << ",\"max\":" << r.lagMax << "}"
+                << ",\"initialSlots\":" << r.initialSlots << ",\"finalSlots\":" << r.finalSlots << ",\"expansions\":" << r.expansions
+                << ",\"drops\":" << r.drops << ",\"stalls\":" << r.stalls
+                << ",\"commitToReleaseUs\":{\"samples\":" << r.latency.samples << ",\"p50\":" << r.latency.p50Us << ",\"p99\":" << r.latency.p99Us
+                << ",\"p999\":" << r.latency.p999Us << ",\"max\":" << r.latency.maxUs << ",\"mean\":" << r.latency.meanUs << "}}";
+        }
+        out << "\n]}\n";
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief  링 슬롯 전달(TryClaimWrite → CommitWrite → TryAcquire → Release)을 sleep 없이 측정하고 mutex 큐 기준선과 비교합니다.
+ *         소비자 처리 시간은 선택한 분포(none/uniform/lognormal/bursty)의 바쁜 작업이며, 최대 속도(--fps 0) 또는 고정 프레임률로 구동합니다.
+ *         사용법: ring_bench [--frames N] [--fps F] [--payload BYTES] [--slots N] [--consumers N] [--touch]
+ *                           [--jitter none|uniform|lognormal|bursty] [--service-us S] [--spread A] [--sigma S]
+ *                           [--burst-factor K] [--burst-enter P] [--burst-exit P] [--workload KEY] [--warm]
+ *                           [--impl ultrasound_arena,mutex_queue] [--json path]
+ */
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    std::vector<std::string> impls = { "ultrasound_arena", "mutex_queue" };
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--frames") == 0 && hasValue) options.frames = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--fps") == 0 && hasValue) options.fps = std::max(0.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--payload") == 0 && hasValue) options.payloadSize = std::max<size_t>(64, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--slots") == 0 && hasValue) options.initialSlots = std::max<size_t>(2, std::strtoull(argv[++i], nullptr, 10));
+        else if (std::strcmp(argv[i], "--consumers") == 0 && hasValue) options.consumers = std::clamp<size_t>(std::strtoull(argv[++i], nullptr, 10), 1, 16);
+        else if (std::strcmp(argv[i], "--touch") == 0) options.touch = true;
+        else if (std::strcmp(argv[i], "--warm") == 0) options.warm = true;
+        else if (std::strcmp(argv[i], "--workload") == 0 && hasValue) options.workload = argv[++i];
+        else if (std::strcmp(argv[i], "--jitter") == 0 && hasValue) options.jitter.model = argv[++i];
+        else if (std::strcmp(argv[i], "--service-us") == 0 && hasValue) options.jitter.serviceUs = std::max(0.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--spread") == 0 && hasValue) options.jitter.spread = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--sigma") == 0 && hasValue) options.jitter.sigma = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--burst-factor") == 0 && hasValue) options.jitter.burstFactor = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--burst-enter") == 0 && hasValue) options.jitter.burstEnter = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--burst-exit") == 0 && hasValue) options.jitter.burstExit = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--impl") == 0 && hasValue)
+        {
+            impls.clear();
+            std::stringstream stream(argv[++i]);
+            std::string item;
+            while (std::getline(stream, item, ',')) if (!item.empty()) impls.push_back(item);
+        }
+        else if (std::strcmp(argv[i], "--json") == 0 && hasValue) jsonPath = argv[++i];
+        else
+        {
+            std::cerr << "Unknown argument: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<ServiceTimeModel> model = MakeModel(options.jitter);
+    if (!model)
+    {
+        std::cerr << "Unknown jitter model: " << options.jitter.model << " (none, uniform, lognormal, bursty)" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Frames: " << options.frames << " | Rate: " << (options.fps > 0.0 ? std::to_string(options.fps) + " fps" : std::string("max"))
+              << " | Payload: " << options.payloadSize << " B | Slots: " << options.initialSlots << " | Consumers: " << options.consumers
+              << " | Jitter: " << options.jitter.model << " @ " << options.jitter.serviceUs << " us\n";
+
+    std::vector<RingResult> results;
+    try
+    {
+        for (const auto& impl : impls)
+        {
+            if (impl == "ultrasound_arena") results.push_back(RunArena(options, *model));
+            else if (impl == "mutex_queue") results.push_back(RunMutexQueue(options, *model));
+            else
+            {
+                std::cerr << "Unknown implementation: " << impl << std::endl;
+                return 1;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "\n" << std::left << std::setw(18) << "impl" << std::right << std::setw(11) << "frames/s" << std::setw(8) << "GB/s"
+              << std::setw(16) << "lag p50/99/max" << std::setw(10) << "slots" << std::setw(6) << "exp" << std::setw(8) << "drops" << std::setw(10) << "stalls"
+              << "    " << "commit->release p50/p99/p99.9/max (us)" << "\n";
+    for (const RingResult& r : results)
+    {
+        std::ostringstream lag, slots, latency;
+        lag << r.lagP50 << "/" << r.lagP99 << "/" << r.lagMax;
+        slots << r.initialSlots << "->" << r.finalSlots;
+        latency << std::fixed << std::setprecision(1) << r.latency.p50Us << " / " << r.latency.p99Us << " / " << r.latency.p999Us << " / " << r.latency.maxUs;
+        std::cout << std::left << std::setw(18) << r.name << std::right << std::fixed << std::setprecision(0) << std::setw(11) << r.framesPerSec
+                  << std::setprecision(2) << std::setw(8) << r.gbPerSec << std::setw(16) << lag.str() << std::setw(10) << slots.str()
+                  << std::setw(6) << r.expansions << std::setw(8) << r.drops << std::setw(10) << r.stalls << "    " << latency.str() << "\n";
+    }
+
+    if (!jsonPath.empty())
+    {
+        std::ofstream file(jsonPath, std::ios::trunc);
+        if (!file)
+        {
+            std::cerr << "Failed to write " << jsonPath << std::endl;
+            return 1;
+        }
+        WriteJson(file, options, results);
+        std::cout << "JSON written to " << jsonPath << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,359 @@
+#define NOMINMAX
+#include "../src/UltrasoundArena.h"
+#include "../src/SharedRing.h"
+#include "test_support.h"
+#include <windows.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr size_t kPayloadSize = 8192;
+    constexpr size_t kRingSlots = 8;
+    constexpr size_t kHardLimit = 256ull * 1024 * 1024;
+    constexpr const char* kChildFlag = "--attach-and-exit";
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ControlView
+    // 테스트가 Control 블록을 직접 들여다보고 (멈춘 소비자 자리를 심는 등) 조작하기 위한 별도 뷰
+    class ControlView
+    {
+    public:
+        explicit ControlView(const std::wstring& name)
+            : m_mapping(OpenFileMappingW(FILE_MAP_READ | FILE_MAP_WRITE, FALSE, name.c_str()))
+            , m_control(nullptr)
+        {
+            if (!m_mapping)
+            {
+                throw std::runtime_error("Failed to open the shared ring segment.");
+            }
+            m_control = static_cast<SharedRingControl*>(MapViewOfFile(m_mapping, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, kSharedControlBytes));
+            if (!m_control)
+            {
+                CloseHandle(m_mapping);
+                throw std::runtime_error("Failed to map the shared ring control block.");
+            }
+        }
+
+        ~ControlView()
+        {
+            UnmapViewOfFile(m_control);
+            CloseHandle(m_mapping);
+        }
+
+        SharedRingControl* operator->() const { return m_control; }
+
+        size_t CountActive() const
+        {
+            size_t count = 0;
+            for (const SharedConsumerEntry& entry : m_control->consumers)
+            {
+                if (entry.active.load() == 1) ++count;
+            }
+            return count;
+        }
+
+        SharedConsumerEntry* FindByPid(uint32_t pid) const
+        {
+            for (SharedConsumerEntry& entry : m_control->consumers)
+            {
+                if (entry.active.load() != 0 && entry.pid.load() == pid) return &entry;
+            }
+            return nullptr;
+        }
+
+    private:
+        HANDLE m_mapping;
+        SharedRingControl* m_control;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Publish
+    // 프레임 하나를 발행합니다 (페이로드 앞 8바이트 = 발행 순번). 링이 막혀 있으면 timeout까지 재시도합니다.
+    bool Publish(UltrasoundArena& arena, uint64_t value, std::chrono::milliseconds timeout = std::chrono::milliseconds(0))
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        size_t slot = 0;
+        while (!arena.TryClaimWrite(slot))
+        {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        std::memcpy(arena.GetPayload(slot), &value, sizeof(value));
+        arena.CommitWrite();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestAttachAndRead
+    void TestAttachAndRead(UltrasoundArena& arena, const std::wstring& name, uint64_t& published)
+    {
+        std::cout << "Attach and read\n";
+
+        // 붙기 전에 발행된 프레임은 재생하지 않음
+        for (int i = 0; i < 3; ++i) Publish(arena, published++);
+
+        SharedRingConsumer consumer(name);
+        const void* header = nullptr;
+        const void* payload = nullptr;
+        Check(!consumer.TryAcquire(header, payload), "late consumer starts at the current commit");
+        Check(consumer.GetPayloadSize() == kPayloadSize, "consumer sees the producer's payload size");
+        Check(consumer.IsProducerAlive(), "producer is reported alive");
+
+        // 링 한 바퀴 이상을 Zero-Copy로 읽기
+        size_t mismatches = 0;
+        const uint64_t first = published;
+        for (uint64_t i = 0; i < kRingSlots * 3; ++i)
+        {
+            Publish(arena, published++);
+            if (!consumer.TryAcquire(header, payload))
+            {
+                ++mismatches;
+                continue;
+            }
+
+            uint64_t value = 0;
+            std::memcpy(&value, payload, sizeof(value));
+            const auto* packet = static_cast<const PacketHeader*>(header);
+            if (value != first + i || packet->frameIndex != static_cast<uint32_t>(first + i)) ++mismatches;
+            consumer.Release();
+        }
+        Check(mismatches == 0, "frames arrive in order with matching header and payload");
+        Check(consumer.GetLag() == 0, "lag is zero after releasing everything");
+
+        // Back-pressure: 반납하지 않으면 링이 가득 찬 뒤 Producer가 막힘
+        size_t accepted = 0;
+        while (accepted <= kRingSlots && Publish(arena, published))
+        {
+            ++published;
+            ++accepted;
+        }
+        Check(accepted == kRingSlots, "producer stops after one ring of unreleased frames");
+        Check(consumer.GetLag() == kRingSlots, "consumer lag equals the ring size");
+
+        Check(consumer.TryAcquire(header, payload), "consumer can acquire the oldest frame");
+        consumer.Release();
+        Check(Publish(arena, published), "one release frees one slot for the producer");
+        ++published;
+
+        // 이벤트 대기: 다른 스레드가 늦게 발행한 프레임에서 깨어남
+        while (consumer.TryAcquire(header, payload)) consumer.Release();
+        Check(!consumer.WaitForFrame(0), "no frame is pending after draining");
+
+        std::thread late([&]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            Publish(arena, published);
+        });
+        const bool woke = consumer.WaitForFrame(5000);
+        late.join();
+        ++published;
+        Check(woke, "WaitForFrame wakes on a commit from another thread");
+        while (consumer.TryAcquire(header, payload)) consumer.Release();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestDetach
+    void TestDetach(UltrasoundArena& arena, const std::wstring& name, uint64_t& published)
+    {
+        std::cout << "Detach and slot exhaustion\n";
+        ControlView view(name);
+
+        {
+            SharedRingConsumer consumer(name);
+            Check(view.CountActive() == 1, "attached consumer occupies one slot");
+        }
+        Check(view.CountActive() == 0, "destroyed consumer returns its slot");
+
+        size_t accepted = 0;
+        while (accepted < kRingSlots * 2 && Publish(arena, published))
+        {
+            ++published;
+            ++accepted;
+        }
+        Check(accepted == kRingSlots * 2, "detached consumer no longer gates the producer");
+
+        std::vector<std::unique_ptr<SharedRingConsumer>> consumers;
+        for (size_t i = 0; i < kMaxSharedConsumers; ++i)
+        {
+            consumers.push_back(std::make_unique<SharedRingConsumer>(name));
+        }
+
+        bool threw = false;
+        try
+        {
+            SharedRingConsumer extra(name);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        Check(threw, "attaching beyond kMaxSharedConsumers throws");
+
+        consumers.pop_back();
+        bool attached = true;
+        try
+        {
+            SharedRingConsumer extra(name);
+        }
+        catch (const std::runtime_error&)
+        {
+            attached = false;
+        }
+        Check(attached, "a freed slot can be attached again");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestDeadConsumer
+    // 자식 프로세스가 붙은 뒤 자리를 반납하지 않고 종료합니다. Producer는 링이 막힌 동안 그 자리를 회수해야 합니다.
+    void TestDeadConsumer(UltrasoundArena& arena, const std::wstring& name, uint64_t& published)
+    {
+        std::cout << "Dead consumer recovery\n";
+        ControlView view(name);
+
+        wchar_t exe[MAX_PATH] = {};
+        if (!GetModuleFileNameW(nullptr, exe, MAX_PATH))
+        {
+            Check(false, "test executable path is available");
+            return;
+        }
+
+        std::wstring commandLine = L"\"" + std::wstring(exe) + L"\" " +
+                                   std::wstring(kChildFlag, kChildFlag + std::strlen(kChildFlag)) + L" " + name;
+        STARTUPINFOW startup{};
+        startup.cb = sizeof(startup);
+        PROCESS_INFORMATION process{};
+        if (!CreateProcessW(exe, &commandLine[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startup, &process))
+        {
+            Check(false, "consumer process starts");
+            return;
+        }
+
+        // 프로세스 핸들을 쥐고 있는 동안에는 PID가 재사용되지 않으므로 회수 판단이 다른 프로세스와 섞이지 않음
+        Check(WaitForSingleObject(process.hProcess, 10000) == WAIT_OBJECT_0, "consumer process exits");
+        SharedConsumerEntry* orphan = view.FindByPid(process.dwProcessId);
+        Check(orphan && orphan->active.load() == 1, "exited consumer still holds its slot");
+
+        // 죽은 소비자의 커서 때문에 한 바퀴 뒤 링이 막혔다가, 생존 확인 주기 안에 회수되어야 함
+        const auto start = std::chrono::steady_clock::now();
+        size_t accepted = 0;
+        while (accepted < kRingSlots * 3 && Publish(arena, published, std::chrono::milliseconds(2000)))
+        {
+            ++published;
+            ++accepted;
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        Check(accepted == kRingSlots * 3, "producer resumes past the dead consumer (" + std::to_string(elapsed.count()) + " ms)");
+        Check(!orphan || orphan->active.load() == 0, "dead consumer's slot is reclaimed");
+
+        CloseHandle(process.hThread);
+        CloseHandle(process.hProcess);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // TestStalledAttach
+    // 붙는 중(2) 상태로 멈춘 자리는 PID를 믿을 수 없으므로 kSharedAttachTimeoutMs 뒤에 회수되어야 합니다.
+    void TestStalledAttach(UltrasoundArena& arena, const std::wstring& name, uint64_t& published)
+    {
+        std::cout << "Stalled attach recovery\n";
+        ControlView view(name);
+
+        SharedConsumerEntry* stalled = nullptr;
+        const auto start = std::chrono::steady_clock::now();
+        for (SharedConsumerEntry& entry : view->consumers)
+        {
+            uint32_t expected = 0;
+            if (entry.active.compare_exchange_strong(expected, 2))
+            {
+                stalled = &entry;
+                break;
+            }
+        }
+        if (!stalled)
+        {
+            Check(false, "a free consumer slot is available");
+            return;
+        }
+
+        const auto deadline = start + std::chrono::milliseconds(kSharedAttachTimeoutMs * 3);
+        while (stalled->active.load() == 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            Publish(arena, published++);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        Check(stalled->active.load() == 0, "stalled slot is reclaimed (" + std::to_string(elapsed.count()) + " ms)");
+        Check(elapsed.count() >= static_cast<long long>(kSharedAttachTimeoutMs), "slot is not reclaimed before the attach timeout");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunDyingConsumer
+    // 자식 프로세스: 붙어서 프레임을 잡은 채로 소멸자 없이 종료 (비정상 종료 흉내)
+    int RunDyingConsumer(const std::wstring& name)
+    {
+        SharedRingConsumer consumer(name);
+        const void* header = nullptr;
+        const void* payload = nullptr;
+        consumer.TryAcquire(header, payload);
+        std::_Exit(0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 3 && std::strcmp(argv[1], kChildFlag) == 0)
+    {
+        return RunDyingConsumer(std::wstring(argv[2], argv[2] + std::strlen(argv[2])));
+    }
+
+    PrintTitle("Shared-Memory Ring Test");
+
+    const TempDirectory temp("adaptive_arena_shared_ring_test");
+    const std::filesystem::path& dir = temp.Path();
+    const std::wstring name = L"AdaptiveArenaSharedRingTest." + std::to_wstring(GetCurrentProcessId());
+
+    try
+    {
+        UltrasoundArena arena("shared_ring_key", dir / "shared_profile.bin", kHardLimit, false);
+        arena.InitializeSharedRing(name, sizeof(PacketHeader), kPayloadSize, kRingSlots);
+        Check(arena.IsSharedRing(), "arena exposes a shared ring");
+
+        bool threw = false;
+        try
+        {
+            UltrasoundArena duplicate("shared_ring_key", dir / "duplicate_profile.bin", kHardLimit, false);
+            duplicate.InitializeSharedRing(name, sizeof(PacketHeader), kPayloadSize, kRingSlots);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        Check(threw, "a second producer cannot take an existing segment name");
+
+        uint64_t published = 0;
+        TestAttachAndRead(arena, name, published);
+        TestDetach(arena, name, published);
+        TestDeadConsumer(arena, name, published);
+        TestStalledAttach(arena, name, published);
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
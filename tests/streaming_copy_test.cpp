@@ -0,0 +1,140 @@
+#define NOMINMAX
+#include "../src/UltrasoundArena.h"
+#include "../src/StreamingCopy.h"
+#include "test_support.h"
+#include <cstring>
+#include <emmintrin.h>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr size_t kMB = 1024 * 1024;
+    constexpr size_t kGuardBytes = 4096;
+    constexpr uint8_t kGuard = 0xCD;
+    constexpr uint32_t kSeed = 0x5EED1234u;
+    constexpr size_t kHardLimit = 256ull * 1024 * 1024;
+
+    // 결정적 바이트 패턴 (xorshift)
+    void Fill(uint8_t* data, size_t length, uint64_t seed)
+    {
+        uint64_t state = 0x9E3779B97F4A7C15ull * (seed + 1);
+        for (size_t i = 0; i < length; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            data[i] = static_cast<uint8_t>(state);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunCopy
+    // 보조 스레드 수와 길이 조합마다 목적지가 원본과 바이트 단위로 같고, 끝 뒤의 바이트는 건드리지 않으며,
+    // 조각별로 결합한 체크섬이 한 번에 계산한 체크섬과 같아야 합니다.
+    void RunCopy(size_t helpers, size_t length)
+    {
+        std::vector<uint8_t> src(length);
+        Fill(src.data(), src.size(), length);
+
+        // 출력 버퍼는 4KB 정렬된 슬롯처럼 보이도록 정렬된 위치에서 시작
+        std::vector<uint8_t> storage(length + kGuardBytes + 4096, kGuard);
+        const size_t skew = (4096 - (reinterpret_cast<uintptr_t>(storage.data()) & 4095)) & 4095;
+        uint8_t* dst = storage.data() + skew;
+
+        StreamingCopier copier(helpers);
+        PayloadChecksum fused(kSeed);
+        copier.Copy(dst, src.data(), length, &fused);
+        _mm_sfence();
+
+        PayloadChecksum reference(kSeed);
+        reference.Update(src.data(), length);
+
+        bool guardIntact = true;
+        for (size_t i = 0; i < kGuardBytes; ++i)
+        {
+            if (dst[length + i] != kGuard) guardIntact = false;
+        }
+
+        const std::string label = std::to_string(helpers) + " helpers, " + std::to_string(length) + " bytes";
+        Check(std::memcmp(dst, src.data(), length) == 0, label + ": destination matches source byte for byte");
+        Check(fused.Finalize() == reference.Finalize(), label + ": fused checksum matches a single-pass checksum");
+        Check(guardIntact, label + ": bytes past the end are untouched");
+
+        // 체크섬 없이 복사해도 같은 결과
+        std::memset(dst, 0, length);
+        copier.Copy(dst, src.data(), length, nullptr);
+        _mm_sfence();
+        Check(std::memcmp(dst, src.data(), length) == 0, label + ": copy without checksum matches source");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunArenaVerify
+    // 보조 스레드를 켠 아레나에 홀수 크기 프레임을 쓰면, 복사 중 계산한 체크섬이 VerifyPayload의 전체 재계산과 일치해야 합니다.
+    void RunArenaVerify(const std::filesystem::path& dir)
+    {
+        std::cout << "Arena WritePayload / VerifyPayload (2MB + 1, 1 helper)\n";
+
+        const size_t payloadSize = 2 * kMB + 1;
+        UltrasoundArena arena("streaming_copy_key", dir / "streaming_profile.bin", kHardLimit, false);
+        arena.SetIntegrityCheck(true);
+        arena.SetStreamingHelpers(1);
+        arena.InitializeRing(sizeof(PacketHeader), payloadSize, 4);
+
+        std::vector<uint8_t> frame(payloadSize);
+        Fill(frame.data(), frame.size(), 7);
+
+        size_t slot = 0;
+        if (!arena.TryClaimWrite(slot))
+        {
+            Check(false, "claim a slot");
+            return;
+        }
+        arena.WritePayload(slot, frame.data(), frame.size());
+        arena.CommitWrite();
+
+        const auto* payload = static_cast<const uint8_t*>(arena.GetPayload(slot));
+        Check(std::memcmp(payload, frame.data(), frame.size()) == 0, "slot payload matches the frame, including the last byte");
+        Check(arena.VerifyPayload(slot), "intact frame passes verification");
+
+        static_cast<uint8_t*>(arena.GetPayload(slot))[payloadSize - 1] ^= 0x01;
+        Check(!arena.VerifyPayload(slot), "flipping the last byte fails verification");
+        Check(arena.GetIntegrityFailures() == 1, "exactly one integrity failure is counted");
+    }
+}
+
+int main()
+{
+    PrintTitle("Streaming Copy Test");
+
+    const TempDirectory temp("adaptive_arena_streaming_copy_test");
+
+    try
+    {
+        // 분할 경계 근처의 길이: 4KB 배수, 몫이 4KB 배수인데 나머지가 남는 경우, 마지막 조각이 비는 경우
+        const size_t lengths[] = { 2 * kMB, 2 * kMB + 1, 2 * kMB + 4095, 3 * kMB + 2, 4 * kMB - 1, 1 * kMB + 8192 + 3 };
+        const size_t helperCounts[] = { 0, 1, 2, 3 };
+
+        std::cout << "StreamingCopier::Copy\n";
+        for (size_t helpers : helperCounts)
+        {
+            for (size_t length : lengths)
+            {
+                RunCopy(helpers, length);
+            }
+        }
+
+        RunArenaVerify(temp.Path());
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
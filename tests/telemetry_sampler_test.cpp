@@ -0,0 +1,250 @@
+#define NOMINMAX
+#include "../src/Seqlock.h"
+#include "../src/TelemetrySampler.h"
+#include "test_support.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr auto kRunTime = std::chrono::milliseconds(300);
+    constexpr size_t kReaders = 3;
+
+    // 여러 워드에 걸친 값: 모든 워드가 같아야 찢어지지 않은 사본
+    struct WideValue
+    {
+        uint64_t words[64];
+    };
+
+    bool IsWhole(const WideValue& value)
+    {
+        for (uint64_t word : value.words)
+        {
+            if (word != value.words[0]) return false;
+        }
+        return true;
+    }
+
+    // 샘플마다 모든 필드를 같은 번호로 채우는 수집 대상
+    class StampedSource : public Resource
+    {
+    public:
+        void ResetLearning() override {}
+        void SaveStatistics() override {}
+        size_t GetCurrentUsage() const override { return 0; }
+        size_t GetPeakUsage() const override { return 0; }
+        size_t GetPredictedSize() const override { return 0; }
+        double GetLastAllocationLatencyNS() const override { return 0.0; }
+
+        void CaptureTelemetry(TelemetrySnapshot& out) const override
+        {
+            const uint64_t stamp = m_captures.fetch_add(1) + 1;
+            out.currentUsage = stamp;
+            out.peakUsage = stamp;
+            out.ringSlots = stamp;
+            out.stageCount = kMaxTelemetryStages;
+            for (StageTelemetry& stage : out.stages)
+            {
+                stage.lag = stamp;
+            }
+        }
+
+    private:
+        void* do_allocate(size_t, size_t) override { throw std::bad_alloc(); }
+        void do_deallocate(void*, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        mutable std::atomic<uint64_t> m_captures{0};
+    };
+
+    // 샘플 번호와 수집 번호가 모든 필드에서 일치해야 한 번의 수집에서 나온 사본
+    bool IsConsistent(const TelemetrySnapshot& snapshot)
+    {
+        if (snapshot.currentUsage != snapshot.sequence || snapshot.peakUsage != snapshot.sequence || snapshot.ringSlots != snapshot.sequence) return false;
+        for (const StageTelemetry& stage : snapshot.stages)
+        {
+            if (stage.lag != snapshot.sequence) return false;
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunSeqlockCell
+    // Writer가 쉬지 않고 게시하는 동안 Reader가 얻은 사본은 항상 한 번의 Store에서 나온 값이어야 하며, 거꾸로 가지 않아야 합니다.
+    void RunSeqlockCell()
+    {
+        std::cout << "SeqlockCell under a busy writer (" << kReaders << " readers)\n";
+
+        SeqlockCell<WideValue> cell;
+        Check(IsWhole(cell.Load()) && cell.Load().words[0] == 0, "an unpublished cell loads a zero value");
+
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> torn{0};
+        std::atomic<size_t> backwards{0};
+        std::atomic<size_t> loads{0};
+        std::atomic<size_t> rejected{0};
+
+        std::vector<std::thread> readers;
+        for (size_t r = 0; r < kReaders; ++r)
+        {
+            readers.emplace_back([&]()
+            {
+                uint64_t last = 0;
+                WideValue value;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    if (!cell.TryLoad(value))
+                    {
+                        rejected.fetch_add(1, std::memory_order_relaxed);
+                        value = cell.Load();
+                    }
+                    if (!IsWhole(value)) torn.fetch_add(1, std::memory_order_relaxed);
+                    if (value.words[0] < last) backwards.fetch_add(1, std::memory_order_relaxed);
+                    last = value.words[0];
+                    loads.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        uint64_t stores = 0;
+        const auto until = std::chrono::steady_clock::now() + kRunTime;
+        while (std::chrono::steady_clock::now() < until)
+        {
+            WideValue value;
+            ++stores;
+            for (uint64_t& word : value.words)
+            {
+                word = stores;
+            }
+            cell.Store(value);
+        }
+        stop.store(true);
+        for (std::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        std::cout << "  (" << stores << " stores, " << loads.load() << " loads, " << rejected.load() << " retried)\n";
+        Check(loads.load() > 0, "readers made progress against the writer");
+        Check(torn.load() == 0, "no reader saw a torn value (" + std::to_string(torn.load()) + ")");
+        Check(backwards.load() == 0, "no reader saw an older value after a newer one");
+        Check(cell.Load().words[0] == stores, "the last store is visible once the writer stops");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunSampler
+    // 샘플러가 게시하는 최신 사본과 이력은 관측자가 동시에 읽어도 한 번의 수집에서 나온 값이어야 하고,
+    // 이력은 번호 순서대로, 빠짐없이(링에 남아 있는 범위 안에서) 이어져야 합니다.
+    void RunSampler()
+    {
+        std::cout << "TelemetrySampler latest copy and history\n";
+
+        constexpr size_t kHistory = 16;
+        StampedSource source;
+        TelemetrySampler sampler(source, kHistory);
+
+        std::vector<TelemetrySnapshot> history;
+        Check(sampler.GetLatest().sequence == 0, "no sample before Start");
+        Check(sampler.ReadHistory(0, history) == 0, "history is empty before Start");
+
+        sampler.Start(1000.0);
+        Check(sampler.GetRate() == 1000.0, "rate is reported while running");
+
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> inconsistent{0};
+        std::atomic<size_t> backwards{0};
+        std::atomic<size_t> outOfOrder{0};
+        std::atomic<size_t> historyRead{0};
+
+        std::vector<std::thread> observers;
+        for (size_t r = 0; r < kReaders; ++r)
+        {
+            observers.emplace_back([&]()
+            {
+                uint64_t last = 0;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    const TelemetrySnapshot snapshot = sampler.GetLatest();
+                    if (!IsConsistent(snapshot)) inconsistent.fetch_add(1, std::memory_order_relaxed);
+                    if (snapshot.sequence < last) backwards.fetch_add(1, std::memory_order_relaxed);
+                    last = snapshot.sequence;
+                }
+            });
+        }
+
+        // 이력을 따라가는 관측자: 마지막으로 받은 번호 이후만 요청
+        observers.emplace_back([&]()
+        {
+            uint64_t after = 0;
+            std::vector<TelemetrySnapshot> batch;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                batch.clear();
+                sampler.ReadHistory(after, batch);
+                for (const TelemetrySnapshot& snapshot : batch)
+                {
+                    if (!IsConsistent(snapshot)) inconsistent.fetch_add(1, std::memory_order_relaxed);
+                    if (snapshot.sequence <= after) outOfOrder.fetch_add(1, std::memory_order_relaxed);
+                    after = snapshot.sequence;
+                    historyRead.fetch_add(1, std::memory_order_relaxed);
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+
+        std::this_thread::sleep_for(kRunTime);
+        stop.store(true);
+        for (std::thread& observer : observers)
+        {
+            observer.join();
+        }
+        sampler.Stop();
+
+        const uint64_t samples = sampler.GetSampleCount();
+        std::cout << "  (" << samples << " samples, " << historyRead.load() << " read from history)\n";
+        Check(samples > kHistory, "sampler published more samples than the history holds");
+        Check(inconsistent.load() == 0, "every copy comes from a single capture (" + std::to_string(inconsistent.load()) + " mixed)");
+        Check(backwards.load() == 0, "the latest copy never goes backwards");
+        Check(outOfOrder.load() == 0 && historyRead.load() > 0, "history is read in sequence order");
+        Check(sampler.GetRate() == 0.0, "rate drops to zero after Stop");
+
+        const TelemetrySnapshot latest = sampler.GetLatest();
+        Check(latest.sequence == samples && IsConsistent(latest), "the last sample stays published after Stop");
+
+        history.clear();
+        const size_t read = sampler.ReadHistory(0, history);
+        bool contiguous = read == kHistory && history.size() == kHistory;
+        for (size_t i = 0; contiguous && i < history.size(); ++i)
+        {
+            contiguous = history[i].sequence == samples - kHistory + 1 + i;
+        }
+        Check(contiguous, "history keeps the last " + std::to_string(kHistory) + " samples in order");
+
+        history.clear();
+        Check(sampler.ReadHistory(samples, history) == 0, "nothing is returned after the last sequence");
+    }
+}
+
+int main()
+{
+    PrintTitle("Seqlock Telemetry Test");
+
+    try
+    {
+        RunSeqlockCell();
+        RunSampler();
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
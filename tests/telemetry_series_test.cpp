@@ -0,0 +1,201 @@
+#define NOMINMAX
+#include "../src/TelemetryTimeSeries.h"
+#include "test_support.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace AdaptiveArena;
+    using namespace AdaptiveArena::TestSupport;
+
+    constexpr uint64_t kSecondNs = 1000000000ull;
+    constexpr uint64_t kStartNs = 3600 * kSecondNs;          // 1분 경계에 맞춘 시작 시각
+    constexpr uint64_t kStepNs = kSecondNs / 20;              // 20 Hz 샘플러
+    constexpr size_t kSamples = 10 * 60 * 20;                 // 10분 (원본 단계 4096개를 넘김)
+    constexpr size_t kSpikeIndex = 5 * 60 * 20 + 7;           // 가운데 구간의 한 샘플에만 튀는 값
+    constexpr double kSpike = 1000.0;
+
+    constexpr uint64_t TimeOf(size_t index) { return kStartNs + index * kStepNs; }
+    constexpr uint64_t kEndNs = TimeOf(kSamples - 1);
+
+    // 사용량은 샘플 번호를 따라 증가하는 경사, 링 지연은 한 샘플에서만 스파이크
+    void Fill(TelemetryTimeSeries& series)
+    {
+        for (size_t i = 0; i < kSamples; ++i)
+        {
+            TelemetrySnapshot snapshot;
+            snapshot.sequence = i + 1;
+            snapshot.timestampNs = TimeOf(i);
+            snapshot.currentUsage = i;
+            snapshot.ringLag = (i == kSpikeIndex) ? static_cast<uint64_t>(kSpike) : 0;
+            series.Append(snapshot);
+        }
+    }
+
+    bool Ascending(const std::vector<SeriesPoint>& points)
+    {
+        for (size_t i = 1; i < points.size(); ++i)
+        {
+            if (points[i].timestampNs <= points[i - 1].timestampNs) return false;
+        }
+        return true;
+    }
+
+    uint64_t TotalSamples(const std::vector<SeriesPoint>& points)
+    {
+        uint64_t total = 0;
+        for (const SeriesPoint& point : points)
+        {
+            total += point.samples;
+        }
+        return total;
+    }
+
+    // 점들이 덮는 샘플 수로 구간 폭을 추정 (20 Hz에서 1초 = 20샘플)
+    uint64_t TypicalSamples(const std::vector<SeriesPoint>& points)
+    {
+        return points.size() > 2 ? points[points.size() / 2].samples : 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunTierSelection
+    // 최근 짧은 구간은 원본, 원본이 이미 덮어쓴 과거와 긴 구간은 거친 단계에서 나와야 하며, 어떤 경우든 maxPoints를 넘지 않아야 합니다.
+    void RunTierSelection(const TelemetryTimeSeries& series)
+    {
+        std::cout << "Tier selection\n";
+
+        std::vector<SeriesPoint> points;
+        series.Query(TelemetrySeries::UsageBytes, kEndNs - 10 * kSecondNs, kEndNs, 1000, points);
+        bool raw = points.size() == 201 && Ascending(points);
+        for (const SeriesPoint& point : points)
+        {
+            raw = raw && point.samples == 1 && point.min == point.max && point.mean == point.max;
+        }
+        Check(raw, "the last 10 seconds come from raw samples (" + std::to_string(points.size()) + " points)");
+
+        points.clear();
+        series.Query(TelemetrySeries::UsageBytes, kStartNs, kStartNs + 10 * kSecondNs, 1000, points);
+        Check(points.size() >= 10 && points.size() <= 11 && TypicalSamples(points) == 20,
+              "samples older than the raw ring come from 1-second buckets (" + std::to_string(points.size()) + " points)");
+
+        points.clear();
+        series.Query(TelemetrySeries::UsageBytes, kStartNs, kEndNs, 1000, points);
+        Check(points.size() >= 600 && points.size() <= 601 && TypicalSamples(points) == 20 && Ascending(points),
+              "10 minutes within 1000 points use 1-second buckets (" + std::to_string(points.size()) + " points)");
+        Check(TotalSamples(points) == kSamples, "every sample is counted once");
+
+        points.clear();
+        series.Query(TelemetrySeries::UsageBytes, kStartNs, kEndNs, 100, points);
+        Check(points.size() <= 100 && TypicalSamples(points) == 200,
+              "10 minutes within 100 points use 10-second buckets (" + std::to_string(points.size()) + " points)");
+
+        points.clear();
+        series.Query(TelemetrySeries::UsageBytes, kStartNs, kEndNs, 20, points);
+        Check(points.size() <= 20 && TypicalSamples(points) == 1200,
+              "10 minutes within 20 points use 1-minute buckets (" + std::to_string(points.size()) + " points)");
+
+        points.clear();
+        series.Query(TelemetrySeries::UsageBytes, kStartNs, kEndNs, 4, points);
+        Check(points.size() <= 4 && points.size() > 0 && TotalSamples(points) == kSamples,
+              "fewer points than the coarsest tier merges adjacent buckets (" + std::to_string(points.size()) + " points)");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunAggregates
+    // 거친 구간에서도 짧은 스파이크는 max로 남아야 하고, mean은 샘플 수로 가중되어야 합니다.
+    void RunAggregates(const TelemetryTimeSeries& series)
+    {
+        std::cout << "Aggregates keep spikes\n";
+
+        for (size_t maxPoints : { 1000, 100, 20, 4, 1 })
+        {
+            std::vector<SeriesPoint> points;
+            series.Query(TelemetrySeries::RingLag, kStartNs, kEndNs, maxPoints, points);
+
+            double peak = 0.0;
+            double floor = kSpike;
+            for (const SeriesPoint& point : points)
+            {
+                peak = std::max(peak, point.max);
+                floor = std::min(floor, point.min);
+            }
+            Check(peak == kSpike && floor == 0.0, "a one-sample spike survives at " + std::to_string(points.size()) + " points");
+        }
+
+        // 전체 구간을 한 점으로 합치면 mean은 0 ~ kSamples-1 경사의 평균
+        std::vector<SeriesPoint> points;
+        series.Query(TelemetrySeries::UsageBytes, kStartNs, kEndNs, 1, points);
+        const double expected = (kSamples - 1) / 2.0;
+        Check(points.size() == 1 && points[0].min == 0.0 && points[0].max == kSamples - 1 && std::abs(points[0].mean - expected) < 1e-6,
+              "a single point spans the whole range with a sample-weighted mean");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunEdges
+    // 잘못된 요청과 데이터가 없는 구간은 아무 점도 추가하지 않아야 합니다 (out의 기존 내용은 유지).
+    void RunEdges(const TelemetryTimeSeries& series)
+    {
+        std::cout << "Empty and invalid queries\n";
+
+        std::vector<SeriesPoint> points(3);
+        Check(series.Query(TelemetrySeries::UsageBytes, kStartNs, kEndNs, 0, points) == 0, "maxPoints of 0 returns nothing");
+        Check(series.Query(TelemetrySeries::UsageBytes, kEndNs, kStartNs, 10, points) == 0, "a reversed range returns nothing");
+        Check(series.Query(TelemetrySeries::Count, kStartNs, kEndNs, 10, points) == 0, "an unknown series returns nothing");
+        Check(series.Query(TelemetrySeries::UsageBytes, 0, kStartNs - 120 * kSecondNs, 10, points) == 0, "a range before the first sample returns nothing");
+        Check(points.size() == 3, "existing output is left untouched");
+
+        TelemetryTimeSeries empty;
+        Check(empty.Query(TelemetrySeries::UsageBytes, 0, ~0ull, 10, points) == 0, "an empty series returns nothing");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RunSeriesNames
+    // 모든 시리즈 이름은 서로 다르고 FindSeries로 되돌릴 수 있어야 합니다.
+    void RunSeriesNames()
+    {
+        std::cout << "Series names\n";
+
+        bool roundTrip = true;
+        for (size_t s = 0; s < TelemetryTimeSeries::kSeriesCount; ++s)
+        {
+            const auto series = static_cast<TelemetrySeries>(s);
+            const char* name = TelemetryTimeSeries::GetSeriesName(series);
+
+            TelemetrySeries found = TelemetrySeries::Count;
+            roundTrip = roundTrip && name[0] != '\0' && TelemetryTimeSeries::FindSeries(name, found) && found == series;
+        }
+        Check(roundTrip, "every series name maps back to its series");
+
+        TelemetrySeries found = TelemetrySeries::UsageBytes;
+        Check(std::strcmp(TelemetryTimeSeries::GetSeriesName(TelemetrySeries::RingLag), "ring_lag") == 0, "ring lag is exported as ring_lag");
+        Check(!TelemetryTimeSeries::FindSeries("no_such_series", found) && found == TelemetrySeries::UsageBytes, "an unknown name is rejected");
+        Check(TelemetryTimeSeries::GetSeriesName(TelemetrySeries::Count)[0] == '\0', "an out-of-range series has an empty name");
+    }
+}
+
+int main()
+{
+    PrintTitle("Telemetry Time Series Test");
+
+    try
+    {
+        TelemetryTimeSeries series;
+        Fill(series);
+
+        RunTierSelection(series);
+        RunAggregates(series);
+        RunEdges(series);
+        RunSeriesNames();
+    }
+    catch (const std::exception& e)
+    {
+        Unexpected(e);
+    }
+
+    return Summarize();
+}
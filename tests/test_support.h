@@ -0,0 +1,84 @@
+#pragma once
+
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+// 동작 테스트 공용 도우미: 검사 결과 출력/집계와 테스트별 임시 디렉터리
+namespace AdaptiveArena
+{
+namespace TestSupport
+{
+    inline int& Failures()
+    {
+        static int failures = 0;
+        return failures;
+    }
+
+    /**
+     * @brief  검사 결과를 한 줄로 출력하고 실패를 집계합니다.
+     */
+    inline void Check(bool condition, const std::string& what)
+    {
+        std::cout << (condition ? "  [PASS] " : "  [FAIL] ") << what << "\n";
+        if (!condition) ++Failures();
+    }
+
+    /**
+     * @brief  테스트 본문 밖으로 빠져나온 예외를 실패로 기록합니다.
+     */
+    inline void Unexpected(const std::exception& e)
+    {
+        std::cout << "  [FAIL] unexpected exception: " << e.what() << "\n";
+        ++Failures();
+    }
+
+    inline void PrintTitle(const std::string& title)
+    {
+        std::cout << "================================================\n";
+        std::cout << "   " << title << " \n";
+        std::cout << "================================================\n";
+    }
+
+    /**
+     * @brief  결과 요약을 출력합니다.
+     * @return int  프로세스 종료 코드 (모두 통과하면 0)
+     */
+    inline int Summarize()
+    {
+        std::cout << "\n" << (Failures() == 0 ? "ALL PASSED" : "FAILED: " + std::to_string(Failures())) << "\n";
+        return Failures() == 0 ? 0 : 1;
+    }
+
+    /**
+     * @brief  임시 경로 아래의 빈 디렉터리를 만들고 소멸 시 지웁니다.
+     */
+    class TempDirectory
+    {
+    public:
+        explicit TempDirectory(const std::string& name)
+            : m_path(std::filesystem::temp_directory_path() / name)
+        {
+            std::filesystem::remove_all(m_path);
+            std::filesystem::create_directories(m_path);
+        }
+
+        ~TempDirectory()
+        {
+            std::error_code ignored;
+            std::filesystem::remove_all(m_path, ignored);
+        }
+
+        TempDirectory(const TempDirectory&) = delete;
+        TempDirectory& operator=(const TempDirectory&) = delete;
+
+        const std::filesystem::path& Path() const { return m_path; }
+        std::filesystem::path operator/(const std::string& name) const { return m_path / name; }
+
+    private:
+        std::filesystem::path m_path;
+    };
+
+} // namespace TestSupport
+} // namespace AdaptiveArena
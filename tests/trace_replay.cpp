@@ -0,0 +1,391 @@
+#define NOMINMAX
+#include "AdaptiveArena.h"
+#include "../src/AllocationTrace.h"
+#include "../src/LatencyHistogram.h"
+#include <windows.h>
+#include <psapi.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Replay Plan
+    // 추적의 주소를 "슬롯"으로 바꾼 스레드별 연산 목록. 해제는 자신이 짝지어진 할당의 슬롯이 채워질 때까지 기다리므로
+    // 기록 당시의 스레드 간 순서(할당 → 다른 스레드의 해제)가 재생에서도 유지됩니다.
+
+    struct ReplayOp
+    {
+        uint32_t slot;
+        uint32_t size;
+        uint32_t alignment;
+        bool isFree;
+    };
+
+    struct ReplayPlan
+    {
+        std::vector<std::vector<ReplayOp>> threads;
+        size_t slotCount = 0;
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t unmatchedFrees = 0;     // 추적 시작 전 할당이거나 누락된 청크의 할당
+        uint64_t peakLiveBytes = 0;      // 시퀀스 순서로 계산한 요청 바이트 기준 최대 미해제량
+    };
+
+    struct ReplayResult
+    {
+        std::string name;
+        double seconds = 0.0;            // 스레드별 할당/해제 호출 안에 있던 시간의 합
+        double waitSeconds = 0.0;        // 해제가 다른 스레드의 할당을 기다린 시간의 합 (처리량에 포함하지 않음)
+        double opsPerSec = 0.0;          // 스레드별 (연산 수 / 호출 시간)의 합
+        double p50Ns = 0.0;
+        double p99Ns = 0.0;
+        double p999Ns = 0.0;
+        double maxNs = 0.0;
+        uint64_t peakRssBytes = 0;       // 재생 직전 대비 Working Set 증가분의 최대값
+        double fragmentation = 0.0;      // 1 - 최대 미해제 바이트 / 최대 RSS 증가분
+        uint64_t failures = 0;
+    };
+
+    void* const kFailedSlot = reinterpret_cast<void*>(uintptr_t(1));
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // BuildPlan
+    ReplayPlan BuildPlan(const std::vector<AdaptiveArena::AllocationTraceReader::Thread>& threads)
+    {
+        struct Ref
+        {
+            uint64_t sequence;
+            uint32_t thread;
+            uint32_t index;
+        };
+
+        std::vector<Ref> order;
+        for (uint32_t t = 0; t < threads.size(); ++t)
+        {
+            for (uint32_t i = 0; i < threads[t].events.size(); ++i)
+            {
+                order.push_back({ threads[t].events[i].GetSequence(), t, i });
+            }
+        }
+        std::sort(order.begin(), order.end(), [](const Ref& a, const Ref& b) { return a.sequence < b.sequence; });
+
+        ReplayPlan plan;
+        std::vector<std::vector<ReplayOp>> placed(threads.size());
+        std::vector<std::vector<bool>> keep(threads.size());
+        for (size_t t = 0; t < threads.size(); ++t)
+        {
+            placed[t].resize(threads[t].events.size());
+            keep[t].resize(threads[t].events.size(), false);
+        }
+
+        // 시퀀스 순서로 주소 → 현재 할당 슬롯을 추적 (같은 주소의 재사용은 새 슬롯)
+        std::unordered_map<uint64_t, ReplayOp> live;
+        uint64_t liveBytes = 0;
+        for (const Ref& ref : order)
+        {
+            const AdaptiveArena::TraceEvent& event = threads[ref.thread].events[ref.index];
+            if (!event.IsFree())
+            {
+                ReplayOp op{ static_cast<uint32_t>(plan.slotCount++), event.size, static_cast<uint32_t>(event.GetAlignment()), false };
+                auto previous = live.find(event.address);
+                if (previous != live.end()) liveBytes -= previous->second.size;   // 해제 이벤트가 누락된 블록
+                live[event.address] = op;
+                liveBytes += event.size;
+                plan.peakLiveBytes = std::max(plan.peakLiveBytes, liveBytes);
+                placed[ref.thread][ref.index] = op;
+                keep[ref.thread][ref.index] = true;
+                plan.allocations++;
+            }
+            else
+            {
+                auto it = live.find(event.address);
+                if (it == live.end())
+                {
+                    plan.unmatchedFrees++;
+                    continue;
+                }
+                ReplayOp op = it->second;
+                op.isFree = true;
+                liveBytes -= op.size;
+                live.erase(it);
+                placed[ref.thread][ref.index] = op;
+                keep[ref.thread][ref.index] = true;
+                plan.frees++;
+            }
+        }
+
+        for (size_t t = 0; t < threads.size(); ++t)
+        {
+            std::vector<ReplayOp> ops;
+            for (size_t i = 0; i < placed[t].size(); ++i)
+            {
+                if (keep[t][i]) ops.push_back(placed[t][i]);
+            }
+            if (!ops.empty()) plan.threads.push_back(std::move(ops));
+        }
+        return plan;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // LockedResource
+    // unsynchronized_pool_resource를 여러 스레드에서 쓰기 위한 단일 잠금 래퍼 (스레드 간 해제가 있으므로 스레드별 풀은 불가)
+    class LockedResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit LockedResource(std::pmr::memory_resource& inner) : m_inner(inner) {}
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_inner.allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inner.deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        std::mutex m_mutex;
+        std::pmr::memory_resource& m_inner;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // WorkingSetBytes
+    uint64_t WorkingSetBytes()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        counters.cb = sizeof(counters);
+        return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.WorkingSetSize : 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Replay
+    ReplayResult Replay(const ReplayPlan& plan, std::pmr::memory_resource& resource, const std::string& name, int repeat)
+    {
+        ReplayResult result;
+        result.name = name;
+
+        std::unique_ptr<std::atomic<void*>[]> slots(new std::atomic<void*>[plan.slotCount]);
+        std::vector<uint8_t> freed(plan.slotCount);
+        std::vector<std::vector<uint32_t>> latencies(plan.threads.size());
+        std::vector<uint64_t> busyNs(plan.threads.size(), 0);
+        std::vector<uint64_t> waitNs(plan.threads.size(), 0);
+        std::atomic<uint64_t> failures{ 0 };
+
+        // RSS 감시 (1ms 간격 Working Set 최대값)
+        const uint64_t baseline = WorkingSetBytes();
+        std::atomic<bool> monitoring{ true };
+        std::atomic<uint64_t> peakRss{ baseline };
+        std::thread monitor([&]()
+        {
+            while (monitoring.load(std::memory_order_relaxed))
+            {
+                peakRss.store(std::max(peakRss.load(std::memory_order_relaxed), WorkingSetBytes()), std::memory_order_relaxed);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+
+        for (int pass = 0; pass < repeat; ++pass)
+        {
+            for (size_t s = 0; s < plan.slotCount; ++s) slots[s].store(nullptr, std::memory_order_relaxed);
+            std::fill(freed.begin(), freed.end(), 0);
+
+            std::atomic<size_t> ready{ 0 };
+            std::atomic<bool> go{ false };
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < plan.threads.size(); ++t)
+            {
+                workers.emplace_back([&, t]()
+                {
+                    const std::vector<ReplayOp>& ops = plan.threads[t];
+                    std::vector<uint32_t>& samples = latencies[t];
+                    samples.reserve(samples.size() + ops.size());
+
+                    ready.fetch_add(1);
+                    while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+                    for (const ReplayOp& op : ops)
+                    {
+                        if (op.isFree)
+                        {
+                            // 다른 스레드의 할당이 아직 재생되지 않았으면 대기 (대기 시간은 지연/처리량에 포함하지 않고 따로 집계)
+                            void* p = slots[op.slot].load(std::memory_order_acquire);
+                            if (p == nullptr)
+                            {
+                                const uint64_t waitStart = AdaptiveArena::TscClock::NowNs();
+                                while ((p = slots[op.slot].load(std::memory_order_acquire)) == nullptr) std::this_thread::yield();
+                                waitNs[t] += AdaptiveArena::TscClock::NowNs() - waitStart;
+                            }
+                            freed[op.slot] = 1;
+                            if (p == kFailedSlot) continue;
+
+                            const uint64_t start = AdaptiveArena::TscClock::NowNs();
+                            resource.deallocate(p, op.size, op.alignment);
+                            const uint64_t elapsed = AdaptiveArena::TscClock::NowNs() - start;
+                            busyNs[t] += elapsed;
+                            samples.push_back(static_cast<uint32_t>(std::min<uint64_t>(elapsed, UINT32_MAX)));
+                        }
+                        else
+                        {
+                            void* p = nullptr;
+                            const uint64_t start = AdaptiveArena::TscClock::NowNs();
+                            try
+                            {
+                                p = resource.allocate(op.size, op.alignment);
+                            }
+                            catch (const std::bad_alloc&)
+                            {
+                                failures.fetch_add(1, std::memory_order_relaxed);
+                                slots[op.slot].store(kFailedSlot, std::memory_order_release);
+                                continue;
+                            }
+                            const uint64_t elapsed = AdaptiveArena::TscClock::NowNs() - start;
+                            busyNs[t] += elapsed;
+                            samples.push_back(static_cast<uint32_t>(std::min<uint64_t>(elapsed, UINT32_MAX)));
+
+                            // 실제 프로그램처럼 페이지를 건드려 RSS에 반영 (측정 구간 밖)
+                            for (size_t offset = 0; offset < op.size; offset += 4096) static_cast<volatile char*>(p)[offset] = 1;
+                            slots[op.slot].store(p, std::memory_order_release);
+                        }
+                    }
+                });
+            }
+
+            while (ready.load() < workers.size()) std::this_thread::yield();
+            go.store(true, std::memory_order_release);
+            for (auto& worker : workers) worker.join();
+
+            // 추적이 끝날 때까지 해제되지 않은 블록 정리 (측정 밖, 다음 반복이 같은 상태에서 시작하도록)
+            for (size_t t = 0; t < plan.threads.size(); ++t)
+            {
+                for (const ReplayOp& op : plan.threads[t])
+                {
+                    void* p = slots[op.slot].load(std::memory_order_relaxed);
+                    if (!op.isFree && !freed[op.slot] && p != kFailedSlot) resource.deallocate(p, op.size, op.alignment);
+                }
+            }
+        }
+
+        monitoring.store(false);
+        monitor.join();
+
+        // 처리량: 스레드마다 자신이 재생한 연산 수를 할당기 호출 안에 있던 시간으로 나누어 합산
+        //        (페이지 터치와 다른 스레드를 기다린 시간은 제외, 스레드들은 동시에 실행되므로 합이 전체 처리량)
+        for (size_t t = 0; t < plan.threads.size(); ++t)
+        {
+            result.seconds += static_cast<double>(busyNs[t]) * 1e-9;
+            result.waitSeconds += static_cast<double>(waitNs[t]) * 1e-9;
+            if (busyNs[t] > 0) result.opsPerSec += static_cast<double>(latencies[t].size()) / (static_cast<double>(busyNs[t]) * 1e-9);
+        }
+
+        std::vector<uint32_t> all;
+        for (auto& samples : latencies) all.insert(all.end(), samples.begin(), samples.end());
+        if (!all.empty())
+        {
+            auto percentile = [&](double q)
+            {
+                const size_t rank = std::min(all.size() - 1, static_cast<size_t>(q * static_cast<double>(all.size())));
+                std::nth_element(all.begin(), all.begin() + rank, all.end());
+                return static_cast<double>(all[rank]);
+            };
+            result.p50Ns = percentile(0.50);
+            result.p99Ns = percentile(0.99);
+            result.p999Ns = percentile(0.999);
+            result.maxNs = static_cast<double>(*std::max_element(all.begin(), all.end()));
+        }
+
+        result.peakRssBytes = peakRss.load() > baseline ? peakRss.load() - baseline : 0;
+        result.fragmentation = result.peakRssBytes > plan.peakLiveBytes
+                             ? 1.0 - static_cast<double>(plan.peakLiveBytes) / static_cast<double>(result.peakRssBytes) : 0.0;
+        result.failures = failures.load();
+        return result;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief  할당 추적 파일(Builder::SetAllocationTrace)을 기록된 스레드 수 그대로 여러 PMR 리소스에 재생하여 나란히 비교합니다.
+ *         사용법: trace_replay <trace.bin> [--repeat N]
+ *         RSS는 같은 프로세스에서 순서대로 측정하므로, 해제한 메모리를 OS에 돌려주지 않는 new_delete_resource는 마지막에 실행합니다.
+ */
+int main(int argc, char* argv[])
+{
+    std::string tracePath;
+    int repeat = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--repeat") == 0 && hasValue) repeat = std::max(1, std::atoi(argv[++i]));
+        else tracePath = argv[i];
+    }
+    if (tracePath.empty())
+    {
+        std::cerr << "Usage: trace_replay <trace.bin> [--repeat N]" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        const ReplayPlan plan = BuildPlan(AdaptiveArena::AllocationTraceReader::Load(tracePath));
+        std::cout << "Trace: " << plan.threads.size() << " threads, " << plan.allocations << " allocations, " << plan.frees << " frees"
+                  << " (" << plan.unmatchedFrees << " unmatched), peak live " << plan.peakLiveBytes / 1024 << " KB\n\n";
+
+        std::vector<ReplayResult> results;
+        {
+            auto arena = AdaptiveArena::Builder()
+                            .SetKey("TraceReplay_Key")
+                            .SetPath(std::filesystem::temp_directory_path() / "trace_replay_profile.bin")
+                            .SetMode(AdaptiveArena::ArenaMode::Generic)
+                            .SetTelemetryRate(0.0)
+                            .SetCheckpointInterval(std::chrono::milliseconds(0))
+                            .Build();
+            results.push_back(Replay(plan, *arena, "adaptive_arena", repeat));
+        }
+        {
+            std::pmr::unsynchronized_pool_resource pool;
+            LockedResource locked(pool);
+            results.push_back(Replay(plan, locked, "unsync_pool+mutex", repeat));
+        }
+        {
+            std::pmr::synchronized_pool_resource pool;
+            results.push_back(Replay(plan, pool, "sync_pool", repeat));
+        }
+        results.push_back(Replay(plan, *std::pmr::new_delete_resource(), "new_delete", repeat));
+
+        std::cout << std::left << std::setw(20) << "resource" << std::right
+                  << std::setw(12) << "Mops/s" << std::setw(10) << "p50 ns" << std::setw(10) << "p99 ns" << std::setw(10) << "p99.9 ns"
+                  << std::setw(12) << "max ns" << std::setw(14) << "peak RSS KB" << std::setw(8) << "frag" << std::setw(10) << "failed" << std::setw(10) << "wait ms" << "\n";
+        for (const ReplayResult& r : results)
+        {
+            std::cout << std::left << std::setw(20) << r.name << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(12) << r.opsPerSec / 1e6 << std::setprecision(0)
+                      << std::setw(10) << r.p50Ns << std::setw(10) << r.p99Ns << std::setw(10) << r.p999Ns << std::setw(12) << r.maxNs
+                      << std::setw(14) << r.peakRssBytes / 1024 << std::setprecision(2) << std::setw(8) << r.fragmentation
+                      << std::setw(10) << r.failures << std::setprecision(1) << std::setw(10) << r.waitSeconds * 1e3 << "\n";
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -24,6 +24,7 @@ struct BenchmarkResult {
     std::string name;
     double totalTimeSec;
     double avgLatencyUs;
+    double p99LatencyUs;
     double maxLatencyUs;
     size_t processedFrames;
     size_t allocatedBytes;
@@ -48,6 +49,7 @@ public:
         BenchmarkResult result{"Baseline (Malloc)"};
         std::atomic<double> totalLatency{0};
         std::atomic<double> maxLatency{0};
+        AdaptiveArena::LatencyHistogram histogram;
         
         auto startTime = std::chrono::high_resolution_clock::now();
 
@@ -97,6 +99,7 @@ public:
                     
                     totalLatency = totalLatency + latency;
                     if (latency > maxLatency) maxLatency = latency;
+                    histogram.Record(static_cast<uint64_t>(latency * 1000.0));
 
                     // Mock Processing (with Jitter)
                     // Volatile write to prevent optimization
@@ -115,6 +118,7 @@ public:
         auto endTime = std::chrono::high_resolution_clock::now();
         result.totalTimeSec = std::chrono::duration<double>(endTime - startTime).count();
         result.avgLatencyUs = totalLatency / result.processedFrames;
+        result.p99LatencyUs = histogram.Summarize().p99Us;
         result.maxLatencyUs = maxLatency;
         
         return result;
@@ -135,31 +139,28 @@ public:
 
     BenchmarkResult Run() {
         BenchmarkResult result{"Adaptive Arena"};
-        std::atomic<double> totalLatency{0};
-        std::atomic<double> maxLatency{0};
 
-        // Header: 64 bytes (approx), Payload: FRAME_SIZE, Initial Slots: 10
-        arena.InitializeRing(64, FRAME_SIZE, 10); 
+        // Header: PacketHeader, Payload: FRAME_SIZE, Initial Slots: 10
+        arena.InitializeRing(sizeof(PacketHeader), FRAME_SIZE, 10); 
+        size_t consumerCursor = arena.AddCursor("Consumer");
+
+        // Acquisition source frame (DMA buffer stand-in)
+        std::vector<char> source(FRAME_SIZE, static_cast<char>(0xCD));
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
         std::thread producer([&]() {
             for (int i = 0; i < FRAME_COUNT; ++i) {
-                auto* ptr = arena.AllocatePinned(FRAME_SIZE);
-                if (ptr) {
-                    // Timestamp is typically in header, simplifying here by expecting header access
-                    // But for raw speed test, we just assume metadata is managed
-                    // Simulate write
-                    memset(ptr, 0xCD, FRAME_SIZE); 
-                    
-                    // Simulate Lag for adaptation (Force high lag to trigger expansion path check)
-                    // In a real scenario, this is calculated from atomic indices.
-                    // Here we just call the adaptation routine to measure its overhead.
-                    arena.AdaptToJitter(); 
-                } else {
-                    // Frame Drop in Arena? Usually it expands.
+                // Back-pressure: a full ring feeds its demand to the predictor and expands on the next cycle
+                size_t slot = 0;
+                while (!arena.TryClaimWrite(slot)) {
+                    std::this_thread::yield();
                 }
 
+                // Streaming copy-in (CommitWrite fences it and stamps PacketHeader::timestamp)
+                arena.WritePayload(slot, source.data(), FRAME_SIZE); 
+                arena.CommitWrite();
+
                 // Simulate 30 FPS
                 std::this_thread::sleep_for(std::chrono::milliseconds(33));
             }
@@ -169,15 +170,22 @@ public:
             std::mt19937 rng(12345);
             std::uniform_int_distribution<int> jitter(0, JITTER_MAX_MS);
             
-            size_t readIndex = 0;
-            while (readIndex < FRAME_COUNT) {
+            size_t readCount = 0;
+            while (readCount < FRAME_COUNT) {
                  // Polling for data (Zero Copy Reader)
-                 // In real app, we'd check WriteIndex vs ReadIndex. 
-                 // Assuming simpler valid check for benchmark
-                 
+                 size_t slot = 0;
+                 if (!arena.AcquireRead(consumerCursor, slot)) {
+                     std::this_thread::yield();
+                     continue;
+                 }
+
                  // Simulate Jitter
+                 volatile char c = static_cast<char*>(arena.GetPayload(slot))[0];
+                 (void)c;
                  std::this_thread::sleep_for(std::chrono::milliseconds(jitter(rng)));
-                 readIndex++;
+
+                 arena.Release(consumerCursor);
+                 readCount++;
                  result.processedFrames++;
             }
         });
@@ -187,10 +195,14 @@ public:
 
         auto endTime = std::chrono::high_resolution_clock::now();
         result.totalTimeSec = std::chrono::duration<double>(endTime - startTime).count();
-        // Latency in Ring Buffer is implicitly handled by Lag. 
-        // We'll trust the visualizer metrics for deep latency, here we verify throughput stability.
-        result.avgLatencyUs = 0; // Placeholder for now
-        result.maxLatencyUs = 0; 
+
+        // Commit -> Acquire latency, same span as the baseline's push -> pop
+        TelemetrySnapshot telemetry;
+        arena.CaptureTelemetry(telemetry);
+        LatencyPercentiles latency = telemetry.stages[consumerCursor].queueLatency;
+        result.avgLatencyUs = latency.meanUs;
+        result.p99LatencyUs = latency.p99Us;
+        result.maxLatencyUs = latency.maxUs; 
 
         return result;
     }
@@ -209,7 +221,7 @@ int main() {
     BenchmarkResult bRes = baseline.Run();
 
     std::cout << " -> Time: " << bRes.totalTimeSec << "s\n";
-    std::cout << " -> Max Latency: " << bRes.maxLatencyUs << "us\n\n";
+    std::cout << " -> Avg / P99 / Max Latency: " << bRes.avgLatencyUs << " / " << bRes.p99LatencyUs << " / " << bRes.maxLatencyUs << "us\n\n";
 
     // Run Arena
     std::cout << "Running Adaptive Arena...\n";
@@ -217,6 +229,7 @@ int main() {
     BenchmarkResult aRes = arenaTest.Run();
 
     std::cout << " -> Time: " << aRes.totalTimeSec << "s\n";
+    std::cout << " -> Avg / P99 / Max Latency: " << aRes.avgLatencyUs << " / " << aRes.p99LatencyUs << " / " << aRes.maxLatencyUs << "us\n";
     std::cout << " -> Throughput maintained despite jitter.\n";
     
     std::cout << "\n================================================\n";